@@ -38,9 +38,18 @@
 
 #pragma once
 
+/* stdlib includes */
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
 /* Qt includes */
 #include <QApplication>
+#include <QElapsedTimer>
+#include <QLabel>
 #include <QMainWindow>
+#include <QTimer>
 
 #include <ui_gui_mainwnd.h>
 
@@ -54,6 +63,86 @@
  *            application
  */
 namespace tfd::sandbox {
+    /**
+     * \class StressGenerator
+     * \brief synthetic telemetry source reproducing production load on an object radar
+     *
+     * The generator adds a number of moving objects of mixed types to a radar and feeds their
+     * position updates from a worker thread at a fixed rate. All updates of one tick are pushed
+     * as a single batch of handle-based update records into an update channel, which is the
+     * fastest way to drive the widget: the worker never blocks and never touches the widget,
+     * and the radar applies all queued records once per frame. If the radar falls behind, the
+     * channel rejects records instead of stalling the producer; those are counted.
+     */
+    class StressGenerator {
+    public:
+        /**
+         * \brief adds the objects and starts the worker thread
+         * \param [in,out] radar object radar that is to be fed
+         * \param [in] count number of objects
+         * \param [in] rate update rate, in updates per object and second
+         */
+        explicit StressGenerator(tfd::ObjectRadar *radar, int count, double rate);
+        /**
+         * \brief stops the worker thread
+         * \note  The objects stay on the radar.
+         */
+        ~StressGenerator();
+        StressGenerator(StressGenerator const &)            = delete;
+        StressGenerator &operator=(StressGenerator const &) = delete;
+
+        /**
+         * \brief  retrieves the number of objects
+         * \return number of objects
+         */
+        int count() const noexcept { return static_cast<int>(m_tracks.size()); }
+        /**
+         * \brief  retrieves the requested update rate
+         * \return update rate, in updates per object and second
+         */
+        double rate() const noexcept { return m_rate; }
+        /**
+         * \brief  retrieves the number of update records queued so far
+         * \return number of records
+         */
+        quint64 pushed() const noexcept { return m_pushed.load(std::memory_order_relaxed); }
+        /**
+         * \brief  retrieves the number of update records rejected so far because the radar
+         *         fell behind
+         * \return number of records
+         */
+        quint64 rejected() const noexcept { return m_rejected.load(std::memory_order_relaxed); }
+
+    private:
+        /**
+         * \struct Track
+         * \brief  simulated motion of one object
+         */
+        struct Track {
+            tfd::ObjectHandle m_handle;         /**< handle of the object */
+            QPointF           m_position;       /**< current [lat, long] position */
+            float             m_altitude = 0.f; /**< altitude, in meters above sea-level */
+            float             m_speed    = 0.f; /**< ground speed, in meters per second */
+            float             m_heading  = 0.f; /**< track, in degrees clockwise from true north */
+            float             m_turnRate = 0.f; /**< change of the track, in degrees per second */
+        };
+
+        std::vector<Track>                  m_tracks;              /**< motion of all objects (owned by the worker once started) */
+        std::shared_ptr<tfd::UpdateChannel> m_channel;             /**< channel the updates are pushed into */
+        QPointF                             m_center;              /**< radar center objects are kept around */
+        double                              m_radius = 0.;         /**< distance from the center objects turn back at, in meters */
+        double                              m_rate   = 0.;         /**< update rate, per object and second */
+        std::atomic<quint64>                m_pushed{ 0 };         /**< number of records queued so far */
+        std::atomic<quint64>                m_rejected{ 0 };       /**< number of records rejected so far */
+        std::atomic<bool>                   m_isStopping{ false }; /**< whether or not the worker is to exit */
+        std::thread                         m_worker;              /**< worker thread; started last */
+
+        /**
+         * \brief worker loop
+         */
+        void int_run() noexcept;
+    };
+
     /**
      * \class MainWindow
      * \brief main window for sandbox application
@@ -77,7 +166,18 @@ namespace tfd::sandbox {
         ~MainWindow();
 
     private:
-        tfd::ObjectRadar *m_radar; /**< pointer to the object radar */
+        tfd::ObjectRadar                  *m_radar;                  /**< pointer to the object radar */
+        std::unique_ptr<StressGenerator>   m_stress;                 /**< load generator, if started with '--stress' */
+        QLabel                            *m_stressStatus = nullptr; /**< status bar readout of the load generator */
+        QTimer                             m_statusTimer;            /**< refreshes *m_stressStatus* */
+        QElapsedTimer                      m_statusClock;            /**< time since the last refresh */
+        quint64                            m_statusPushed = 0;       /**< records queued as of the last refresh */
+        std::unique_ptr<tfd::UpdateReplay> m_replay;                 /**< log replay, if started with '--replay' */
+
+        /**
+         * \brief refreshes the throughput and frame time shown in the status bar
+         */
+        void int_updateStressStatus();
 
         /**
          * \brief instantiate view widgets and set-up layouts and connections
@@ -35,11 +35,138 @@
  * but also as an example application that demonstrates basic as well as advanced usage of the library.
  */
 
+/* stdlib includes */
+#include <chrono>
+#include <cmath>
+#include <random>
+
+/* Qt includes */
+#include <QStatusBar>
+
 /* sandbox includes */
 #include <tfd-sandbox/src/include/tfd-sandbox.hpp>
 
 
 namespace tfd::sandbox {
+    /* load generator */
+    namespace priv {
+        static constexpr double gl_MetersPerDeg = 111320.;                /**< meters per degree of latitude */
+        static constexpr double gl_PI           = 3.14159265358979323846; /**< pi */
+
+        /**
+         * \brief  retrieves the value following a command-line option
+         * \param  [in] args command-line arguments
+         * \param  [in] opt option, e.g. "--rate"
+         * \param  [in] def value returned if the option or its value is missing
+         * \return value of the option, or **def**
+         */
+        static double int_optionValue(QStringList const &args, QString const &opt, double def) {
+            qsizetype const k = args.indexOf(opt);
+            if (k < 0 || k + 1 >= args.size())
+                return def;
+
+            bool         isok = false;
+            double const val  = args[k + 1].toDouble(&isok);
+            return isok ? val : def;
+        }
+        /**
+         * \brief  retrieves the string following a command-line option
+         * \param  [in] args command-line arguments
+         * \param  [in] opt option, e.g. "--record"
+         * \return value of the option, or an empty string if the option or its value is missing
+         */
+        static QString int_optionString(QStringList const &args, QString const &opt) {
+            qsizetype const k = args.indexOf(opt);
+            if (k < 0 || k + 1 >= args.size())
+                return QString{};
+
+            return args[k + 1];
+        }
+    }
+
+    StressGenerator::StressGenerator(tfd::ObjectRadar *radar, int count, double rate)
+        : m_center(radar->getProperty(tfd::ObjectRadar::Property::RadarCenter).toPointF()),
+          m_radius(0.9 * radar->getProperty(tfd::ObjectRadar::Property::RadarRange).toSizeF().height()),
+          m_rate(std::max(rate, 0.1))
+    {
+        std::mt19937                           rng{ 42 };
+        std::uniform_real_distribution<double> unit{ 0., 1. };
+        tfd::ObjectRadar::ObjectType const     types[] = { tfd::ObjectRadar::ObjectType::Vehicle, tfd::ObjectRadar::ObjectType::Person, tfd::ObjectRadar::ObjectType::Marker };
+
+        /* Vehicles fly, persons walk, markers stay where they are. */
+        radar->setObjectCapacity(static_cast<size_t>(count));
+        m_tracks.reserve(static_cast<size_t>(count));
+        for (int k = 0; k < count; k++) {
+            auto const   type  = types[k % 3];
+            double const dist  = m_radius * std::sqrt(unit(rng));
+            double const angle = 2. * priv::gl_PI * unit(rng);
+
+            Track t;
+            t.m_position = m_center + QPointF{
+                dist * std::cos(angle) / priv::gl_MetersPerDeg,
+                dist * std::sin(angle) / (priv::gl_MetersPerDeg * std::cos(m_center.x() * priv::gl_PI / 180.))
+            };
+            t.m_altitude = type == tfd::ObjectRadar::ObjectType::Vehicle ? static_cast<float>(50. + 2950. * unit(rng)) : 0.f;
+            t.m_speed    = type == tfd::ObjectRadar::ObjectType::Vehicle ? static_cast<float>(20. + 230. * unit(rng)) : type == tfd::ObjectRadar::ObjectType::Person ? static_cast<float>(0.5 + 1.5 * unit(rng)) : 0.f;
+            t.m_heading  = static_cast<float>(360. * unit(rng));
+            t.m_turnRate = static_cast<float>(6. * unit(rng) - 3.);
+            t.m_handle   = radar->addObject(QString{ "S%1" }.arg(k), type, t.m_position, t.m_altitude);
+            if (t.m_handle.isValid())
+                m_tracks.push_back(t);
+        }
+
+        /* Room for a few ticks in case a frame takes longer than usual. */
+        m_channel = radar->openUpdateChannel(std::max<size_t>(4 * m_tracks.size(), 4096));
+        if (m_channel != nullptr)
+            m_worker = std::thread{ [this]() { int_run(); } };
+    }
+
+    StressGenerator::~StressGenerator() {
+        m_isStopping.store(true, std::memory_order_relaxed);
+        if (m_worker.joinable())
+            m_worker.join();
+    }
+
+    void StressGenerator::int_run() noexcept {
+        using Clock = std::chrono::steady_clock;
+
+        try {
+            std::vector<tfd::ObjectRadar::ObjectUpdate> upd(m_tracks.size());
+
+            double const            dt     = 1. / m_rate;
+            Clock::duration const   period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(dt));
+            Clock::time_point       next   = Clock::now();
+            while (!m_isStopping.load(std::memory_order_relaxed)) {
+                for (size_t k = 0; k < m_tracks.size(); k++) {
+                    Track &t = m_tracks[k];
+
+                    /* Turn slowly; head back towards the center once at the edge of the range. */
+                    double const h   = t.m_heading * priv::gl_PI / 180.;
+                    double const kl  = priv::gl_MetersPerDeg * std::cos(t.m_position.x() * priv::gl_PI / 180.);
+                    t.m_position    += QPointF{ t.m_speed * std::cos(h) * dt / priv::gl_MetersPerDeg, t.m_speed * std::sin(h) * dt / kl };
+                    t.m_heading      = std::fmod(t.m_heading + t.m_turnRate * static_cast<float>(dt) + 360.f, 360.f);
+
+                    QPointF const d{ (t.m_position.x() - m_center.x()) * priv::gl_MetersPerDeg, (t.m_position.y() - m_center.y()) * kl };
+                    if (d.x() * d.x() + d.y() * d.y() > m_radius * m_radius)
+                        t.m_heading = static_cast<float>(std::fmod(std::atan2(-d.y(), -d.x()) * 180. / priv::gl_PI + 360., 360.));
+
+                    upd[k] = tfd::ObjectRadar::ObjectUpdate{
+                        t.m_handle, t.m_position, t.m_altitude, true, tfd::ObjectRadar::ObjectUpdate::AllWithMotion, t.m_speed, t.m_heading
+                    };
+                }
+
+                /* One batch per tick; whatever does not fit is dropped, not waited for. */
+                size_t const n = m_channel->push(upd.data(), upd.size());
+                m_pushed.fetch_add(n, std::memory_order_relaxed);
+                m_rejected.fetch_add(upd.size() - n, std::memory_order_relaxed);
+
+                next += period;
+                std::this_thread::sleep_until(next);
+            }
+        } catch (...) { /* Stop generating. */ }
+    }
+
+
     MainWindow::MainWindow(QSize const &dim, QString const &title)
         : QMainWindow(nullptr)
     {
@@ -48,12 +175,72 @@ namespace tfd::sandbox {
         resize(dim);
         setWindowTitle(title);
 
-        /* Set-up object radar. */
-        m_radar = new tfd::ObjectRadar(QSize(600, 600), this);
+        /* Set-up object radar. Use the GPU or the threaded backend if requested. */
+        QStringList const args    = QCoreApplication::arguments();
+        auto const        backend = args.contains("--opengl")
+            ? tfd::ObjectRadar::Backend::OpenGL
+            : args.contains("--threaded") ? tfd::ObjectRadar::Backend::Threaded : tfd::ObjectRadar::Backend::Raster;
+        m_radar = new tfd::ObjectRadar(QSize(600, 600), this, backend);
         loCenter->replaceWidget(wgPlaceholder, m_radar);
+
+        /* Reproduce production load if requested: '--stress N [--rate Hz]'. */
+        if (args.contains("--stress")) {
+            m_radar->setProperty(tfd::ObjectRadar::Property::RadarCenter, QPointF{ 48.137, 11.575 });
+            m_radar->setProperty(tfd::ObjectRadar::Property::RadarRange, QSizeF{ 5., 20000. });
+            m_radar->setProperty(tfd::ObjectRadar::Property::PredictionHorizon, 1.f);
+
+            int const    count = static_cast<int>(priv::int_optionValue(args, "--stress", 1000.));
+            double const rate  = priv::int_optionValue(args, "--rate", 10.);
+            m_stress = std::make_unique<StressGenerator>(m_radar, std::max(count, 1), rate);
+
+            m_stressStatus = new QLabel(this);
+            statusBar()->addWidget(m_stressStatus);
+            connect(&m_statusTimer, &QTimer::timeout, this, [this]() { int_updateStressStatus(); });
+            m_statusClock.start();
+            m_statusTimer.start(1000);
+        }
+
+        /* Record all updates if requested: '--record FILE'. */
+        QString const record = priv::int_optionString(args, "--record");
+        if (!record.isEmpty() && !m_radar->startRecording(record))
+            statusBar()->showMessage(QString{ "Could not record to '%1'." }.arg(record));
+
+        /* Feed a recorded log back in if requested: '--replay FILE [--fast]'. */
+        QString const replay = priv::int_optionString(args, "--replay");
+        if (!replay.isEmpty()) {
+            m_replay = std::make_unique<tfd::UpdateReplay>(m_radar);
+
+            connect(m_replay.get(), &tfd::UpdateReplay::finished, this, [this](quint64 nupd, double secs) {
+                statusBar()->showMessage(QString{ "Replayed %1 updates in %2 s." }.arg(nupd).arg(secs, 0, 'f', 3));
+            });
+            auto const pace = args.contains("--fast") ? tfd::UpdateReplay::Pace::Unthrottled : tfd::UpdateReplay::Pace::RealTime;
+            if (!m_replay->open(replay) || !m_replay->start(pace))
+                statusBar()->showMessage(QString{ "Could not replay '%1'." }.arg(replay));
+        }
+    }
+
+    MainWindow::~MainWindow() {
+        /* Stop feeding before the radar is destroyed along with the window. */
+        m_replay.reset();
+        m_stress.reset();
+        m_radar->stopRecording();
     }
 
-    MainWindow::~MainWindow() { }
+    void MainWindow::int_updateStressStatus() {
+        quint64 const pushed  = m_stress->pushed();
+        double const  elapsed = std::max(m_statusClock.restart() * 1e-3, 1e-3);
+        double const  ups     = (pushed - m_statusPushed) / elapsed;
+        m_statusPushed        = pushed;
+
+        QString text = QString{ "%1 objects @ %2 Hz  |  %3 updates/s, %4 rejected" }
+            .arg(m_stress->count()).arg(m_stress->rate(), 0, 'f', 1).arg(ups, 0, 'f', 0).arg(m_stress->rejected());
+
+        /* Frame times are only available in instrumented builds. */
+        auto const stats = m_radar->getFrameStatistics();
+        if (stats.has_value())
+            text += QString{ "  |  frame %1 ms, %2 / %3 fps" }.arg(stats->m_frameTime, 0, 'f', 2).arg(stats->m_achievedRate, 0, 'f', 1).arg(stats->m_requestedRate, 0, 'f', 1);
+        m_stressStatus->setText(text);
+    }
 }
 
 namespace tfd::sandbox {
@@ -64,6 +251,10 @@ namespace tfd::sandbox {
         if (QCoreApplication::arguments().contains("--run-tests")) {
             tfd::RunObjectRadarTests();
         }
+        /* Run benchmarks. */
+        if (QCoreApplication::arguments().contains("--run-benchmarks")) {
+            tfd::RunObjectRadarBenchmarks();
+        }
 
         /* Instantiate main window. */
         m_mainWindow = new sandbox::MainWindow(QSize(1200, 800), "Tophy's Flight Instruments - Sandbox");
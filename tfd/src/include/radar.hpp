@@ -37,6 +37,13 @@
 
 #pragma once
 
+/* stdlib includes */
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 /* Qt includes */
 #include <QWidget>
 #include <QVariant>
@@ -47,9 +54,74 @@
 
 namespace tfd {
     namespace tests {
-        class ObjectRadarTests; /**< object radar tests */
+        class ObjectRadarTests;      /**< object radar tests */
+        class ObjectRadarBenchmarks; /**< object radar benchmarks */
     }
     class ObjectRadarPrivate;   /**< internal data for object radar widget */
+    class RadarArea;            /**< polygon area */
+    class RadarScene;           /**< object store shared by object radars */
+    class RadarScenePrivate;    /**< internal data for shared scenes */
+    class UpdateChannel;        /**< lock-free object update queue */
+    class UpdateChannelPrivate; /**< internal data for update channels */
+    class UpdateReplayPrivate;  /**< internal data for update log replays */
+    class RadarPath;            /**< polyline path */
+    class RadarShape;           /**< vertices shared by areas and paths */
+
+    /**
+     * \class ObjectHandle
+     * \brief compact, generation-checked reference to an object on an object radar
+     * 
+     * Handles are issued by ObjectRadar::addObject() and remain valid for as long as the
+     * object they refer to exists. Resolving a handle does not involve any string hashing,
+     * so handles should be preferred over identifiers on hot paths. Once the object is
+     * removed, all handles referring to it become *stale* and are rejected by every
+     * function accepting a handle, even if the slot is reused for a new object later.
+     */
+    class ObjectHandle {
+    public:
+        constexpr ObjectHandle() noexcept = default;
+        /**
+         * \brief constructs a handle from its components
+         * \param [in] index slot index of the object
+         * \param [in] gen generation of the slot at the time the handle was issued
+         * \note  Handles are usually not constructed manually but obtained through
+         *        ObjectRadar::addObject() or ObjectRadar::getHandle().
+         */
+        constexpr explicit ObjectHandle(quint32 index, quint32 gen) noexcept
+            : m_index(index), m_generation(gen)
+        { }
+
+        /**
+         * \brief  retrieves the slot index of the handle
+         * \return slot index
+         */
+        constexpr quint32 index() const noexcept { return m_index; }
+        /**
+         * \brief  retrieves the generation of the handle
+         * \return generation, or *0* if the handle is invalid
+         */
+        constexpr quint32 generation() const noexcept { return m_generation; }
+        /**
+         * \brief  checks whether the handle was ever issued for an object
+         * \return *true* if the handle is valid, *false* if it is default-constructed
+         * \note   A valid handle may still be *stale* if the object it refers to has been
+         *         removed in the meantime.
+         */
+        constexpr bool isValid() const noexcept { return m_generation != 0; }
+        constexpr explicit operator bool() const noexcept { return isValid(); }
+
+        constexpr bool operator ==(ObjectHandle const &other) const noexcept {
+            return m_index == other.m_index && m_generation == other.m_generation;
+        }
+        constexpr bool operator !=(ObjectHandle const &other) const noexcept {
+            return !operator ==(other);
+        }
+
+    private:
+        quint32 m_index      = 0; /**< slot index */
+        quint32 m_generation = 0; /**< slot generation; *0* denotes an invalid handle */
+    };
+    Q_DECLARE_METATYPE(ObjectHandle);
 
     /**
      * \class ObjectRadar
@@ -65,40 +137,111 @@ namespace tfd {
 
     public:
         friend class tests::ObjectRadarTests;
+        friend class tests::ObjectRadarBenchmarks;
 
         /**
          * \enum  Property
          * \brief enumeration for property fields
          * 
          * The values of this enumeration are used for the get*() and set*() family of methods.
+         * 
+         * \note  The values are part of the binary interface and of the update log format. New
+         *        properties are therefore only ever appended, so view and object properties are
+         *        interleaved; use *isViewProperty()* and *isObjectProperty()* to tell them apart.
          */
         enum class Property {
             /* view properties */
-            UpdateRate,      /**< [float] update rate per second (essentially FPS) {0.1, 240} */
-            StaticTextFont,  /**< [FontProperties] main display font used for static text WITHIn the radar view */
-            LabelFont,       /**< [FontProperties] font used for labels OUTSIDE of the radar view */
-            ObjectLabelFont, /**< [FontProperties] font used for labels of radar objects */
-            ForegroundColor, /**< [color] color used for lines and standard text */
-            BackgroundColor, /**< [color] color used for backgrounds */
-            RadarCenter,     /**< [point] {lat, lon} position of radar center */
-            RadarAltitude,   /**< [float] altitude of radar center, in meters above sea-level */
-            RadarRange,      /**< [size] radar range {min, max}, in meters relative to the radar center */
-            AreaOpacity,     /**< [int] opacity of the fill color used for area objects */
-            OutlineStrength, /**< [int] width in pixels for the area outline */
-            OutlineStyle,    /**< [Qt::PenStyle] style (solid, dashed, dotted, etc.) used for outlines */
+            UpdateRate        = 0,  /**< [float] update rate per second (essentially FPS) {0.1, 240} */
+            StaticTextFont    = 1,  /**< [FontProperties] main display font used for static text WITHIn the radar view */
+            LabelFont         = 2,  /**< [FontProperties] font used for labels OUTSIDE of the radar view */
+            ObjectLabelFont   = 3,  /**< [FontProperties] font used for labels of radar objects */
+            ForegroundColor   = 4,  /**< [color] color used for lines and standard text */
+            BackgroundColor   = 5,  /**< [color] color used for backgrounds */
+            RadarCenter       = 6,  /**< [point] {lat, lon} position of radar center */
+            RadarAltitude     = 7,  /**< [float] altitude of radar center, in meters above sea-level */
+            RadarRange        = 8,  /**< [size] radar range {min, max}, in meters relative to the radar center */
+            AreaOpacity       = 9,  /**< [int] opacity of the fill color used for area objects */
+            OutlineStrength   = 10, /**< [int] width in pixels for the area outline */
+            OutlineStyle      = 11, /**< [Qt::PenStyle] style (solid, dashed, dotted, etc.) used for outlines */
 
             /* object properties */
-            Identifier,      /**< [str] object identifier */
-            Type,            /**< [ObjectType] object type */
-            Position,        /**< [point] position (latitude, longitude) */
-            Color,           /**< [color] RGBA color */
-            Area,            /**< [size] size of object (only for *area* type) */
-            Altitude,        /**< [float] altitude of object (not for areas) */
-            Visibility,      /**< [bool] object visible flag */
+            Identifier        = 12, /**< [str] object identifier */
+            Type              = 13, /**< [ObjectType] object type */
+            Position          = 14, /**< [point] position (latitude, longitude) */
+            Color             = 15, /**< [color] RGBA color */
+            Area              = 16, /**< [RadarArea] outline of object (only for *area* type) */
+            Altitude          = 17, /**< [float] altitude of object (not for areas) */
+            Visibility        = 18, /**< [bool] object visible flag */
+
+            /* properties added later (view and object properties) */
+            RedrawMode        = 19, /**< [RedrawMode] view: how frames are scheduled; see *ObjectRadar::RedrawMode* */
+            Path              = 20, /**< [RadarPath] object: course of object (only for *path* type) */
+            PredictionHorizon = 21, /**< [float] view: maximum time, in seconds, for which moving objects are extrapolated past their last position update; 0 disables extrapolation {0, 60} */
+            GroundSpeed       = 22, /**< [float] object: ground speed of object, in meters per second (used for extrapolation) */
+            Heading           = 23, /**< [float] object: track of object, in degrees clockwise from true north {0, 360} */
+            ClusterCellSize   = 24, /**< [int] view: edge length, in pixels, of the screen cells in which nearby objects are merged into count badges; 0 disables clustering {0, 200} */
+            StatisticsRate    = 25, /**< [float] view: how often, per second, *frameStatisticsUpdated()* is emitted; 0 disables the signal {0, 60} */
+            StatisticsOverlay = 26, /**< [bool] view: whether or not frame statistics are drawn on top of the radar view (debugging aid) */
+            LabelVisibility   = 27, /**< [bool] view: whether or not objects are labeled with their identifiers */
                              
-            __N__            /**< *only used internally* */
+            __N__                   /**< *only used internally* */
         };
         Q_ENUM(tfd::ObjectRadar::Property);
+        /**
+         * \brief  checks whether a property is an object property
+         * \param  [in] prop property
+         * \return *true* if **prop** is an object property, *false* if it is a view property or
+         *         no property at all
+         */
+        static constexpr bool isObjectProperty(Property prop) noexcept {
+            switch (prop) {
+                case Property::Identifier:
+                case Property::Type:
+                case Property::Position:
+                case Property::Color:
+                case Property::Area:
+                case Property::Altitude:
+                case Property::Visibility:
+                case Property::Path:
+                case Property::GroundSpeed:
+                case Property::Heading:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+        /**
+         * \brief  checks whether a property is a view property
+         * \param  [in] prop property
+         * \return *true* if **prop** is a view property, *false* if it is an object property or
+         *         no property at all
+         */
+        static constexpr bool isViewProperty(Property prop) noexcept {
+            return prop >= Property::UpdateRate && prop < Property::__N__ && !isObjectProperty(prop);
+        }
+        /**
+         * \struct PropertyTraits
+         * \brief  compile-time information on a property, used by the typed property accessors
+         * \note   Specialized for every property right after the definition of this class.
+         * \see    ObjectRadar::get(), ObjectRadar::set()
+         */
+        template<Property P>
+        struct PropertyTraits;
+        /**
+         * \brief value type of a property as used by the typed property accessors
+         */
+        template<Property P>
+        using PropertyType = typename PropertyTraits<P>::Type;
+        /**
+         * \brief restricts the typed property accessors to view properties
+         */
+        template<Property P>
+        using ViewProperty = std::enable_if_t<isViewProperty(P), int>;
+        /**
+         * \brief restricts the typed property accessors to object properties
+         */
+        template<Property P>
+        using ObjectProperty = std::enable_if_t<isObjectProperty(P), int>;
         /**
          * \enum  ObjectType
          * \brief enumeration for various object types representable on the object radar
@@ -117,15 +260,227 @@ namespace tfd {
             __N__    /**< *only used internally* */
         };
         Q_ENUM(tfd::ObjectRadar::ObjectType);
+        /**
+         * \enum  RedrawMode
+         * \brief enumeration for the ways the object radar can schedule new frames
+         */
+        enum class RedrawMode {
+            /**
+             * The widget checks for changes *UpdateRate* times per second and repaints
+             * immediately if there are any. Frames are evenly spaced but not aligned with the
+             * display refresh or the arrival of data.
+             */
+            FixedRate,
+            /**
+             * The widget only schedules a frame when something changed. All changes that arrive
+             * until the frame is drawn are coalesced, and the frame is queued via
+             * *QWidget::update()* so that it is aligned with the display refresh where the
+             * platform supports it. *UpdateRate* acts as a cap on the frame rate. If nothing
+             * changes, no frames are drawn at all.
+             */
+            OnDemand,
+
+            __N__     /**< *only used internally* */
+        };
+        Q_ENUM(tfd::ObjectRadar::RedrawMode);
+
+        /**
+         * \struct ObjectUpdate
+         * \brief  typed update record for a single radar object
+         * 
+         * Update records are used with ObjectRadar::updateObjects() to apply a whole batch of
+         * object updates (e.g., one telemetry frame) at once. In contrast to the *QVariant*-based
+         * ObjectRadar::setProperty(QString, Property, QVariant), no boxing, no per-field type
+         * checking and no identifier lookup is done.
+         */
+        struct ObjectUpdate {
+            /**
+             * \enum  Field
+             * \brief flags selecting which fields of an update record are applied
+             */
+            enum Field : int {
+                Position   = 1 << 0, /**< apply *m_position* */
+                Altitude   = 1 << 1, /**< apply *m_altitude* */
+                Visibility = 1 << 2, /**< apply *m_isVisible* */
+                Motion     = 1 << 3, /**< apply *m_groundSpeed* and *m_heading* (opt-in; not part of *All*) */
+
+                All           = Position | Altitude | Visibility, /**< apply all fields except the motion */
+                AllWithMotion = All | Motion                      /**< apply all fields */
+            };
+
+            ObjectHandle m_handle;                   /**< handle of the object that is to be updated */
+            QPointF      m_position;                 /**< new [lat, long] position */
+            float        m_altitude    = 0.f;        /**< new altitude in meters above sea-level */
+            bool         m_isVisible   = true;       /**< new visibility flag */
+            int          m_fields      = Field::All; /**< combination of *Field* flags */
+            float        m_groundSpeed = 0.f;        /**< new ground speed, in meters per second */
+            float        m_heading     = 0.f;        /**< new track, in degrees clockwise from true north */
+        };
+
+        /**
+         * \enum  Backend
+         * \brief enumeration for the available rendering backends
+         */
+        enum class Backend {
+            Raster,  /**< CPU rendering via *QPainter* (always available) */
+            OpenGL,  /**< GPU rendering via OpenGL 3.3/OpenGL ES 3.0; falls back to *Raster* if unusable */
+            Threaded /**< CPU rendering on a worker thread; the GUI thread only takes scene snapshots and blits finished frames */
+        };
+        Q_ENUM(tfd::ObjectRadar::Backend);
+
+        /**
+         * \struct FrameStatistics
+         * \brief  timing and workload of the frame pipeline
+         *
+         * Stage times are measured with a steady clock around each stage of the frame pipeline
+         * and describe the last completed frame, i.e., the last dispatch of the redraw timer
+         * together with the paint events it caused.
+         *
+         * \note   Statistics are only collected if the module is built with
+         *         *TFD_INSTRUMENTATION* defined (the default in debug builds). Otherwise, the
+         *         instrumentation compiles out entirely.
+         * \see    ObjectRadar::getFrameStatistics()
+         */
+        struct FrameStatistics {
+            /**
+             * \enum  Stage
+             * \brief stages of the frame pipeline
+             */
+            enum Stage {
+                Ingest,  /**< draining update channels and applying the queued updates */
+                Layout,  /**< culling, projection, clustering and label layout; finding the dirty region or taking the scene snapshot */
+                Layers,  /**< blitting the pre-rendered scale and compass */
+                Shapes,  /**< drawing areas and paths */
+                Markers, /**< drawing icons and badges */
+                Labels,  /**< drawing labels */
+                Compose, /**< composing the frame on the worker thread (*Backend::Threaded* only) */
+
+                __N__    /**< number of stages */
+            };
+
+            quint64 m_frame                    = 0;   /**< number of frames completed so far */
+            double  m_stageTimes[Stage::__N__] = {};  /**< time spent in each stage, in milliseconds */
+            double  m_frameTime                = 0.;  /**< time spent in all stages on the GUI thread, in milliseconds */
+            double  m_interval                 = 0.;  /**< time between the starts of the last two frames, in milliseconds */
+            float   m_requestedRate            = 0.f; /**< requested frame rate (*UpdateRate*), in frames per second */
+            float   m_achievedRate             = 0.f; /**< frames actually dispatched per second, averaged over the last second (or statistics period) */
+            quint32 m_objectCount              = 0;   /**< number of objects */
+            quint32 m_inRangeCount             = 0;   /**< number of objects that passed range culling */
+            quint32 m_culledCount              = 0;   /**< number of objects outside of the radar range */
+            quint64 m_allocations              = 0;   /**< heap allocations made for the scratch buffers of the frame (0 once the frame arena fits a steady frame) */
+        };
+        /**
+         * \struct ChangeSet
+         * \brief  changes made while a transaction was open
+         * 
+         * Outside of transactions, every change is reported on its own. Inside of a transaction,
+         * the object radar only records what changed and reports all changes at once with
+         * *changesCommitted()* when the outermost transaction is committed.
+         * 
+         * \note   The lists are in the order the changes were made; an object that was added and
+         *         removed again during the transaction appears in both lists.
+         * \see    ObjectRadar::beginTransaction()
+         */
+        struct ChangeSet {
+            std::vector<QString>                     m_added;            /**< identifiers of the objects that were added */
+            std::vector<QString>                     m_removed;          /**< identifiers of the objects that were removed */
+            std::vector<std::pair<QString, QString>> m_renamed;          /**< [old, new] identifiers of the objects that were renamed */
+            std::vector<Property>                    m_properties;       /**< view properties that changed, ordered by property index */
+            bool                                     m_isCleared  = false; /**< whether or not all objects were removed (or replaced by a snapshot); the lists only hold the changes made after that */
+            bool                                     m_isComplete = true;  /**< *false* if changes could not be recorded (out of memory); consider all objects changed then */
+
+            /**
+             * \brief  checks whether anything changed at all
+             * \return *true* if nothing changed, *false* if not
+             */
+            bool isEmpty() const noexcept {
+                return m_added.empty() && m_removed.empty() && m_renamed.empty() && m_properties.empty() && !m_isCleared && m_isComplete;
+            }
+        };
+        /**
+         * \class Transaction
+         * \brief opens a transaction for the lifetime of the scope
+         * 
+         * \code
+         * {
+         *     ObjectRadar::Transaction tx{ radar };
+         *     for (auto const &obj : mission)
+         *         radar.addObject(obj.m_ident, obj.m_type, obj.m_position);
+         * } // changesCommitted() is emitted once here
+         * \endcode
+         * 
+         * \see   ObjectRadar::beginTransaction()
+         */
+        class Transaction {
+        public:
+            /**
+             * \brief opens a transaction
+             * \param [in] radar object radar the transaction is opened on
+             */
+            explicit Transaction(ObjectRadar &radar) noexcept
+                : m_radar(&radar)
+            {
+                radar.beginTransaction();
+            }
+            ~Transaction() { commit(); }
+
+            Transaction(Transaction const &) = delete;
+            Transaction &operator =(Transaction const &) = delete;
+
+            /**
+             * \brief commits the transaction before the end of the scope
+             * \note  Subsequent calls do nothing.
+             */
+            void commit() noexcept {
+                if (m_radar != nullptr)
+                    std::exchange(m_radar, nullptr)->commitTransaction();
+            }
+
+        private:
+            ObjectRadar *m_radar; /**< object radar the transaction was opened on, or *nullptr* if committed */
+        };
 
         /**
          * \brief create a new object radar widget
          * \param [in] dim dimensions of the widget (width x height), in pixels
          * \param [in] parent pointer to the parent widget
+         * \param [in] backend preferred rendering backend {def: Backend::Raster}
          */
-        explicit ObjectRadar(QSize const &dim, QWidget *parent = nullptr);
+        explicit ObjectRadar(QSize const &dim, QWidget *parent = nullptr, Backend backend = Backend::Raster);
+        /**
+         * \brief create a new object radar widget showing the objects of a shared scene
+         * \param [in] scene scene to show; a new, empty scene is created if this is *nullptr*
+         * \param [in] dim dimensions of the widget (width x height), in pixels
+         * \param [in] parent pointer to the parent widget
+         * \param [in] backend preferred rendering backend {def: Backend::Raster}
+         * \see   RadarScene
+         */
+        explicit ObjectRadar(std::shared_ptr<RadarScene> scene, QSize const &dim, QWidget *parent = nullptr, Backend backend = Backend::Raster);
         ~ObjectRadar();
 
+        /**
+         * \brief  retrieves the scene the object radar shows
+         * \return scene; pass it to ObjectRadar::ObjectRadar() to show the same objects in
+         *         another object radar
+         */
+        std::shared_ptr<RadarScene> getScene() const noexcept;
+
+        /**
+         * \brief  retrieves the rendering backend currently in use
+         * \return rendering backend
+         * \note   If the OpenGL backend was requested but the context turned out to be unusable,
+         *         this reports *Backend::Raster* once the fallback happened (i.e., after the widget
+         *         was first shown).
+         */
+        Backend getBackend() const noexcept;
+        /**
+         * \brief  retrieves the statistics of the last completed frame
+         * \return statistics, or an empty optional if the module was built without
+         *         *TFD_INSTRUMENTATION*
+         * \see    ObjectRadar::frameStatisticsUpdated()
+         */
+        std::optional<FrameStatistics> getFrameStatistics() const noexcept;
+
         /**
          * \brief  adds an object to the object radar
          * 
@@ -139,12 +494,12 @@ namespace tfd {
          * \param  [in] type object type to create
          * \param  [in] pos (initial) [long, lat] position of object on object radar
          * \param  [in] alt (initial) altitude in meters above sea-level {def: 0}
-         * \return *true* on success, *false* on error
+         * \return handle of the new object on success, or an invalid handle on error
          * \note   If an object with the same identifier as **ident** already exists, the function
          *         will fail.
          * \note   To disable altitude indicators for individual objects, set their altitude to *NaN*.
          */
-        bool addObject(QString const &ident, ObjectRadar::ObjectType type, QPointF const &pos, float alt = 0.f);
+        ObjectHandle addObject(QString const &ident, ObjectRadar::ObjectType type, QPointF const &pos, float alt = 0.f);
         /**
          * \brief  removes an object from the object radar
          * \param  [in] ident identifier of the object to remove
@@ -156,12 +511,82 @@ namespace tfd {
          *         before it is removed. The *tracked* state will not be propagated to a different object.
          */
         bool removeObject(QString const &ident);
+        /**
+         * \brief  removes an object from the object radar
+         * \param  [in] handle handle of the object to remove
+         * \return *true* on success, *false* on failure
+         * \see    ObjectRadar::removeObject(QString)
+         */
+        bool removeObject(ObjectHandle handle);
         /**
          * \brief removes all objects from the object radar
          * \note  If no objects are present, this function does nothing.
          * \note  The object that is currently being *tracked*, if there is any, is also removed.
          */
         void removeAllObjects();
+        /**
+         * \brief  limits the number of objects and allocates all per-object storage up-front
+         *
+         * Object storage and the per-frame draw lists are sized for **n** objects, so that adding,
+         * removing, updating and drawing objects does not allocate as long as there are at most
+         * **n** objects. Once the limit is reached, ObjectRadar::addObject() fails.
+         *
+         * \param  [in] n maximum number of objects, or 0 to lift the limit {def: 0}
+         * \return *true* on success, *false* if there are more than **n** objects already or if
+         *         the storage could not be allocated
+         * \note   Identifiers are stored as given; pass identifiers that are not modified
+         *         afterwards so that they are shared instead of copied.
+         */
+        bool setObjectCapacity(size_t n) noexcept;
+        /**
+         * \brief  retrieves the maximum number of objects
+         * \return maximum number of objects, or 0 if the number of objects is unlimited
+         * \see    ObjectRadar::setObjectCapacity()
+         */
+        size_t getObjectCapacity() const noexcept;
+        /**
+         * \brief  saves all objects and view properties to a snapshot file
+         * 
+         * Snapshots are a compact binary image of the object storage of the radar: fixed-size
+         * object records, the geometries of areas and paths (including their simplified vertex
+         * sets) and a string table for identifiers. The file is written atomically, i.e., an
+         * existing file is only replaced once the snapshot was written completely.
+         * 
+         * \param  [in] path path of the snapshot file
+         * \return *true* on success, *false* if the file could not be written
+         * \note   Snapshots use the byte order of the machine they were saved on and are only
+         *         loaded on machines with the same byte order.
+         * \see    ObjectRadar::loadSnapshot(QString)
+         */
+        bool saveSnapshot(QString const &path) const noexcept;
+        /**
+         * \brief  replaces all objects and view properties with those stored in a snapshot file
+         * 
+         * The file is memory-mapped and decoded in a single pass straight into the object
+         * storage, which is much faster than restoring a scene object by object. The tracked
+         * object is restored as well.
+         * 
+         * \param  [in] path path of the snapshot file
+         * \return *true* on success, *false* if the file could not be read, is not a valid
+         *         snapshot (or of an unsupported version), or does not fit the object capacity
+         * \note   On failure, the current objects and view properties are kept.
+         * \note   All handles issued before a successful call become stale; obtain new handles
+         *         via ObjectRadar::getHandle().
+         * \note   The snapshot is applied in a transaction, i.e., the changes are reported by a
+         *         single *changesCommitted()*.
+         * \see    ObjectRadar::saveSnapshot()
+         */
+        bool loadSnapshot(QString const &path) noexcept;
+        /**
+         * \brief  replaces all objects and view properties with those stored in a snapshot
+         * \param  [in] data pointer to the snapshot (e.g., a resource or a mapped file)
+         * \param  [in] size size of the snapshot, in bytes
+         * \return *true* on success, *false* on failure
+         * \note   The snapshot is used in-place if **data** is aligned to eight bytes, otherwise
+         *         it's copied first.
+         * \see    ObjectRadar::loadSnapshot(QString)
+         */
+        bool loadSnapshot(void const *data, size_t size) noexcept;
         /**
          * \brief  checks whether an object with a given identifier exists
          * \param  [in] ident identifier of the object that is to be searched
@@ -169,6 +594,20 @@ namespace tfd {
          * \note   This function looks for exact matches for the object identifier.
          */
         bool hasObject(QString const &ident) const noexcept;
+        /**
+         * \brief  checks whether the object referred to by a handle (still) exists
+         * \param  [in] handle handle of the object that is to be searched
+         * \return *true* if the object exists, *false* if the handle is invalid or stale
+         */
+        bool hasObject(ObjectHandle handle) const noexcept;
+        /**
+         * \brief  retrieves the handle of an object given its identifier
+         * \param  [in] ident identifier of the object
+         * \return handle of the object, or an invalid handle if the object could not be found
+         * \note   Use this function once to translate identifiers into handles, then use the
+         *         handle-based overloads on hot paths.
+         */
+        ObjectHandle getHandle(QString const &ident) const noexcept;
         /**
          * \brief  retrieves a copy of a view property with the given *property index*
          * \param  [in] prop property index to get value for
@@ -195,6 +634,14 @@ namespace tfd {
          * \see    ObjectRadar::getProperty(ObjectRadar::Property)
          */
         QVariant getProperty(QString const &ident, ObjectRadar::Property prop) const noexcept;
+        /**
+         * \brief  retrieves a copy of an object property with the given *property index*
+         * \param  [in] handle handle of the object
+         * \param  [in] prop property index to get value for
+         * \return *QVariant* holding the property value
+         * \see    ObjectRadar::getProperty(QString, ObjectRadar::Property)
+         */
+        QVariant getProperty(ObjectHandle handle, ObjectRadar::Property prop) const noexcept;
         /**
          * \brief  updates the value of a view property identified by the given *property index*
          * \param  [in] prop property index to update the value of
@@ -222,6 +669,233 @@ namespace tfd {
          * \see    ObjectRadar::setProperty(ObjectRadar::Property, QVariant)
          */
         bool setProperty(QString const &ident, ObjectRadar::Property prop, QVariant const &val);
+        /**
+         * \brief  updates the value of an object property, taking over the value if possible
+         * \param  [in] ident identifier of the object
+         * \param  [in] prop property index to update the value of
+         * \param  [in,out] val new value for the property
+         * \return *true* if the property was updated, *false* if the update failed
+         * \see    ObjectRadar::setProperty(ObjectHandle, ObjectRadar::Property, QVariant &&)
+         */
+        bool setProperty(QString const &ident, ObjectRadar::Property prop, QVariant &&val);
+        /**
+         * \brief  updates the value of an object property identified by the given *property index*
+         * \param  [in] handle handle of the object
+         * \param  [in] prop property index to update the value of
+         * \param  [in] val new value for the property
+         * \return *true* if the property was updated, *false* if the update failed
+         * \note   Renaming an object via *Property::Identifier* does not invalidate its handle.
+         * \see    ObjectRadar::setProperty(QString, ObjectRadar::Property, QVariant)
+         */
+        bool setProperty(ObjectHandle handle, ObjectRadar::Property prop, QVariant const &val);
+        /**
+         * \brief  updates the value of an object property, taking over the value if possible
+         * 
+         * For *Property::Area* and *Property::Path*, the vertices are moved out of the variant
+         * instead of being copied, unless the variant shares its value with other variants.
+         * All other properties are updated as by the overload taking a constant reference.
+         * 
+         * \param  [in] handle handle of the object
+         * \param  [in] prop property index to update the value of
+         * \param  [in,out] val new value for the property; its shape is emptied if taken over
+         * \return *true* if the property was updated, *false* if the update failed
+         * \see    ObjectRadar::setProperty(ObjectHandle, ObjectRadar::Property, QVariant)
+         */
+        bool setProperty(ObjectHandle handle, ObjectRadar::Property prop, QVariant &&val);
+        /**
+         * \brief  replaces the outline of an object, taking over the vertices of the given area
+         * 
+         * This is equivalent to updating *Property::Area* but does not copy the vertices, which
+         * matters for areas with many vertices (e.g., airspaces or geofences loaded from files).
+         * 
+         * \param  [in] handle handle of the object
+         * \param  [in,out] area new outline; emptied unless the handle is invalid
+         * \return *true* if the outline was updated, *false* if the update failed
+         * \see    ObjectRadar::setProperty(ObjectHandle, ObjectRadar::Property, QVariant)
+         */
+        bool setArea(ObjectHandle handle, RadarArea &&area) noexcept;
+        /**
+         * \brief  replaces the course of an object, taking over the vertices of the given path
+         * \param  [in] handle handle of the object
+         * \param  [in,out] path new course; emptied unless the handle is invalid
+         * \return *true* if the course was updated, *false* if the update failed
+         * \see    ObjectRadar::setArea(ObjectHandle, RadarArea &&)
+         */
+        bool setPath(ObjectHandle handle, RadarPath &&path) noexcept;
+        /**
+         * \brief  retrieves the value of a view property, without boxing it into a *QVariant*
+         * 
+         * The value type is fixed by the property at compile time (see *ObjectRadar::PropertyTraits*),
+         * e.g., *get<Property::RadarCenter>()* returns a *QPointF*.
+         * 
+         * \tparam P view property to get the value of
+         * \return current value of the property
+         * \see    ObjectRadar::getProperty(ObjectRadar::Property)
+         */
+        template<Property P, ViewProperty<P> = 0>
+        PropertyType<P> get() const noexcept;
+        /**
+         * \brief  retrieves the value of an object property, without boxing it into a *QVariant*
+         * \tparam P object property to get the value of
+         * \param  [in] handle handle of the object
+         * \return current value of the property, or an empty optional if the handle is invalid
+         *         or stale
+         * \see    ObjectRadar::getProperty(ObjectHandle, ObjectRadar::Property)
+         */
+        template<Property P, ObjectProperty<P> = 0>
+        std::optional<PropertyType<P>> get(ObjectHandle handle) const noexcept;
+        /**
+         * \brief  updates the value of a view property, without boxing it into a *QVariant*
+         * 
+         * The value type is checked by the compiler; only the range of the value (if the property
+         * has one) is checked at run-time. Use this overload where the property is known at
+         * compile time, and the *QVariant*-based overload for dynamic callers (scripts, property
+         * editors, etc.).
+         * 
+         * \tparam P view property to update the value of
+         * \param  [in] val new value for the property
+         * \return *true* if the property was updated, *false* if the value is out of range
+         * \note   The new value is only boxed if it differs from the current value, in order
+         *         to emit *propertyValueChanged()*.
+         * \see    ObjectRadar::setProperty(ObjectRadar::Property, QVariant)
+         */
+        template<Property P, ViewProperty<P> = 0>
+        bool set(PropertyType<P> const &val) noexcept;
+        /**
+         * \brief  updates the value of an object property, without boxing it into a *QVariant*
+         * 
+         * For example, *set<Property::Position>(handle, QPointF{ 48.1, 11.5 })* moves an object
+         * without any type dispatch.
+         * 
+         * \tparam P object property to update the value of
+         * \param  [in] handle handle of the object
+         * \param  [in] val new value for the property
+         * \return *true* if the property was updated, *false* if the handle is invalid or stale,
+         *         the value is out of range, or the update failed
+         * \see    ObjectRadar::setProperty(ObjectHandle, ObjectRadar::Property, QVariant)
+         */
+        template<Property P, ObjectProperty<P> = 0>
+        bool set(ObjectHandle handle, PropertyType<P> const &val) noexcept;
+        /**
+         * \brief  applies a batch of typed object updates in a single pass
+         * 
+         * This function is intended for high-rate data sources (telemetry links, etc.) which
+         * deliver new state for many objects at once. All records are applied in order and
+         * only the parts of the widget covered by the changed objects are repainted on the
+         * next frame.
+         * 
+         * \param  [in] upd pointer to the first update record
+         * \param  [in] n number of update records
+         * \return number of records that were applied
+         * \note   Records with invalid or stale handles are skipped.
+         * \note   If a batch contains multiple records for the same object, the last record
+         *         wins for every field that it selects.
+         * \see    ObjectRadar::ObjectUpdate
+         */
+        size_t updateObjects(ObjectUpdate const *upd, size_t n) noexcept;
+        /**
+         * \brief  applies a batch of typed object updates in a single pass
+         * \param  [in] upd update records
+         * \return number of records that were applied
+         * \see    ObjectRadar::updateObjects(ObjectUpdate const *, size_t)
+         */
+        size_t updateObjects(std::vector<ObjectUpdate> const &upd) noexcept {
+            return updateObjects(upd.data(), upd.size());
+        }
+        /**
+         * \brief  opens a new channel through which another thread can feed object updates
+         * 
+         * The channel is drained on the GUI thread once per frame, right before the changed
+         * parts of the widget are determined; the drained records are applied in order as if
+         * passed to ObjectRadar::updateObjects(). The channel is closed once the producer
+         * releases its reference.
+         * 
+         * \param  [in] capacity maximum number of records queued between two frames; rounded up
+         *         to the next power of two {def: 4096}
+         * \return new channel, or *nullptr* if there was an error
+         * \note   This function must be called on the GUI thread. Obtain the handles of the
+         *         objects that are to be updated (ObjectRadar::addObject(), ObjectRadar::getHandle())
+         *         on the GUI thread, too.
+         * \see    UpdateChannel
+         */
+        std::shared_ptr<UpdateChannel> openUpdateChannel(size_t capacity = 4096) noexcept;
+        /**
+         * \brief  opens a transaction in which changes are not reported individually
+         * 
+         * Until the transaction is committed, no *propertyValueChanged()* is emitted and the
+         * internal bookkeeping that reacts to added and removed objects is deferred. The
+         * derived render resources (fonts, projection, pre-rendered layers) are rebuilt once,
+         * at commit, for all view properties that changed. Use this when making many changes
+         * at once, e.g., when loading a mission with thousands of objects.
+         * 
+         * \note   Transactions nest; only committing the outermost transaction reports the
+         *         changes.
+         * \note   The changes themselves take effect immediately (e.g., *getProperty()* returns
+         *         the new values); only the notifications are deferred. Nothing is rolled back.
+         * \note   If several object radars showing the same scene open transactions at the same
+         *         time, the added, removed and renamed objects are collected for the scene and
+         *         reported by the object radar that commits last.
+         * \see    ObjectRadar::commitTransaction(), ObjectRadar::Transaction
+         */
+        void beginTransaction() noexcept;
+        /**
+         * \brief  commits the innermost open transaction
+         * \return *true* on success, *false* if no transaction was open
+         * \note   Committing the outermost transaction emits *changesCommitted()* with all the
+         *         changes made since *beginTransaction()*, unless nothing changed.
+         */
+        bool commitTransaction() noexcept;
+        /**
+         * \brief  checks whether a transaction is open
+         * \return *true* if a transaction is open, *false* if not
+         */
+        bool isInTransaction() const noexcept;
+
+        /**
+         * \brief  starts logging every object and view update to a file
+         * 
+         * The log starts with the current scene (view properties and all objects) followed by
+         * every update from then on: objects being added, removed or renamed, property changes,
+         * typed update batches (including those drained from update channels) and changes of
+         * the view properties and the tracked object of the object radar. Each record is
+         * timestamped, and positions are delta-encoded, so that logs of high-rate telemetry stay
+         * compact.
+         * Use UpdateReplay to feed a log back into an object radar.
+         * 
+         * \param  [in] path path of the log file; an existing file is overwritten
+         * \return *true* on success, *false* if the file could not be created
+         * \note   Positions are logged with a resolution of 1e-9 degrees (about 0.1 mm).
+         * \note   If a recording is running already, it's completed first.
+         * \note   Object updates are logged whichever object radar showing the scene they are
+         *         made through (or whose update channels they are drained from); view
+         *         properties and tracked objects of other object radars are not logged.
+         * \see    ObjectRadar::stopRecording()
+         */
+        bool startRecording(QString const &path) noexcept;
+        /**
+         * \brief  completes the running recording, if any
+         * \return *true* if the log is complete, *false* if recording failed on the way (the log
+         *         then ends with the last record that could be written) or nothing was recorded
+         */
+        bool stopRecording() noexcept;
+        /**
+         * \brief  checks whether updates are currently being logged
+         * \return *true* if recording, *false* if not or if recording failed
+         */
+        bool isRecording() const noexcept;
+
+        /**
+         * \brief  finds the object closest to a given widget position
+         * 
+         * This function is intended for picking objects via mouse or touch input. The lookup
+         * is done via the spatial index of the radar and does not iterate over all objects.
+         * 
+         * \param  [in] pt widget position, in pixels
+         * \param  [in] tolerance maximum distance between **pt** and the object, in pixels {def: 8}
+         * \return handle of the closest visible object, or an invalid handle if there is no
+         *         visible object within **tolerance** pixels of **pt**
+         */
+        ObjectHandle getObjectAt(QPoint const &pt, int tolerance = 8) const noexcept;
 
         /**
          * \brief  retrieves the identifier of the object that is currently being tracked
@@ -237,9 +911,24 @@ namespace tfd {
          */
         std::optional<QString> const getTrackedObject() const noexcept;
         /**
-         * \brief 
+         * \brief  retrieves the handle of the object that is currently being tracked
+         * \return handle of the tracked object, or an invalid handle if there is no object
+         *         currently being tracked
+         * \see    ObjectRadar::getTrackedObject()
+         */
+        ObjectHandle getTrackedObjectHandle() const noexcept;
+        /**
+         * \brief updates the object that is currently being tracked
+         * \param [in] ident identifier of the object that is to be tracked
+         * \note  If the object could not be found, the function does nothing.
          */
         void setTrackedObject(QString const &ident) noexcept;
+        /**
+         * \brief updates the object that is currently being tracked
+         * \param [in] handle handle of the object that is to be tracked
+         * \note  If the handle is invalid or stale, the function does nothing.
+         */
+        void setTrackedObject(ObjectHandle handle) noexcept;
 
     protected:
         /**
@@ -251,6 +940,15 @@ namespace tfd {
          * \param [in] pe additional info for the pending paint operation
          */
         virtual void paintEvent(QPaintEvent *pe) override;
+        /**
+         * \brief reimplements the default widget resize event
+         * 
+         * All cached resources (pre-rendered layers, projection terms) depend on the widget
+         * size and are rebuilt here.
+         * 
+         * \param [in] re additional info for the resize operation
+         */
+        virtual void resizeEvent(QResizeEvent *re) override;
 
     signals:
         /**
@@ -259,63 +957,338 @@ namespace tfd {
          * \param [in] new value of the property
          */
         void propertyValueChanged(ObjectRadar::Property prop, QVariant const &val);
+        /**
+         * \brief emitted *StatisticsRate* times per second with the statistics of the last
+         *        completed frame
+         * \param [in] stats frame statistics
+         * \note  Never emitted if the module was built without *TFD_INSTRUMENTATION*.
+         */
+        void frameStatisticsUpdated(tfd::ObjectRadar::FrameStatistics const &stats);
+        /**
+         * \brief emitted once the outermost transaction was committed
+         * \param [in] changes changes made during the transaction
+         * \note  Not emitted if nothing changed.
+         * \see   ObjectRadar::beginTransaction()
+         */
+        void changesCommitted(tfd::ObjectRadar::ChangeSet const &changes);
 
     private:
         std::unique_ptr<ObjectRadarPrivate> m_data; /**< pointer to internal data */
     };
+    Q_DECLARE_METATYPE(ObjectRadar::FrameStatistics);
+    Q_DECLARE_METATYPE(ObjectRadar::ChangeSet);
+
+    /* property value types; must match the types the property values are type-checked against */
+    #define TFD_PROPERTY_TYPE(prop, type) \
+        template<> struct ObjectRadar::PropertyTraits<ObjectRadar::Property::prop> { using Type = type; }
+    TFD_PROPERTY_TYPE(UpdateRate,        float);
+    TFD_PROPERTY_TYPE(StaticTextFont,    FontProperties);
+    TFD_PROPERTY_TYPE(LabelFont,         FontProperties);
+    TFD_PROPERTY_TYPE(ObjectLabelFont,   FontProperties);
+    TFD_PROPERTY_TYPE(ForegroundColor,   QColor);
+    TFD_PROPERTY_TYPE(BackgroundColor,   QColor);
+    TFD_PROPERTY_TYPE(RadarCenter,       QPointF);
+    TFD_PROPERTY_TYPE(RadarAltitude,     float);
+    TFD_PROPERTY_TYPE(RadarRange,        QSizeF);
+    TFD_PROPERTY_TYPE(AreaOpacity,       int);
+    TFD_PROPERTY_TYPE(OutlineStrength,   int);
+    TFD_PROPERTY_TYPE(OutlineStyle,      Qt::PenStyle);
+    TFD_PROPERTY_TYPE(RedrawMode,        ObjectRadar::RedrawMode);
+    TFD_PROPERTY_TYPE(PredictionHorizon, float);
+    TFD_PROPERTY_TYPE(ClusterCellSize,   int);
+    TFD_PROPERTY_TYPE(StatisticsRate,    float);
+    TFD_PROPERTY_TYPE(StatisticsOverlay, bool);
+    TFD_PROPERTY_TYPE(LabelVisibility,   bool);
+    TFD_PROPERTY_TYPE(Identifier,        QString);
+    TFD_PROPERTY_TYPE(Type,              ObjectRadar::ObjectType);
+    TFD_PROPERTY_TYPE(Position,          QPointF);
+    TFD_PROPERTY_TYPE(Color,             QColor);
+    TFD_PROPERTY_TYPE(Area,              RadarArea);
+    TFD_PROPERTY_TYPE(Altitude,          float);
+    TFD_PROPERTY_TYPE(Visibility,        bool);
+    TFD_PROPERTY_TYPE(Path,              RadarPath);
+    TFD_PROPERTY_TYPE(GroundSpeed,       float);
+    TFD_PROPERTY_TYPE(Heading,           float);
+    #undef TFD_PROPERTY_TYPE
 
 
     /**
-     * \class RadarArea 
-     * \brief represents an area for the radar view
+     * \class RadarScene
+     * \brief set of radar objects that can be shown by several object radars at once
      * 
-     * RadarAreas are used to describe areas of almost any appearance as static objects in the
-     * radar view. They are closed by default (i.e., last vertex is connected to first vertex)
-     * and are outlined and filled with the color specified by their radar object proxy. While
-     * thee outline is displayed at full strength, the fill color may have an opacity effect that
-     * can be controlled by setting the *AreaOpacity* property.
+     * A scene holds everything about the radar objects that does not depend on how they are
+     * viewed: the object store (including its spatial index) and the pre-rasterized object
+     * icons. Object radars created on the same scene show the same objects, each with its own
+     * view properties, tracked object, pre-rendered layers and per-frame caches. Updates made
+     * through any of them, including those drained from update channels, are applied to the
+     * scene once and show up in all of them; every object radar only repaints what changed
+     * since its own last frame.
      * 
-     * \note  For the area to be displayed, the area needs to be comprised of at least three
-     *        vertices.
+     * Scenes are reference-counted: every object radar holds a reference to the scene it
+     * shows, so the scene lives as long as the last object radar showing it (or any other
+     * reference).
+     * 
+     * \note  All object radars showing a scene must live on the same thread.
+     * \note  Object handles are issued by the scene, i.e., a handle obtained from one object
+     *        radar refers to the same object on all object radars showing the scene.
+     * \note  Whatever replaces or clears all objects (e.g., ObjectRadar::loadSnapshot() or
+     *        ObjectRadar::removeAllObjects()) does so for all object radars showing the scene;
+     *        only the view properties of the object radar it's called on are changed.
      */
-    class RadarArea {
+    class TFD_API RadarScene {
         friend class ObjectRadar;
+        friend class ObjectRadarPrivate;
+        friend class tests::ObjectRadarTests;
 
     public:
-        RadarArea()                      = default;
-        RadarArea(RadarArea const &area) = default;
-        ~RadarArea()                     = default;
         /**
-         * \brief constructs a new area with a predefined list of vertices
-         * \param [in] v list of vertices in order
-         * \note  Parameter *v* can be empty.
+         * \brief create a new, empty scene
          */
-        explicit  RadarArea(std::initializer_list<QPointF> v, bool smooth = false)
-            : m_vertices(v), m_isSmooth(smooth)
-        { }
+        RadarScene();
+        RadarScene(RadarScene const &)            = delete;
+        RadarScene &operator=(RadarScene const &) = delete;
+        ~RadarScene();
+
+        /**
+         * \brief  retrieves the number of object radars showing the scene
+         * \return number of object radars
+         */
+        size_t getViewCount() const noexcept;
+
+    private:
+        std::unique_ptr<RadarScenePrivate> m_data; /**< pointer to internal data */
+    };
+
+
+    /**
+     * \class UpdateChannel
+     * \brief lock-free queue through which a single producer thread feeds object updates
+     * 
+     * Update channels are single-producer/single-consumer ring buffers. The producer (e.g., a
+     * telemetry decoder running on a worker thread) pushes update records; the object radar
+     * drains them on the GUI thread once per frame. Neither side ever waits for the other: if
+     * the buffer is full, records are rejected (and counted) instead.
+     * 
+     * \note  Each channel supports exactly one producer thread. Open one channel per thread.
+     * \see   ObjectRadar::openUpdateChannel()
+     */
+    class TFD_API UpdateChannel {
+        friend class ObjectRadar;
+        friend class ObjectRadarPrivate;
+
+    public:
+        UpdateChannel(UpdateChannel const &)            = delete;
+        UpdateChannel &operator=(UpdateChannel const &) = delete;
+        ~UpdateChannel();
 
         /**
-         * \brief  adds a vertex to the area
+         * \brief  queues an update record
+         * \param  [in] upd update record
+         * \return *true* if the record was queued, *false* if the channel is full or closed
+         */
+        bool push(ObjectRadar::ObjectUpdate const &upd) noexcept;
+        /**
+         * \brief  queues a batch of update records
+         * \param  [in] upd pointer to the first update record
+         * \param  [in] n number of update records
+         * \return number of records that were queued; records that do not fit are rejected
+         */
+        size_t push(ObjectRadar::ObjectUpdate const *upd, size_t n) noexcept;
+        /**
+         * \brief  retrieves the number of records the channel can hold
+         * \return capacity of the channel
+         */
+        size_t capacity() const noexcept;
+        /**
+         * \brief  retrieves the number of records rejected so far because the channel was full
+         * \return number of rejected records
+         */
+        quint64 dropped() const noexcept;
+        /**
+         * \brief  checks whether the channel is still attached to its object radar
+         * \return *true* if records are still drained, *false* if the object radar was destroyed
+         */
+        bool isOpen() const noexcept;
+
+    private:
+        /**
+         * \brief constructs a new channel
+         * \param [in] capacity capacity of the channel; a power of two
+         */
+        explicit UpdateChannel(size_t capacity);
+
+        std::unique_ptr<UpdateChannelPrivate> m_data; /**< pointer to internal data */
+    };
+
+
+    /**
+     * \class UpdateReplay
+     * \brief feeds an update log back into an object radar
+     * 
+     * Logs recorded with ObjectRadar::startRecording() are replayed through the public API of
+     * the object radar, i.e., along the same paths the original updates took. Logged objects
+     * are referred to by log-internal indices rather than by handle, so the replay does not
+     * depend on the handles issued while recording.
+     * 
+     * \note  Replays run on the thread of the object radar, driven by its event loop.
+     */
+    class TFD_API UpdateReplay : public QObject {
+        Q_OBJECT
+
+    public:
+        friend class tests::ObjectRadarTests;
+
+        /**
+         * \enum  Pace
+         * \brief enumeration for the speeds at which logs can be replayed
+         */
+        enum class Pace {
+            RealTime,   /**< updates are applied at the times they were recorded at */
+            /**
+             * Updates are applied as fast as possible. The event loop, and thus painting, only
+             * runs in between slices of a few milliseconds, so that the replay measures the
+             * end-to-end throughput of the object radar.
+             */
+            Unthrottled
+        };
+        Q_ENUM(tfd::UpdateReplay::Pace);
+
+        /**
+         * \brief create a new replay
+         * \param [in] radar object radar the log is replayed into
+         * \param [in] parent pointer to the parent object
+         */
+        explicit UpdateReplay(ObjectRadar *radar, QObject *parent = nullptr);
+        ~UpdateReplay();
+
+        /**
+         * \brief  reads an update log
+         * \param  [in] path path of the log file
+         * \return *true* on success, *false* if the file could not be read or is not an update log
+         *         (or of an unsupported version)
+         * \note   The whole log is read into memory so that replays do not wait for the disk.
+         * \note   This stops a running replay.
+         */
+        bool open(QString const &path) noexcept;
+        /**
+         * \brief  (re-)starts replaying the log from the beginning
+         * 
+         * All objects of the object radar are removed first; the log itself starts with the
+         * scene at the time the recording was started.
+         * 
+         * \param  [in] pace replay speed {def: Pace::RealTime}
+         * \return *true* on success, *false* if no log was opened or the object radar was
+         *         destroyed
+         */
+        bool start(Pace pace = Pace::RealTime) noexcept;
+        /**
+         * \brief stops the running replay, if any; *finished()* is not emitted
+         */
+        void stop() noexcept;
+        /**
+         * \brief  checks whether a replay is running
+         * \return *true* if running, *false* if not
+         */
+        bool isRunning() const noexcept;
+        /**
+         * \brief  retrieves the number of updates replayed so far
+         * \return number of updates; every update of a typed update batch counts individually
+         */
+        quint64 getReplayedUpdates() const noexcept;
+        /**
+         * \brief  retrieves the time the replay has been running for
+         * \return time since *start()*, or of the completed replay, in seconds
+         */
+        double getElapsedTime() const noexcept;
+
+    signals:
+        /**
+         * \brief emitted once the whole log was replayed
+         * \param [in] nupd number of updates that were replayed
+         * \param [in] secs time the replay took, in seconds
+         * \note  If the log ends with an incomplete or malformed record (e.g., because the
+         *        recording application crashed), the replay finishes at that record.
+         */
+        void finished(quint64 nupd, double secs);
+
+    private:
+        std::unique_ptr<UpdateReplayPrivate> m_data; /**< pointer to internal data */
+    };
+
+
+    /**
+     * \class RadarShape
+     * \brief vertices and *smooth* flag shared by RadarArea and RadarPath
+     * 
+     * Not used on its own; areas and paths only differ in how they are displayed.
+     */
+    class RadarShape {
+        friend class ObjectRadar;
+
+    public:
+        /**
+         * \brief  adds a vertex to the end of the shape
          * \param  [in] vertex vertex that is to be added, in [lat, long] coordinates
          * \return *true* if the vertex could be added, *false* if there was an error
          */
         bool addVertex(QPointF const &vertex) noexcept;
         /**
-         * \brief  removes the vertex at the given index from the area
+         * \brief  removes the vertex at the given index from the shape
          * \param  [in] index of the vertex that is to be removed
          * \return *true* if the vertex was removed, or *false* if there was an error
          * \note   Indicies are in range [0, n - 1], where *n* is the current number of
-         *         vertices in the area.
+         *         vertices in the shape.
          * \note   If the index is out of range, the function does nothing.
          */
         bool removeVertex(int index) noexcept;
         /**
-         * \brief removes all vertices from the area
+         * \brief  inserts a range of vertices into the shape
+         * \param  [in] index index the first vertex is inserted at; existing vertices from this
+         *         index on are moved back (pass the number of vertices to append)
+         * \param  [in] v pointer to the first vertex, in [lat, long] coordinates
+         * \param  [in] n number of vertices
+         * \return *true* if the vertices were inserted, *false* if the index is out of range or
+         *         there was an error
+         * \note   The shape grows at most once per call.
+         */
+        bool insertVertices(int index, QPointF const *v, size_t n) noexcept;
+        /**
+         * \brief  removes a range of vertices from the shape
+         * \param  [in] index index of the first vertex that is to be removed
+         * \param  [in] count number of vertices that are to be removed
+         * \return *true* if the vertices were removed, *false* if the range is out of bounds
+         */
+        bool removeVertices(int index, int count) noexcept;
+        /**
+         * \brief  replaces the vertex at the given index
+         * \param  [in] index index of the vertex that is to be replaced
+         * \param  [in] vertex new vertex, in [lat, long] coordinates
+         * \return *true* if the vertex was replaced, *false* if the index is out of range
+         */
+        bool setVertex(int index, QPointF const &vertex) noexcept;
+        /**
+         * \brief  reserves storage for the given number of vertices
+         * \param  [in] n number of vertices
+         * \return *true* if the storage could be reserved, *false* if there was an error
+         */
+        bool reserve(size_t n) noexcept;
+        /**
+         * \brief removes all vertices from the shape
          */
         void clearVertices() noexcept;
+        /**
+         * \brief  retrieves the vertices of the shape
+         * \return vertices in order, in [lat, long] coordinates
+         */
+        std::vector<QPointF> const &vertices() const noexcept { return m_vertices; }
+        /**
+         * \brief  moves the vertices out of the shape, leaving it empty
+         * \return vertices in order, in [lat, long] coordinates
+         */
+        std::vector<QPointF> takeVertices() noexcept { return std::exchange(m_vertices, {}); }
 
         /**
-         * \brief  retrieves the value of the *smooth* flag for the current RadarArea
+         * \brief  retrieves the value of the *smooth* flag for the current shape
          * 
          * The value of the *smooth* flag determines in what way vertices of paths and outlines are
          * joined. If the value of the *smooth* flag is *true*, cubic bezier curves are used while
@@ -325,24 +1298,116 @@ namespace tfd {
          */
         bool isSmooth() const noexcept { return m_isSmooth; }
         /**
-         * \brief updates the value of the *smooth* flag for the current RadarArea
+         * \brief updates the value of the *smooth* flag for the current shape
          * \param [in] smooth the new value for the *smooth* flag
          */
         void setSmooth(bool smooth) { m_isSmooth = smooth; }
 
+    protected:
+        RadarShape()                                  = default;
+        RadarShape(RadarShape const &shape)           = default;
+        RadarShape(RadarShape &&shape) noexcept       = default;
+        ~RadarShape()                                 = default;
+
+        RadarShape &operator=(RadarShape const &shape)     = default;
+        RadarShape &operator=(RadarShape &&shape) noexcept = default;
+
+        /**
+         * \brief constructs a new shape, taking over the given vertices
+         * \param [in] v vertices in order
+         * \param [in] smooth whether or not to join vertices with bezier curves
+         */
+        RadarShape(std::vector<QPointF> &&v, bool smooth) noexcept
+            : m_vertices(std::move(v)), m_isSmooth(smooth)
+        { }
+
     private:
-        bool                 m_isSmooth = false; /**< whether or not to use bezier curves for the outline */
         std::vector<QPointF> m_vertices;         /**< vertices in order */
+        bool                 m_isSmooth = false; /**< whether or not to use bezier curves for the outline or course */
+    };
+
+
+    /**
+     * \class RadarArea 
+     * \brief represents an area for the radar view
+     * 
+     * RadarAreas are used to describe areas of almost any appearance as static objects in the
+     * radar view. They are closed by default (i.e., last vertex is connected to first vertex)
+     * and are outlined and filled with the color specified by their radar object proxy. While
+     * thee outline is displayed at full strength, the fill color may have an opacity effect that
+     * can be controlled by setting the *AreaOpacity* property.
+     * 
+     * \note  For the area to be displayed, the area needs to be comprised of at least three
+     *        vertices.
+     */
+    class RadarArea : public RadarShape {
+    public:
+        RadarArea()                               = default;
+        RadarArea(RadarArea const &area)          = default;
+        RadarArea(RadarArea &&area) noexcept      = default;
+        ~RadarArea()                              = default;
+
+        RadarArea &operator=(RadarArea const &area)     = default;
+        RadarArea &operator=(RadarArea &&area) noexcept = default;
+
+        /**
+         * \brief constructs a new area with a predefined list of vertices
+         * \param [in] v list of vertices in order
+         * \note  Parameter *v* can be empty.
+         */
+        explicit  RadarArea(std::initializer_list<QPointF> v, bool smooth = false)
+            : RadarShape(std::vector<QPointF>(v), smooth)
+        { }
+        /**
+         * \brief constructs a new area, taking over the given vertices
+         * \param [in] v vertices in order; moved into the area without copying
+         * \param [in] smooth whether or not to join vertices with bezier curves {def: false}
+         */
+        explicit  RadarArea(std::vector<QPointF> &&v, bool smooth = false) noexcept
+            : RadarShape(std::move(v), smooth)
+        { }
     };
     Q_DECLARE_METATYPE(RadarArea);
 
 
     /**
      * \class RadarPath
-     * \brief 
+     * \brief represents a path (e.g., a planned route or a track) for the radar view
+     * 
+     * In contrast to RadarArea, paths are open (i.e., the last vertex is not connected to the
+     * first vertex) and never filled. They are drawn with the color specified by their radar
+     * object proxy, using the *OutlineStrength* and *OutlineStyle* properties.
+     * 
+     * \note  For the path to be displayed, the path needs to be comprised of at least two
+     *        vertices.
      */
-    class RadarPath {
+    class RadarPath : public RadarShape {
+    public:
+        RadarPath()                               = default;
+        RadarPath(RadarPath const &path)          = default;
+        RadarPath(RadarPath &&path) noexcept      = default;
+        ~RadarPath()                              = default;
+
+        RadarPath &operator=(RadarPath const &path)     = default;
+        RadarPath &operator=(RadarPath &&path) noexcept = default;
 
+        /**
+         * \brief constructs a new path with a predefined list of vertices
+         * \param [in] v list of vertices in order
+         * \param [in] smooth whether or not to join vertices with bezier curves {def: false}
+         * \note  Parameter *v* can be empty.
+         */
+        explicit  RadarPath(std::initializer_list<QPointF> v, bool smooth = false)
+            : RadarShape(std::vector<QPointF>(v), smooth)
+        { }
+        /**
+         * \brief constructs a new path, taking over the given vertices
+         * \param [in] v vertices in order; moved into the path without copying
+         * \param [in] smooth whether or not to join vertices with bezier curves {def: false}
+         */
+        explicit  RadarPath(std::vector<QPointF> &&v, bool smooth = false) noexcept
+            : RadarShape(std::move(v), smooth)
+        { }
     };
     Q_DECLARE_METATYPE(RadarPath);
 
@@ -354,6 +1419,18 @@ namespace tfd {
      *         the application is started with the '--run-tests' command-line option
      */
     TFD_EXTERN TFD_API int RunObjectRadarTests();
+    /**
+     * \brief  runs object radar benchmarks
+     *
+     * Renders synthetic scenes (objects, areas of varying complexity, labels on and off)
+     * offscreen and measures frame times and update-ingest throughput. The working set of the
+     * process and its peak are reported after each benchmark.
+     *
+     * \return *0* if all benchmarks ran, or non-zero if at least one of them failed
+     * \note   This function will be called before the main window is shown, but only if
+     *         the application is started with the '--run-benchmarks' command-line option
+     */
+    TFD_EXTERN TFD_API int RunObjectRadarBenchmarks();
 }
 
 
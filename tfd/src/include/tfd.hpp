@@ -83,6 +83,12 @@ namespace tfd {
             : m_family(fam), m_pointSize(pt), m_weight(weight), m_isItalic(italic)
         { }
 
+        bool operator ==(FontProperties const &other) const noexcept {
+            return m_family == other.m_family && m_pointSize == other.m_pointSize
+                && m_weight == other.m_weight && m_isItalic == other.m_isItalic;
+        }
+        bool operator !=(FontProperties const &other) const noexcept { return !operator ==(other); }
+
         QString m_family    = ":/fonts/B612_Mono.ttf"; /**< name of font family */
         int     m_pointSize = -1;                      /**< font size, in pt */
         int     m_weight    = -1;                      /**< font weight (regular, bold, heavy, black, ...) */
@@ -102,6 +108,7 @@ namespace tfd {
      */
     constexpr inline QMetaType::Type gl_FPType = static_cast<QMetaType::Type>(QMetaType::Type::User + 1);
     constexpr inline QMetaType::Type gl_PAType = static_cast<QMetaType::Type>(QMetaType::Type::User + 2);
+    constexpr inline QMetaType::Type gl_PPType = static_cast<QMetaType::Type>(QMetaType::Type::User + 3);
 }
 
 
@@ -37,18 +37,86 @@
 
 /* stdlib includes */
 #include <optional>
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+/* SIMD intrinsics */
+#if (defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2))
+    #include <immintrin.h>
+
+    #define TFD_SIMD_SSE2
+    #if (defined __AVX__)
+        #define TFD_SIMD_AVX
+    #endif
+#elif (defined __aarch64__ || defined _M_ARM64)
+    #include <arm_neon.h>
+
+    #define TFD_SIMD_NEON
+#endif
 
 /* Qt includes */
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFont>
+#include <QFontDatabase>
+#include <QFontMetricsF>
+#include <QOpenGLBuffer>
+#include <QOpenGLContext>
+#include <QOpenGLExtraFunctions>
+#include <QOpenGLShaderProgram>
+#include <QOpenGLTexture>
+#include <QOpenGLVertexArrayObject>
+#include <QOpenGLWidget>
 #include <QPaintEvent>
+#include <QPixmap>
+#include <QPainterPath>
+#include <QPointer>
+#include <QPolygonF>
+#include <QResizeEvent>
+#include <QSaveFile>
+#include <QStaticText>
+#include <QSurfaceFormat>
 #include <QTimer>
 #include <QTimerEvent>
 #include <QPainter>
+#include <QTemporaryDir>
 #include <QTest>
+#include <QtAlgorithms>
 
 /* tfd includes */
 #include <tfd/src/include/radar.hpp>
+#include <tfd/src/radar_p.hpp>
+
+/* frame instrumentation; always on in debug builds, opt-in for release builds */
+#if (!defined TFD_INSTRUMENTATION && defined _DEBUG)
+    #define TFD_INSTRUMENTATION
+#endif
+#if (defined TFD_INSTRUMENTATION)
+    #define TFD_CONCAT_(a, b) a##b
+    #define TFD_CONCAT(a, b)  TFD_CONCAT_(a, b)
+
+    /* Times the rest of the enclosing scope as a stage of the current frame of **data**. */
+    #define TFD_PROFILE_STAGE(data, stage) \
+        priv::StageTimer const TFD_CONCAT(int_stageTimer, __LINE__){ (data).m_profiler.m_current, ObjectRadar::FrameStatistics::stage }
+#else
+    #define TFD_PROFILE_STAGE(data, stage) ((void)0)
+#endif
 
 
 namespace tfd {
@@ -86,6 +154,8 @@ namespace tfd {
         static constexpr float gl_LType   = static_cast<float>(ObjectRadar::ObjectType::__N__ - 1); /**< highest type index */
         static constexpr float gl_FPStyle = static_cast<float>(Qt::NoPen);                          /**< first valid outline style */
         static constexpr float gl_LPStyle = static_cast<float>(Qt::DashDotDotLine);                 /**< last valid outline style */
+        static constexpr float gl_FRMode  = static_cast<float>(ObjectRadar::RedrawMode::FixedRate); /**< first valid redraw mode */
+        static constexpr float gl_LRMode  = static_cast<float>(ObjectRadar::RedrawMode::__N__) - 1; /**< last valid redraw mode */
 
         /**
          * \struct __PropertyInfoEntry__
@@ -125,8 +195,26 @@ namespace tfd {
             PII{ ObjectRadar::Property::Color,           QMetaType::QColor                                    },
             PII{ ObjectRadar::Property::Area,            gl_PAType                                            },
             PII{ ObjectRadar::Property::Altitude,        QMetaType::Float                                     },
-            PII{ ObjectRadar::Property::Visibility,      QMetaType::Bool                                      }
+            PII{ ObjectRadar::Property::Visibility,      QMetaType::Bool                                      },
+
+            /* properties added later (view and object properties) */
+            PII{ ObjectRadar::Property::RedrawMode,      QMetaType::Int,     QSizeF{ gl_FRMode, gl_LRMode }   },
+            PII{ ObjectRadar::Property::Path,            gl_PPType                                            },
+            PII{ ObjectRadar::Property::PredictionHorizon, QMetaType::Float, QSizeF{ 0.f, 60.f }              },
+            PII{ ObjectRadar::Property::GroundSpeed,     QMetaType::Float                                     },
+            PII{ ObjectRadar::Property::Heading,         QMetaType::Float,   QSizeF{ 0.f, 360.f }             },
+            PII{ ObjectRadar::Property::ClusterCellSize, QMetaType::Int,     QSizeF{ 0.f, 200.f }             },
+            PII{ ObjectRadar::Property::StatisticsRate,  QMetaType::Float,   QSizeF{ 0.f, 60.f }              },
+            PII{ ObjectRadar::Property::StatisticsOverlay, QMetaType::Bool                                    },
+            PII{ ObjectRadar::Property::LabelVisibility, QMetaType::Bool                                      }
         };
+        static_assert(gl_PropertyTypeLUT.size() == static_cast<size_t>(ObjectRadar::Property::__N__), "every property needs an entry in the property type LUT");
+        /* Property values are part of the ABI and of the update log format; they must never change. */
+        static_assert(static_cast<int>(ObjectRadar::Property::UpdateRate) == 0 && static_cast<int>(ObjectRadar::Property::OutlineStyle) == 11
+            && static_cast<int>(ObjectRadar::Property::Identifier) == 12 && static_cast<int>(ObjectRadar::Property::Visibility) == 18
+            && static_cast<int>(ObjectRadar::Property::RedrawMode) == 19 && static_cast<int>(ObjectRadar::Property::Path) == 20
+            && static_cast<int>(ObjectRadar::Property::Heading) == 23 && static_cast<int>(ObjectRadar::Property::LabelVisibility) == 27
+            && static_cast<int>(ObjectRadar::Property::__N__) == 28, "property values must not be renumbered; append new properties instead");
 
         /**
          * \brief  checks whether a property index is in range of the property info map
@@ -141,6 +229,39 @@ namespace tfd {
             return true;
         }
 
+        /**
+         * \brief  maps the static type IDs used in the property type LUT to run-time type IDs
+         * 
+         * The IDs of custom types (*gl_FPType*, *gl_PAType*) are fixed placeholders whereas Qt
+         * assigns the actual type IDs of custom types at run-time, on first use.
+         * 
+         * \param  [in] type type ID as stored in the property type LUT
+         * \return type ID as reported by *QVariant::typeId()*
+         */
+        static int int_resolveTypeId(QMetaType::Type type) noexcept {
+            switch (type) {
+                case gl_FPType: return QMetaType::fromType<FontProperties>().id();
+                case gl_PAType: return QMetaType::fromType<RadarArea>().id();
+                case gl_PPType: return QMetaType::fromType<RadarPath>().id();
+            }
+
+            return type;
+        }
+        /**
+         * \brief  assigns a new value to a property field if it differs from the current value
+         * \param  [out] dst property field
+         * \param  [in] src new value
+         * \return *true* if the value changed, *false* if it was equal
+         */
+        template<class T>
+        static bool int_assignIfChanged(T &dst, T const &src) {
+            if (dst == src)
+                return false;
+
+            dst = src;
+            return true;
+        }
+
         /**
          * \brief  carry out basic and advanced type checking for property values based on intended
          *         property type
@@ -160,7 +281,7 @@ namespace tfd {
             /* Retrieve property type entry from index. */
             auto const entry = gl_PropertyTypeLUT[static_cast<size_t>(prop)];
             /* Check type. */
-            if (val.typeId() ^ entry.m_type)
+            if (val.typeId() ^ int_resolveTypeId(entry.m_type))
                 return false;
 
             /* If range is set, validate value range, too. */
@@ -175,454 +296,7791 @@ namespace tfd {
 
             return true;
         }
-    }
-
 
-    /* radar object manager */
-    namespace priv {
         /**
-         * \class RadarObject
-         * \brief represents an object of a specific type, visible on the radar screen
+         * \brief  maps a value type of the typed property accessors to the type ID used in the
+         *         property type LUT
+         * \tparam T value type
+         * \return type ID, or *QMetaType::UnknownType* if **T** is no property value type
+         * \note   Enumerations are boxed as *int*.
          */
-        struct RadarObject {
-            /**
-             * \brief constructs a new radar object
-             * \param [in] type type identifier of the new object
-             * \note  All other fields of the RadarObject type are initialized
-             *        to sensible default values.
-             */
-            explicit RadarObject(ObjectRadar::ObjectType type)
-                : m_type(type), m_isVisible(true), m_altitude(0.f)
-            { }
-            /**
-             * \brief make a new radar object
-             * \param [in] type type of the new object
-             * \param [in] pos initial [lat, long] position of object
-             * \param [in] alt initial altitude in meters above sea-level
-             * \note  Radar objects are visible by default.
-             */
-            explicit RadarObject(ObjectRadar::ObjectType type, QPointF const &pos, float alt)
-                : m_type(type), m_position(pos), m_altitude(alt), m_isVisible(true)
-            { }
-
-            ObjectRadar::ObjectType m_type;      /**< object type ID */
-            QPointF                 m_position;  /**< [lat, long] position */
-            QColor                  m_color;     /**< color of indicator and identifier */
-            QSizeF                  m_area;      /**< area size (only valid when m_type == Area) */
-            float                   m_altitude;  /**< altitude in meters above sea-level */
-            bool                    m_isVisible; /**< whether or not the object is visible or hidden */
-        };
-        using RO = RadarObject;
+        template<class T>
+        static constexpr QMetaType::Type int_staticTypeId() noexcept {
+            if constexpr (std::is_enum_v<T> || std::is_same_v<T, int>)
+                return QMetaType::Int;
+            else if constexpr (std::is_same_v<T, float>)
+                return QMetaType::Float;
+            else if constexpr (std::is_same_v<T, bool>)
+                return QMetaType::Bool;
+            else if constexpr (std::is_same_v<T, QString>)
+                return QMetaType::QString;
+            else if constexpr (std::is_same_v<T, QColor>)
+                return QMetaType::QColor;
+            else if constexpr (std::is_same_v<T, QPointF>)
+                return QMetaType::QPointF;
+            else if constexpr (std::is_same_v<T, QSizeF>)
+                return QMetaType::QSizeF;
+            else if constexpr (std::is_same_v<T, FontProperties>)
+                return gl_FPType;
+            else if constexpr (std::is_same_v<T, RadarArea>)
+                return gl_PAType;
+            else if constexpr (std::is_same_v<T, RadarPath>)
+                return gl_PPType;
 
+            return QMetaType::UnknownType;
+        }
         /**
-         * \class RadarObjectManager
-         * \brief manages all radar present radar objects
+         * \brief  checks whether the value types of the typed property accessors match the types
+         *         in the property type LUT
+         * \return *true* if all types match, *false* if not
          */
-        class RadarObjectManager : public QObject {
-            Q_OBJECT
-            
-        public:
-            friend class tests::ObjectRadarTests;
-
-            /**
-             * \brief  adds an object to the radar (if there is no object with the same identifier)
-             * \param  [in] ident identifier of the radar object that is to be added
-             * \param  [in] obj radar object properties
-             * \return *true* if the element could be added, *false* if not
-             * \note   This function never throws exceptions.
-             */
-            bool addObject(QString const &ident, priv::RadarObject const &obj) noexcept {
-                try {
-                    /* Check if object with the same identifier already exists. If yes, abort. */
-                    if (m_objMap.find(ident) != m_objMap.end())
-                        return false;
-
-                    /* Add object entry. */
-                    bool const res = m_objMap.insert({ ident, obj }).second;
-
-                    if (res)
-                        emit objectAdded(ident);
-                    return res;
-                } catch (...) { }
-
-                return false;
-            }
-            /**
-             * \brief  removes an object from the radar, identified by their name
-             * \param  [in] ident (unique) identifier of the object that is to be removed
-             * \return *true* if the object was removed, *false* if not
-             * \note   This function never throws exceptions.
-             */
-            bool removeObject(QString const &ident) noexcept {
-                bool const res = m_objMap.erase(ident) == 1;
+        template<size_t ...I>
+        static constexpr bool int_matchesPropertyTypeLUT(std::index_sequence<I...>) noexcept {
+            return ((gl_PropertyTypeLUT[I].m_prop == static_cast<ObjectRadar::Property>(I)
+                && gl_PropertyTypeLUT[I].m_type == int_staticTypeId<ObjectRadar::PropertyType<static_cast<ObjectRadar::Property>(I)>>()) && ...);
+        }
+        static_assert(int_matchesPropertyTypeLUT(std::make_index_sequence<gl_PropertyTypeLUT.size()>{}), "typed property accessors must use the value types of the property type LUT");
 
-                if (res)
-                    emit objectRemoved(ident);
-                return res;
-            }
-            /**
-             * \brief removes all radar objects
-             * \note  This function never throws exceptions.
-             */
-            void clearObjects() noexcept {
-                m_objMap.clear();
+        /**
+         * \brief  checks a typed property value against the range in the property type LUT
+         * 
+         * The range is looked up at compile time; properties without a range accept all values
+         * without any check.
+         * 
+         * \tparam P property index
+         * \param  [in] val value to check
+         * \return *true* if the value is in range (bounds inclusive), *false* if not
+         */
+        template<ObjectRadar::Property P, class T>
+        static constexpr bool int_isInPropertyRange(T const &val) noexcept {
+            constexpr auto range = gl_PropertyTypeLUT[static_cast<size_t>(P)].m_range;
+            if constexpr (range.has_value()) {
+                double v;
+                if constexpr (std::is_enum_v<T>)
+                    v = static_cast<double>(static_cast<std::underlying_type_t<T>>(val));
+                else
+                    v = static_cast<double>(val);
 
-                emit objectRemoved({});
+                return v >= range->width() && v <= range->height();
             }
-            /**
-             * \brief  retrieves a pointer to an object with a given name
-             * \param  [in] ident (unique) identifier of the object that is to be retrieved
-             * \return an *std::optional* with the pointer of the retrieved object if it could
-             *         be retrieved, or an empty optional if there was an error or the object
-             *         could not be retrieved
-             * \note   This function never throws exceptions.
-             */
-            std::optional<priv::RadarObject *> getObject(QString const &ident) noexcept {
-                /* Get iterator for requested object. */
-                auto it = m_objMap.find(ident);
-                /* If the object could not be retrieved, return an empty optional. */
-                if (it == m_objMap.end())
-                    return std::optional<priv::RadarObject *>{};
 
-                /* Return optional with pointer to retrieved object. */
-                return std::optional<priv::RadarObject *>(&((*it).second));
-            }
+            return true;
+        }
+        /**
+         * \brief  maps a view property to its bit in a set of view properties
+         * \param  [in] prop view property
+         * \return bit mask with only the bit of the property set
+         */
+        static constexpr quint32 int_propertyBit(ObjectRadar::Property prop) noexcept {
+            return 1u << static_cast<int>(prop);
+        }
+        static_assert(static_cast<int>(ObjectRadar::Property::__N__) <= 32, "view property sets must fit into 32 bits");
+        /**
+         * \brief  computes the set of all view properties
+         * \return bit mask with the bits of all view properties set
+         */
+        static constexpr quint32 int_allViewProperties() noexcept {
+            quint32 props = 0;
+            for (int k = 0; k < static_cast<int>(ObjectRadar::Property::__N__); k++)
+                if (ObjectRadar::isViewProperty(static_cast<ObjectRadar::Property>(k)))
+                    props |= int_propertyBit(static_cast<ObjectRadar::Property>(k));
 
-        signals:
-            /**
-             * \brief emitted when an object was successfully added
-             * \param [in] ident identifier of the object that was added
-             */
-            void objectAdded(QString const &ident);
-            /**
-             * \brief emitted when an (or all) object was successfully removed
-             * \param [in] ident identifier of removed object, or empty if all objects were removed
-             * \note  The *std::optional* parameter is empty if all objects were removed, otherwise
-             *        it holds the name of the removed object as a *QString*.
-             */
-            void objectRemoved(std::optional<QString> const &ident);
+            return props;
+        }
+        static constexpr quint32 gl_AllViewProperties = int_allViewProperties(); /**< set of all view properties */
+        static_assert(gl_AllViewProperties == (((1u << 12) - 1) | (1u << 19) | (1u << 21) | (0b1111u << 24)), "view and object properties are interleaved");
 
-        private:
-            std::unordered_map<QString, priv::RO> m_objMap; /**< radar object container */
-        };
-        using ROM = RadarObjectManager;
+        /**
+         * \brief  boxes a typed property value the way the *QVariant*-based accessors report it
+         * \param  [in] val value to box
+         * \return *QVariant* holding the value
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        template<class T>
+        static QVariant int_boxPropertyValue(T const &val) {
+            if constexpr (std::is_enum_v<T>)
+                return QVariant(static_cast<int>(val));
+            else
+                return QVariant::fromValue(val);
+        }
     }
 
 
-    /* miscellaneous internal functions used by the radar */
+    /* geodetic-to-screen projection */
     namespace priv {
+        static constexpr double gl_PI           = 3.14159265358979323846;        /**< pi */
+        static constexpr double gl_EarthRadius  = 6371008.8;                     /**< mean earth radius, in meters */
+        static constexpr double gl_MetersPerDeg = gl_EarthRadius * gl_PI / 180.; /**< meters per degree of latitude */
+        static constexpr double gl_ViewRadius   = 0.45;                          /**< radius of the radar view relative to the smaller widget dimension */
+        static constexpr double gl_MarkerRadius = 8.;                            /**< half the extent of object markers (icon and altitude indicator), in pixels */
+        static constexpr int    gl_RangeRings   = 4;                             /**< number of range rings drawn on the radar scale */
+        static constexpr int    gl_ZoomSettleMs = 150;                           /**< time without range changes after which a zoom gesture counts as settled, in milliseconds */
+
         /**
-         * \brief tries to (re-)initialize internal repaint timer
-         *
-         * When the widget is constructed, the repaint timer is initialized with the initial
-         * (default) update-rate (60hz). When the update rate is changed in response to a call
-         * to ObjectRadar::setProperty(), this function is called again on the running timer
-         * to make sure it's updated properly. Using this simplistic approach, depending on the
-         * ratio between the old and the new update rate, there might be a small lag between the
-         * last frame ratio using the old update rate and the first frame using the new update
-         * rate.
+         * \struct ProjectionParams
+         * \brief  precomputed terms of the geodetic-to-screen projection
          * 
-         * \param [in] updpersec new updates per second, in 1/f seconds
-         * \param [out] timer pointer to timer object to modify
-         * \note  If **timer** is *nullptr* or the update interval of the timer is the same as
-         *        the new update interval, the function does nothing.
+         * Positions are projected using a local equirectangular approximation around the radar
+         * center, which is accurate to well below a pixel for the ranges the radar is designed
+         * for. All terms that depend on the radar center, the radar range and the widget size
+         * (including the trigonometric ones) are computed once when one of these changes, so
+         * projecting a position boils down to one subtraction, one multiplication and one
+         * addition per coordinate.
          */
-        static void int_tryInitializeRepaintTimer(float const updpersec, QTimer *timer) noexcept {
-            /* Calculate new interval. */
-            auto const ninterval = std::chrono::duration<float, std::milli>(1000.f / updpersec).count();
-            /*
-             * If the timer object is invalid or the new interval equals to the new interval,
-             * do nothing.
-             */
-            if (timer == nullptr || timer->interval() == ninterval)
-                return;
-
-            /* Update interval and restart. */
-            timer->stop();
-            timer->setInterval(ninterval);
-            timer->start();
-        }
+        struct ProjectionParams {
+            QPointF m_center;           /**< [lat, long] of the radar center */
+            QPointF m_origin;           /**< screen position of the radar center, in pixels */
+            double  m_radius     = 0.;  /**< radius of the radar view, in pixels */
+            double  m_pxPerMeter = 0.;  /**< scale, in pixels per meter */
+            double  m_kLat       = 0.;  /**< pixels per degree of latitude (positive values point north) */
+            double  m_kLon       = 0.;  /**< pixels per degree of longitude at the latitude of the radar center */
+        };
 
         /**
-         * \brief
+         * \brief  computes projection parameters
+         * \param  [in] center [lat, long] position of the radar center
+         * \param  [in] range radar range {min, max}, in meters
+         * \param  [in] size widget size, in pixels
+         * \return projection parameters
          */
-        static bool int_drawCompass(ObjectRadarPrivate *data, QPixmap &target) noexcept {
-            // TODO: document
-            // TODO: implement
-        }
-    }
-}
-
+        static ProjectionParams int_makeProjection(QPointF const &center, QSizeF const &range, QSize const &size) noexcept {
+            ProjectionParams params;
 
-namespace tfd {
-    class tests::ObjectRadarTests;
+            params.m_center     = center;
+            params.m_origin     = QPointF{ size.width() / 2., size.height() / 2. };
+            params.m_radius     = gl_ViewRadius * std::min(size.width(), size.height());
+            params.m_pxPerMeter = range.height() > 0. ? params.m_radius / range.height() : 0.;
+            params.m_kLat       = params.m_pxPerMeter * gl_MetersPerDeg;
+            params.m_kLon       = params.m_kLat * std::cos(center.x() * gl_PI / 180.);
+            return params;
+        }
+        /**
+         * \brief  calculates the screen area covered by an object marker
+         * \param  [in] pt screen position of the object, in pixels
+         * \return bounding rectangle of the marker, including a margin for anti-aliasing
+         */
+        static QRect int_markerBounds(QPointF const &pt) noexcept {
+            double const r = gl_MarkerRadius + 0.5;
 
-    /**
-     * \class ObjectRadarPrivate
-     * \brief internal state of object radar
-     */
-    class ObjectRadarPrivate : public QObject {
-        Q_OBJECT
+            return QRectF{ pt - QPointF{ r, r }, QSizeF{ 2. * r, 2. * r } }.toAlignedRect();
+        }
 
-    public slots:
         /**
-         * \brief updates the internal cache that is used to store prepared display
-         *        resources and computed but rarely changed computation results
-         * 
-         * This function is usually not called by the user or the programmar explicitly.
-         * It's intended to be used as a slot. The function decides what resources to
-         * update based on the parameters of the signal.
-         * 
-         * \param [in] prop index of the property that was updated
-         * \param [in] val new value of the property
+         * \brief  projects a single [lat, long] position to screen coordinates
+         * \param  [in] params projection parameters
+         * \param  [in] pos position that is to be projected
+         * \return screen position, in pixels
+         * \note   This is the reference implementation of the projection. Use
+         *         *int_projectPositions()* for anything but single positions.
          */
-        void updateCache(ObjectRadar::Property prop, QVariant const &val) {
-            /* Whether or not to update (= (re-)initialize) entire cache. */
-            bool const isall = prop == static_cast<ObjectRadar::Property>(INT_MAX);
-            
-            /* Update what needs to be updated. */
-            switch (prop) {
-                // TODO: implement
-            }
+        static QPointF int_projectPosition(ProjectionParams const &params, QPointF const &pos) noexcept {
+            return QPointF{
+                params.m_origin.x() + (pos.y() - params.m_center.y()) * params.m_kLon,
+                params.m_origin.y() - (pos.x() - params.m_center.x()) * params.m_kLat
+            };
         }
         /**
+         * \brief  projects a screen position back to [lat, long]
+         * \param  [in] params projection parameters
+         * \param  [in] pt screen position, in pixels
+         * \return [lat, long] position
          */
-        void updateTrackedObject(std::optional<QString> const &ident) {
+        static QPointF int_unprojectPosition(ProjectionParams const &params, QPointF const &pt) noexcept {
+            if (params.m_kLat == 0. || params.m_kLon == 0.)
+                return params.m_center;
 
+            return QPointF{
+                params.m_center.x() - (pt.y() - params.m_origin.y()) / params.m_kLat,
+                params.m_center.y() + (pt.x() - params.m_origin.x()) / params.m_kLon
+            };
         }
 
-    private:
-        friend class ObjectRadar;
-        friend class tests::ObjectRadarTests;
-
-        /* widget view settings */
-        float     m_updateRate      = 30.f;                              /**< updates (redraws) per second */
-        QPointF   m_radarCenter     = QPointF{ 0.f, 0.f };               /**< center point of the object radar, in [lat, long] */
-        QSizeF    m_radarRange      = QSizeF{ 5.f, 35.f };               /**< range of the radar view in [min, max] meters */
-        float     m_radarAlt        = 0.f;                               /**< altitude of the radar center, in meters above sea-level */
-        FP        m_staticTextFont  = FP{ ":/fonts/B612_Mono.ttf", 10 }; /**< properties for the static font INSIDE the radar view */
-        FP        m_labelFont       = FP{ ":/fonts/B612_Mono.ttf", 11 }; /**< properties for label font OUTSIDE the radar view */
-        FP        m_objLabelFont    = FP{ ":/fonts/B612_Mono.ttf", 9 };  /**< properties of the font used for object labels INSIDE the radar view */
-        QColor    m_fgndColor       = QColor(Qt::gray);                  /**< color used for text and indicators */
-        QColor    m_bgndColor       = QColor(Qt::black);                 /**< color used for backgrounds and surface fills */
-        int       m_areaOpacity     = 0.4f * 255;                        /**< opacity used for fill colors, in range [0 ... 255] */
-        int       m_outlineStrength = 2;                                 /**< width of area and path outlines, in pixels */
-        int       m_outlineStyle    = Qt::SolidLine;                     /**< style of path and area outline, one value of the *Qt::PenStyle* enum */
-        priv::RO *m_trackedObject   = nullptr;                           /**< currently tracked radar object or *nullptr* if no object is being tracked */
+        /**
+         * \brief projects a batch of [lat, long] positions to screen coordinates
+         * 
+         * This is the innermost loop of the radar. Depending on the target, the kernel is
+         * vectorized using AVX (two positions per iteration), SSE2 or AArch64 NEON (one
+         * position per iteration). Each position is loaded as a [lat, long] pair of doubles,
+         * offset and scaled by the precomputed terms and then swapped into [x, y] order.
+         * Targets without double-precision SIMD use a scalar loop.
+         * 
+         * \param [in] params projection parameters
+         * \param [in] in pointer to the first [lat, long] position
+         * \param [out] out pointer to the first screen position (may not alias **in**)
+         * \param [in] n number of positions
+         */
+        static void int_projectPositions(ProjectionParams const &params, QPointF const *in, QPointF *out, size_t n) noexcept {
+            size_t i = 0;
 
-        /* utilities */
-        QTimer    m_redrawTimer; /**< widget redraw timer (m_updateRate hz period) */
-        priv::ROM m_objManager;  /**< radar object manager */
+#if (defined TFD_SIMD_SSE2 || defined TFD_SIMD_NEON)
+            if constexpr (sizeof(QPointF) == 2 * sizeof(double) && std::is_same_v<qreal, double>) {
+                double const *src = reinterpret_cast<double const *>(in);
+                double       *dst = reinterpret_cast<double *>(out);
 
-        /* cached resources */
-        QPixmap m_c_radarCompass;         /**< pre-rendered image of the compass */
-        QPixmap m_c_radarScale;           /**< pre-rendered image of the radar scale (circles around center, etc.) */
-        QFont   m_c_radarStaticTextFont;  /**< cached font for all static text that is WITHIN the radar view */
-        QFont   m_c_radarLabelFont;       /**< cached font used for labels OUTSIDE the radar view */
-        QFont   m_c_radarObjectLabelFont; /**< cached font used for object labels INSIDE the radar view */
-    };
+    #if (defined TFD_SIMD_SSE2)
+        #if (defined TFD_SIMD_AVX)
+                __m256d const c4 = _mm256_setr_pd(params.m_center.x(), params.m_center.y(), params.m_center.x(), params.m_center.y());
+                __m256d const k4 = _mm256_setr_pd(-params.m_kLat, params.m_kLon, -params.m_kLat, params.m_kLon);
+                __m256d const o4 = _mm256_setr_pd(params.m_origin.x(), params.m_origin.y(), params.m_origin.x(), params.m_origin.y());
+                for (; i + 2 <= n; i += 2) {
+                    __m256d const d = _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(src + 2 * i), c4), k4);
 
+                    _mm256_storeu_pd(dst + 2 * i, _mm256_add_pd(_mm256_permute_pd(d, 0b0101), o4));
+                }
+        #endif
+                __m128d const c2 = _mm_setr_pd(params.m_center.x(), params.m_center.y());
+                __m128d const k2 = _mm_setr_pd(-params.m_kLat, params.m_kLon);
+                __m128d const o2 = _mm_setr_pd(params.m_origin.x(), params.m_origin.y());
+                for (; i < n; i++) {
+                    __m128d const d = _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(src + 2 * i), c2), k2);
 
-    ObjectRadar::ObjectRadar(QSize const &dim, QWidget *parent)
-        : QWidget(parent), m_data(std::make_unique<ObjectRadarPrivate>())
-    {
-        /* Setup widget. */
-        setFixedSize(dim);
-        setCursor(Qt::CursorShape::BlankCursor);
+                    _mm_storeu_pd(dst + 2 * i, _mm_add_pd(_mm_shuffle_pd(d, d, 0b01), o2));
+                }
+    #elif (defined TFD_SIMD_NEON)
+                double const cv[] = { params.m_center.x(), params.m_center.y() };
+                double const kv[] = { -params.m_kLat, params.m_kLon };
+                double const ov[] = { params.m_origin.x(), params.m_origin.y() };
+                float64x2_t const c2 = vld1q_f64(cv);
+                float64x2_t const k2 = vld1q_f64(kv);
+                float64x2_t const o2 = vld1q_f64(ov);
+                for (; i < n; i++) {
+                    float64x2_t const d = vmulq_f64(vsubq_f64(vld1q_f64(src + 2 * i), c2), k2);
 
-        /* Initialize cached resources. */
-        m_data->updateCache(static_cast<ObjectRadar::Property>(INT_MAX), {});
-        connect(this, &ObjectRadar::propertyValueChanged, m_data.get(), &ObjectRadarPrivate::updateCache);
-        connect(&m_data->m_objManager, &priv::ROM::objectAdded, m_data.get(), &ObjectRadarPrivate::updateTrackedObject);
-        connect(&m_data->m_objManager, &priv::ROM::objectRemoved, m_data.get(), &ObjectRadarPrivate::updateTrackedObject);
+                    vst1q_f64(dst + 2 * i, vaddq_f64(vextq_f64(d, d, 1), o2));
+                }
+    #endif
+            }
+#endif
 
-        /* Setup repaint timer. */
-        connect(&m_data->m_redrawTimer, &QTimer::timeout, this, [&]() {
-            /*
-             * Issue repaint immediately. In this situation, we do not want to queue a repaint via
-             * *QWidget::update()* even though it would probably not make a big difference in practice since
-             * repaint messages are high-priority.
-             */
-            repaint();
-        });
-        m_data->m_redrawTimer.setTimerType(Qt::TimerType::PreciseTimer);
-        priv::int_tryInitializeRepaintTimer(m_data->m_updateRate, &m_data->m_redrawTimer);
-    }
+            /* Scalar fallback and remainder. */
+            for (; i < n; i++)
+                out[i] = int_projectPosition(params, in[i]);
+        }
+        /**
+         * \brief extrapolates a batch of [lat, long] positions along their velocities
+         * 
+         * Every position is advanced by its velocity times the time since its last update,
+         * capped at **horizon**. Like the projection kernel, each position is processed as a
+         * pair of doubles in one SIMD register where available.
+         * 
+         * \param [in,out] pos pointer to the first [lat, long] position; receives the extrapolated
+         *        positions
+         * \param [in] vel pointer to the first velocity, in degrees per second
+         * \param [in] fix pointer to the first time of the last position update, in seconds
+         * \param [in] now time to extrapolate to, in seconds
+         * \param [in] horizon maximum extrapolation time, in seconds
+         * \param [in] n number of positions
+         */
+        static void int_extrapolatePositions(QPointF *pos, QPointF const *vel, double const *fix, double now, double horizon, size_t n) noexcept {
+            size_t i = 0;
 
-    ObjectRadar::~ObjectRadar() {
-        m_data->m_redrawTimer.stop();
-    }
+#if (defined TFD_SIMD_SSE2 || defined TFD_SIMD_NEON)
+            if constexpr (sizeof(QPointF) == 2 * sizeof(double) && std::is_same_v<qreal, double>) {
+                double       *p = reinterpret_cast<double *>(pos);
+                double const *v = reinterpret_cast<double const *>(vel);
 
-    bool ObjectRadar::addObject(QString const &ident, ObjectRadar::ObjectType type, QPointF const &pos, float alt) {
-        if (type < static_cast<ObjectRadar::ObjectType>(0) || type >= ObjectRadar::ObjectType::__N__)
-            return false;
+    #if (defined TFD_SIMD_SSE2)
+                for (; i < n; i++) {
+                    __m128d const t = _mm_set1_pd(std::clamp(now - fix[i], 0., horizon));
 
-        return m_data->m_objManager.addObject(
-            ident,
-            priv::RadarObject{ type, pos, alt }
-        );
-    }
+                    _mm_storeu_pd(p + 2 * i, _mm_add_pd(_mm_loadu_pd(p + 2 * i), _mm_mul_pd(_mm_loadu_pd(v + 2 * i), t)));
+                }
+    #elif (defined TFD_SIMD_NEON)
+                for (; i < n; i++) {
+                    float64x2_t const t = vdupq_n_f64(std::clamp(now - fix[i], 0., horizon));
 
-    bool ObjectRadar::removeObject(QString const &ident) {
-        return m_data->m_objManager.removeObject(ident);
-    }
+                    vst1q_f64(p + 2 * i, vfmaq_f64(vld1q_f64(p + 2 * i), vld1q_f64(v + 2 * i), t));
+                }
+    #endif
+            }
+#endif
 
-    void ObjectRadar::removeAllObjects() {
-        m_data->m_objManager.clearObjects();
+            /* Scalar fallback and remainder. */
+            for (; i < n; i++)
+                pos[i] += vel[i] * std::clamp(now - fix[i], 0., horizon);
+        }
     }
 
-    bool ObjectRadar::hasObject(QString const &ident) const noexcept {
-        return m_data->m_objManager.getObject(ident).has_value();
-    }
 
-    QVariant ObjectRadar::getProperty(ObjectRadar::Property prop) const noexcept {
-        /* Check if property index exists. */
-        if (!priv::int_isValidPropertyIndex(prop))
-            return priv::gl_InvVariant;
+    /* local tangent plane */
+    namespace priv {
+        static constexpr double gl_LocalUnit = 0.01; /**< resolution of local positions, in meters */
 
-        /* Select the desired property. */
-        switch (prop) {
-            case ObjectRadar::Property::UpdateRate:      return m_data->m_updateRate;
+        /**
+         * \struct LocalPosition
+         * \brief  fixed-point position in the local tangent plane of a *LocalFrame*
+         * 
+         * At 8 bytes, a local position is half the size of a [lat, long] pair, which halves the
+         * memory traffic of the projection, while its resolution is one centimeter everywhere
+         * within some 20000 kilometers of the anchor. The members are ordered like [lat, long],
+         * so that the kernels can share the swizzling of the geodetic kernel.
+         */
+        struct LocalPosition {
+            qint32 m_north = 0; /**< offset north of the anchor, in units of *gl_LocalUnit* */
+            qint32 m_east  = 0; /**< offset east of the anchor, in units of *gl_LocalUnit* */
+        };
+        /**
+         * \struct LocalFrame
+         * \brief  local tangent plane around an anchor position
+         * 
+         * Uses the same local equirectangular approximation as the projection, so that a local
+         * position can be projected for any radar center without loss: the offsets of two local
+         * positions differ from the offsets of their [lat, long] positions by constant factors.
+         */
+        struct LocalFrame {
+            QPointF m_anchor;                                  /**< [lat, long] of the origin of the frame */
+            double  m_kNorth = gl_MetersPerDeg / gl_LocalUnit; /**< local units per degree of latitude */
+            double  m_kEast  = gl_MetersPerDeg / gl_LocalUnit; /**< local units per degree of longitude at the latitude of the anchor */
+        };
+
+        /**
+         * \brief  computes a local frame
+         * \param  [in] anchor [lat, long] of the origin of the frame
+         * \return local frame
+         */
+        static LocalFrame int_makeLocalFrame(QPointF const &anchor) noexcept {
+            LocalFrame frame;
+
+            frame.m_anchor = anchor;
+            frame.m_kEast  = frame.m_kNorth * std::max(std::cos(anchor.x() * gl_PI / 180.), 1e-6);
+            return frame;
+        }
+        /**
+         * \brief  converts a [lat, long] position to (unrounded) local coordinates
+         * \param  [in] frame local frame
+         * \param  [in] pos [lat, long] position
+         * \return [north, east] offset from the anchor, in units of *gl_LocalUnit*
+         */
+        static QPointF int_toLocal(LocalFrame const &frame, QPointF const &pos) noexcept {
+            return QPointF{ (pos.x() - frame.m_anchor.x()) * frame.m_kNorth, (pos.y() - frame.m_anchor.y()) * frame.m_kEast };
+        }
+        /**
+         * \brief  converts a [lat, long] position to a local position
+         * \param  [in] frame local frame
+         * \param  [in] pos [lat, long] position
+         * \return local position; offsets beyond the range of the fixed-point format are clamped
+         */
+        static LocalPosition int_quantize(LocalFrame const &frame, QPointF const &pos) noexcept {
+            constexpr double lo = std::numeric_limits<qint32>::min();
+            constexpr double hi = std::numeric_limits<qint32>::max();
+
+            QPointF const local = int_toLocal(frame, pos);
+            return LocalPosition{
+                static_cast<qint32>(std::clamp(std::round(local.x()), lo, hi)),
+                static_cast<qint32>(std::clamp(std::round(local.y()), lo, hi))
+            };
+        }
+        /**
+         * \brief  checks whether a [lat, long] position can be converted to a local position
+         *         without clamping
+         * \param  [in] frame local frame
+         * \param  [in] pos [lat, long] position
+         * \return *true* if both offsets are within the range of the fixed-point format
+         */
+        static bool int_isInFrame(LocalFrame const &frame, QPointF const &pos) noexcept {
+            constexpr double lim = std::numeric_limits<qint32>::max();
+
+            QPointF const local = int_toLocal(frame, pos);
+            return std::abs(local.x()) <= lim && std::abs(local.y()) <= lim;
+        }
+
+        /**
+         * \struct LocalProjection
+         * \brief  precomputed terms of the local-to-screen projection
+         * \note   For the same radar center, range and widget size, this projection is
+         *         algebraically identical to the geodetic one (see *ProjectionParams*).
+         */
+        struct LocalProjection {
+            QPointF m_center;       /**< radar center in local coordinates (unrounded) */
+            QPointF m_origin;       /**< screen position of the radar center, in pixels */
+            double  m_kNorth = 0.;  /**< pixels per local unit northwards */
+            double  m_kEast  = 0.;  /**< pixels per local unit eastwards */
+        };
+
+        /**
+         * \brief  computes local projection parameters
+         * \param  [in] params geodetic projection parameters
+         * \param  [in] frame local frame the positions are stored in
+         * \return local projection parameters
+         */
+        static LocalProjection int_makeLocalProjection(ProjectionParams const &params, LocalFrame const &frame) noexcept {
+            LocalProjection local;
+
+            local.m_center = int_toLocal(frame, params.m_center);
+            local.m_origin = params.m_origin;
+            local.m_kNorth = params.m_kLat / frame.m_kNorth;
+            local.m_kEast  = params.m_kLon / frame.m_kEast;
+            return local;
+        }
+        /**
+         * \brief projects a batch of local positions to screen coordinates
+         * 
+         * Like *int_projectPositions()*, but each position is loaded as a pair of 32-bit integers
+         * and widened to doubles in-register, so only half the bytes are streamed from memory.
+         * All arithmetic is done in double precision.
+         * 
+         * \param [in] params local projection parameters
+         * \param [in] in pointer to the first local position
+         * \param [out] out pointer to the first screen position
+         * \param [in] n number of positions
+         */
+        static void int_projectLocalPositions(LocalProjection const &params, LocalPosition const *in, QPointF *out, size_t n) noexcept {
+            size_t i = 0;
+
+#if (defined TFD_SIMD_SSE2 || defined TFD_SIMD_NEON)
+            if constexpr (sizeof(LocalPosition) == 2 * sizeof(qint32) && sizeof(QPointF) == 2 * sizeof(double) && std::is_same_v<qreal, double>) {
+                double *dst = reinterpret_cast<double *>(out);
+
+    #if (defined TFD_SIMD_SSE2)
+        #if (defined TFD_SIMD_AVX)
+                __m256d const c4 = _mm256_setr_pd(params.m_center.x(), params.m_center.y(), params.m_center.x(), params.m_center.y());
+                __m256d const k4 = _mm256_setr_pd(-params.m_kNorth, params.m_kEast, -params.m_kNorth, params.m_kEast);
+                __m256d const o4 = _mm256_setr_pd(params.m_origin.x(), params.m_origin.y(), params.m_origin.x(), params.m_origin.y());
+                for (; i + 2 <= n; i += 2) {
+                    __m256d const p = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i)));
+                    __m256d const d = _mm256_mul_pd(_mm256_sub_pd(p, c4), k4);
+
+                    _mm256_storeu_pd(dst + 2 * i, _mm256_add_pd(_mm256_permute_pd(d, 0b0101), o4));
+                }
+        #endif
+                __m128d const c2 = _mm_setr_pd(params.m_center.x(), params.m_center.y());
+                __m128d const k2 = _mm_setr_pd(-params.m_kNorth, params.m_kEast);
+                __m128d const o2 = _mm_setr_pd(params.m_origin.x(), params.m_origin.y());
+                for (; i < n; i++) {
+                    __m128d const p = _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(in + i)));
+                    __m128d const d = _mm_mul_pd(_mm_sub_pd(p, c2), k2);
+
+                    _mm_storeu_pd(dst + 2 * i, _mm_add_pd(_mm_shuffle_pd(d, d, 0b01), o2));
+                }
+    #elif (defined TFD_SIMD_NEON)
+                double const cv[] = { params.m_center.x(), params.m_center.y() };
+                double const kv[] = { -params.m_kNorth, params.m_kEast };
+                double const ov[] = { params.m_origin.x(), params.m_origin.y() };
+                float64x2_t const c2 = vld1q_f64(cv);
+                float64x2_t const k2 = vld1q_f64(kv);
+                float64x2_t const o2 = vld1q_f64(ov);
+                for (; i < n; i++) {
+                    float64x2_t const p = vcvtq_f64_s64(vmovl_s32(vld1_s32(&in[i].m_north)));
+                    float64x2_t const d = vmulq_f64(vsubq_f64(p, c2), k2);
+
+                    vst1q_f64(dst + 2 * i, vaddq_f64(vextq_f64(d, d, 1), o2));
+                }
+    #endif
+            }
+#endif
+
+            /* Scalar fallback and remainder. */
+            for (; i < n; i++)
+                out[i] = QPointF{
+                    params.m_origin.x() + (in[i].m_east - params.m_center.y()) * params.m_kEast,
+                    params.m_origin.y() - (in[i].m_north - params.m_center.x()) * params.m_kNorth
+                };
+        }
+    }
+
+
+    /* spatial index */
+    namespace priv {
+        static constexpr double gl_DefCellSize  = 5e-4; /**< default edge length of spatial index cells, in degrees */
+        static constexpr double gl_CellsPerView = 8.;   /**< desired number of cells per radar range (radius) */
+
+        /**
+         * \class SpatialGrid
+         * \brief uniform grid over [lat, long] used for range queries and hit-testing
+         * 
+         * The grid is sparse: only occupied cells are stored, keyed by their packed row and
+         * column. Each cell holds the IDs of the objects located in it. Cells that become empty
+         * are kept (with their storage) so that objects moving back and forth across a cell
+         * boundary do not allocate; they are only dropped once they outnumber the occupied cells
+         * (and *gl_MinSpareCells*). Queries visit either all cells overlapping the query box or,
+         * if that is cheaper, all occupied cells, so that the cost of a query is bounded by the
+         * smaller of the two plus the number of candidates.
+         * 
+         * \note Longitude wrap-around at the antimeridian is not handled.
+         */
+        class SpatialGrid {
+        public:
+            using Key = quint64; /**< packed cell coordinates */
+
+            /**
+             * \brief constructs an empty grid
+             * \param [in] cellSize edge length of a cell, in degrees
+             */
+            explicit SpatialGrid(double cellSize = gl_DefCellSize) noexcept
+                : m_cellSize(cellSize)
+            { }
+
+            /**
+             * \brief  retrieves the edge length of a cell
+             * \return edge length of a cell, in degrees
+             */
+            double cellSize() const noexcept { return m_cellSize; }
+            /**
+             * \brief  computes the key of the cell containing a [lat, long] position
+             * \param  [in] pos position
+             * \return cell key
+             */
+            Key keyOf(QPointF const &pos) const noexcept {
+                return int_pack(int_cellOf(pos.x()), int_cellOf(pos.y()));
+            }
+
+            /**
+             * \brief adds an ID to a cell
+             * \param [in] key key of the cell
+             * \param [in] id ID that is to be added
+             * \note  This function may throw *std::bad_alloc*.
+             */
+            void insert(Key key, quint32 id) {
+                auto const [it, isnew] = m_cells.try_emplace(key);
+                try {
+                    it->second.push_back(id);
+                } catch (...) {
+                    if (isnew)
+                        m_cells.erase(it);
+
+                    throw;
+                }
+                if (!isnew && it->second.size() == 1)
+                    m_empty--;
+            }
+            /**
+             * \brief removes an ID from a cell
+             * \param [in] key key of the cell the ID was inserted into
+             * \param [in] id ID that is to be removed
+             * \note  Empty cells are kept for reuse until there are too many of them.
+             */
+            void remove(Key key, quint32 id) noexcept {
+                auto it = m_cells.find(key);
+                if (it == m_cells.end())
+                    return;
+
+                auto &ids = it->second;
+                auto  pos = std::find(ids.begin(), ids.end(), id);
+                if (pos != ids.end()) {
+                    *pos = ids.back();
+                    ids.pop_back();
+                }
+                if (!ids.empty())
+                    return;
+
+                m_empty++;
+                if (m_empty > std::max(gl_MinSpareCells, m_cells.size() - m_empty))
+                    int_dropEmpty();
+            }
+            /**
+             * \brief removes all IDs from the grid
+             */
+            void clear() noexcept {
+                m_cells.clear();
+
+                m_empty = 0;
+            }
+
+            /**
+             * \brief invokes a callback for every ID located in a cell overlapping a box
+             * \param [in] lo [lat, long] of the lower corner of the box
+             * \param [in] hi [lat, long] of the upper corner of the box
+             * \param [in] fn callback invoked as *fn(quint32 id)*
+             * \note  The callback may be invoked for IDs slightly outside of the box; candidates
+             *        have to be checked exactly by the caller.
+             */
+            template<class Fn>
+            void forEachInBox(QPointF const &lo, QPointF const &hi, Fn &&fn) const {
+                qint64 const r0 = int_cellOf(lo.x());
+                qint64 const r1 = int_cellOf(hi.x());
+                qint64 const c0 = int_cellOf(lo.y());
+                qint64 const c1 = int_cellOf(hi.y());
+
+                /* Visit whichever is fewer: cells in the box or occupied cells. */
+                double const nbox = static_cast<double>(r1 - r0 + 1) * static_cast<double>(c1 - c0 + 1);
+                if (nbox > static_cast<double>(m_cells.size() - m_empty)) {
+                    for (auto const &[key, ids] : m_cells) {
+                        auto const [r, c] = int_unpack(key);
+                        if (r < r0 || r > r1 || c < c0 || c > c1)
+                            continue;
+
+                        for (quint32 const id : ids)
+                            fn(id);
+                    }
+
+                    return;
+                }
+
+                for (qint64 r = r0; r <= r1; r++)
+                    for (qint64 c = c0; c <= c1; c++) {
+                        auto const it = m_cells.find(int_pack(r, c));
+                        if (it == m_cells.end())
+                            continue;
+
+                        for (quint32 const id : it->second)
+                            fn(id);
+                    }
+            }
+
+        private:
+            double                                        m_cellSize; /**< edge length of a cell, in degrees */
+            std::unordered_map<Key, std::vector<quint32>> m_cells;    /**< occupied (and spare empty) cells */
+            size_t                                        m_empty = 0; /**< number of empty cells in *m_cells* */
+
+            static constexpr size_t gl_MinSpareCells = 1024; /**< number of empty cells that are always kept */
+
+            void int_dropEmpty() noexcept {
+                for (auto it = m_cells.begin(); it != m_cells.end();)
+                    it = it->second.empty() ? m_cells.erase(it) : std::next(it);
+
+                m_empty = 0;
+            }
+
+            qint64 int_cellOf(double deg) const noexcept {
+                return static_cast<qint64>(std::floor(deg / m_cellSize));
+            }
+            static Key int_pack(qint64 row, qint64 col) noexcept {
+                return (static_cast<Key>(static_cast<quint32>(row)) << 32) | static_cast<quint32>(col);
+            }
+            static std::pair<qint64, qint64> int_unpack(Key key) noexcept {
+                return { static_cast<qint32>(key >> 32), static_cast<qint32>(key & 0xFFFFFFFFu) };
+            }
+        };
+
+        /**
+         * \brief  computes the approximate distance between two [lat, long] positions
+         * \param  [in] a first position
+         * \param  [in] b second position
+         * \return squared distance, in square meters
+         * \note   Uses the same local equirectangular approximation as the projection.
+         */
+        static double int_distanceSquared(QPointF const &a, QPointF const &b) noexcept {
+            double const dn = (b.x() - a.x()) * gl_MetersPerDeg;
+            double const de = (b.y() - a.y()) * gl_MetersPerDeg * std::cos(a.x() * gl_PI / 180.);
+
+            return dn * dn + de * de;
+        }
+        /**
+         * \brief  computes the [lat, long] bounding box of a circle
+         * \param  [in] center [lat, long] center of the circle
+         * \param  [in] radius radius of the circle, in meters
+         * \return pair of lower and upper [lat, long] corners
+         */
+        static std::pair<QPointF, QPointF> int_boundingBox(QPointF const &center, double radius) noexcept {
+            double const dlat = radius / gl_MetersPerDeg;
+            double const dlon = radius / (gl_MetersPerDeg * std::max(std::cos(center.x() * gl_PI / 180.), 1e-6));
+
+            return { QPointF{ center.x() - dlat, center.y() - dlon }, QPointF{ center.x() + dlat, center.y() + dlon } };
+        }
+    }
+
+
+    /* level of detail */
+    namespace priv {
+        static constexpr size_t gl_LodMinVertices  = 64;   /**< shapes with fewer vertices are always drawn at full detail */
+        static constexpr size_t gl_LodMaxLevels    = 8;    /**< maximum number of simplified vertex sets per shape */
+        static constexpr double gl_LodTolerance    = 0.25; /**< simplification tolerance of the finest level, in meters */
+        static constexpr double gl_LodFactor       = 4.;   /**< ratio between the tolerances of consecutive levels */
+        static constexpr double gl_LodPxTolerance  = 0.5;  /**< maximum deviation from the full-detail outline on screen, in pixels */
+
+        /**
+         * \struct Lod
+         * \brief  simplified vertex set of a shape
+         */
+        struct Lod {
+            double               m_tolerance = 0.; /**< maximum deviation from the full-detail vertices, in meters */
+            std::vector<QPointF> m_vertices;       /**< subset of the full-detail vertices, in order */
+        };
+
+        /**
+         * \brief  simplifies a polyline using the Douglas-Peucker algorithm
+         * 
+         * The first and the last vertex are always kept, so closed outlines keep their closing
+         * edge. Distances are measured in a local equirectangular frame around the first vertex.
+         * 
+         * \param  [in] in vertices in order, in [lat, long] coordinates
+         * \param  [in] tolerance maximum deviation, in meters
+         * \return simplified vertices (a subset of **in**, in order)
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        static std::vector<QPointF> int_simplify(std::vector<QPointF> const &in, double tolerance) {
+            size_t const n = in.size();
+            if (n < 3)
+                return in;
+
+            /* Local metric frame; accurate enough for the extent of a single shape. */
+            double const kn = gl_MetersPerDeg;
+            double const ke = gl_MetersPerDeg * std::cos(in.front().x() * gl_PI / 180.);
+            std::vector<QPointF> pts(n);
+            for (size_t k = 0; k < n; k++)
+                pts[k] = QPointF{ (in[k].y() - in.front().y()) * ke, (in[k].x() - in.front().x()) * kn };
+
+            /* Squared distance of a point to the segment [a, b]. */
+            auto const dist2 = [](QPointF const &p, QPointF const &a, QPointF const &b) {
+                QPointF const ab = b - a;
+                double const  l2 = QPointF::dotProduct(ab, ab);
+                double const  t  = l2 > 0. ? std::clamp(QPointF::dotProduct(p - a, ab) / l2, 0., 1.) : 0.;
+                QPointF const d  = p - (a + t * ab);
+
+                return QPointF::dotProduct(d, d);
+            };
+
+            /* Iterative subdivision; the stack holds index ranges that are still to be examined. */
+            std::vector<bool>                      keep(n, false);
+            std::vector<std::pair<size_t, size_t>> stack{ { 0, n - 1 } };
+            double const                           tol2 = tolerance * tolerance;
+            keep.front() = keep.back() = true;
+            while (!stack.empty()) {
+                auto const [lo, hi] = stack.back();
+                stack.pop_back();
+
+                double dmax = 0.;
+                size_t kmax = lo;
+                for (size_t k = lo + 1; k < hi; k++) {
+                    double const d = dist2(pts[k], pts[lo], pts[hi]);
+                    if (d > dmax) {
+                        dmax = d;
+                        kmax = k;
+                    }
+                }
+                if (dmax <= tol2)
+                    continue;
+
+                keep[kmax] = true;
+                stack.emplace_back(lo, kmax);
+                stack.emplace_back(kmax, hi);
+            }
+
+            std::vector<QPointF> out;
+            for (size_t k = 0; k < n; k++)
+                if (keep[k])
+                    out.push_back(in[k]);
+            return out;
+        }
+        /**
+         * \brief  builds the simplified vertex sets of a shape
+         * 
+         * Each level is simplified from the previous one with a tolerance *gl_LodFactor* times as
+         * large, so building all levels costs little more than simplifying once. Levels that do
+         * not remove a significant share of vertices, or that would degenerate the shape, are not
+         * kept.
+         * 
+         * \param  [in] vertices full-detail vertices, in [lat, long] coordinates
+         * \return simplified vertex sets, from finest to coarsest
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        static std::vector<Lod> int_buildLods(std::vector<QPointF> const &vertices) {
+            std::vector<Lod> lods;
+            if (vertices.size() < gl_LodMinVertices)
+                return lods;
+
+            double tolerance = gl_LodTolerance;
+            for (size_t k = 0; k < gl_LodMaxLevels; k++, tolerance *= gl_LodFactor) {
+                std::vector<QPointF> const &prev = lods.empty() ? vertices : lods.back().m_vertices;
+
+                std::vector<QPointF> pts = int_simplify(prev, tolerance);
+                if (pts.size() < 3)
+                    break;
+                /* Not worth another copy; try a coarser tolerance instead. */
+                if (pts.size() * 4 > prev.size() * 3)
+                    continue;
+
+                /* Deviations add up since each level is simplified from the previous one. */
+                double const error = (lods.empty() ? 0. : lods.back().m_tolerance) + tolerance;
+                lods.push_back(Lod{ error, std::move(pts) });
+            }
+            return lods;
+        }
+    }
+
+
+    /* scene snapshots */
+    namespace priv {
+        static constexpr quint32 gl_SnapshotMagic    = 0x53444654u; /**< "TFDS" when read as little-endian bytes; also rejects snapshots of the other byte order */
+        static constexpr quint32 gl_SnapshotVersion  = 1;           /**< snapshot format version; bumped on every layout change */
+        static constexpr quint32 gl_SnapshotNoObject = std::numeric_limits<quint32>::max(); /**< object index denoting "no object" */
+
+        /*
+         * A snapshot is a single contiguous block that is used in-place, e.g., straight from a
+         * memory-mapped file:
+         * 
+         *     [ SnapshotHeader ][ SnapshotObject... ][ SnapshotLod... ][ SnapshotVertex... ][ UTF-16 string table ]
+         * 
+         * All records have a fixed size without implicit padding, and all sections are aligned
+         * to eight bytes so that records can be read without copying. Identifiers and font
+         * families are stored in the string table which is referenced by offset.
+         */
+
+        /**
+         * \struct SnapshotString
+         * \brief  reference into the string table of a snapshot
+         */
+        struct SnapshotString {
+            quint32 m_offset = 0; /**< index of the first UTF-16 code unit */
+            quint32 m_length = 0; /**< number of UTF-16 code units */
+        };
+        /**
+         * \struct SnapshotColor
+         * \brief  color as stored in a snapshot
+         */
+        struct SnapshotColor {
+            quint64 m_rgba     = 0; /**< 16 bits per channel, see *QColor::rgba64()* */
+            quint32 m_isValid  = 0; /**< whether or not the color is valid (invalid object colors fall back to the foreground color) */
+            quint32 m_reserved = 0; /**< *reserved, 0* */
+        };
+        /**
+         * \struct SnapshotFont
+         * \brief  font properties as stored in a snapshot
+         */
+        struct SnapshotFont {
+            SnapshotString m_family;        /**< font family or font file */
+            qint32         m_pointSize = 0; /**< font size, in pt */
+            qint32         m_weight    = 0; /**< font weight */
+            quint32        m_isItalic  = 0; /**< whether or not the font is cursive */
+            quint32        m_reserved  = 0; /**< *reserved, 0* */
+        };
+        /**
+         * \struct SnapshotView
+         * \brief  view properties as stored in a snapshot
+         */
+        struct SnapshotView {
+            double        m_center[2]         = {}; /**< [lat, long] radar center */
+            double        m_range[2]          = {}; /**< [min, max] radar range, in meters */
+            SnapshotColor m_fgndColor;              /**< foreground color */
+            SnapshotColor m_bgndColor;              /**< background color */
+            SnapshotFont  m_fonts[3];               /**< static text, label and object label fonts */
+            float         m_updateRate        = 0.f; /**< update rate, per second */
+            float         m_radarAlt          = 0.f; /**< altitude of the radar center, in meters above sea-level */
+            float         m_predictionHorizon = 0.f; /**< maximum extrapolation time, in seconds */
+            float         m_statisticsRate    = 0.f; /**< rate at which frame statistics are published, per second */
+            qint32        m_areaOpacity       = 0;   /**< opacity of area fills */
+            qint32        m_outlineStrength   = 0;   /**< width of outlines, in pixels */
+            qint32        m_outlineStyle      = 0;   /**< style of outlines, one value of the *Qt::PenStyle* enum */
+            qint32        m_redrawMode        = 0;   /**< frame scheduling, one value of the *ObjectRadar::RedrawMode* enum */
+            qint32        m_clusterCellSize   = 0;   /**< edge length of cluster cells, in pixels */
+            quint32       m_trackedObject     = gl_SnapshotNoObject; /**< index of the tracked object, or *gl_SnapshotNoObject* */
+            quint8        m_isStatsOverlay    = 0;   /**< whether or not frame statistics are drawn on top of the view */
+            quint8        m_isLabelVisible    = 0;   /**< whether or not objects are labeled */
+            quint8        m_reserved[6]       = {}; /**< *reserved, 0* */
+        };
+        /**
+         * \struct SnapshotHeader
+         * \brief  leading record of a snapshot
+         */
+        struct SnapshotHeader {
+            quint32      m_magic        = gl_SnapshotMagic;   /**< *gl_SnapshotMagic* */
+            quint32      m_version      = gl_SnapshotVersion; /**< *gl_SnapshotVersion* */
+            quint64      m_size         = 0; /**< size of the entire snapshot, in bytes */
+            quint64      m_objectOffset = 0; /**< byte offset of the object records */
+            quint64      m_lodOffset    = 0; /**< byte offset of the simplified vertex set records */
+            quint64      m_vertexOffset = 0; /**< byte offset of the vertices */
+            quint64      m_stringOffset = 0; /**< byte offset of the string table */
+            quint32      m_objectCount  = 0; /**< number of object records */
+            quint32      m_lodCount     = 0; /**< number of simplified vertex set records */
+            quint64      m_vertexCount  = 0; /**< number of vertices */
+            quint64      m_stringLength = 0; /**< length of the string table, in UTF-16 code units */
+            SnapshotView m_view;             /**< view properties */
+        };
+        /**
+         * \struct SnapshotObject
+         * \brief  radar object as stored in a snapshot
+         * \note   Objects are stored in dense order.
+         */
+        struct SnapshotObject {
+            double         m_position[2]   = {};  /**< [lat, long] position */
+            SnapshotColor  m_color;               /**< color of indicator and identifier */
+            SnapshotString m_ident;               /**< identifier */
+            float          m_altitude      = 0.f; /**< altitude in meters above sea-level */
+            float          m_groundSpeed   = 0.f; /**< ground speed, in meters per second */
+            float          m_heading       = 0.f; /**< track, in degrees clockwise from true north */
+            quint32        m_type          = 0;   /**< object type ID */
+            quint64        m_vertexIndex   = 0;   /**< index of the first full-detail vertex of the geometry */
+            quint32        m_vertexCount   = 0;   /**< number of full-detail vertices */
+            quint32        m_lodIndex      = 0;   /**< index of the first simplified vertex set */
+            quint32        m_lodCount      = 0;   /**< number of simplified vertex sets */
+            quint8         m_isVisible     = 0;   /**< visibility flag */
+            quint8         m_isSmooth      = 0;   /**< whether or not vertices are joined by cubic bezier curves */
+            quint8         m_reserved[2]   = {};  /**< *reserved, 0* */
+        };
+        /**
+         * \struct SnapshotLod
+         * \brief  simplified vertex set as stored in a snapshot
+         * \note   Simplified vertex sets are stored with the shape so that they don't have to be
+         *         rebuilt on load.
+         */
+        struct SnapshotLod {
+            double  m_tolerance   = 0.; /**< maximum deviation from the full-detail vertices, in meters */
+            quint64 m_vertexIndex = 0;  /**< index of the first vertex */
+            quint32 m_vertexCount = 0;  /**< number of vertices */
+            quint32 m_reserved    = 0;  /**< *reserved, 0* */
+        };
+        /**
+         * \struct SnapshotVertex
+         * \brief  vertex as stored in a snapshot
+         */
+        struct SnapshotVertex {
+            double m_lat  = 0.; /**< latitude */
+            double m_long = 0.; /**< longitude */
+        };
+        static_assert(sizeof(SnapshotView)   == 184, "snapshot records must not contain implicit padding");
+        static_assert(sizeof(SnapshotHeader) == 256, "snapshot records must not contain implicit padding");
+        static_assert(sizeof(SnapshotObject) == 80,  "snapshot records must not contain implicit padding");
+        static_assert(sizeof(SnapshotLod)    == 24,  "snapshot records must not contain implicit padding");
+        static_assert(sizeof(SnapshotVertex) == 16,  "snapshot records must not contain implicit padding");
+
+        /**
+         * \brief  rounds a byte offset up to the alignment of snapshot sections
+         * \param  [in] offset byte offset
+         * \return aligned byte offset
+         */
+        static constexpr quint64 int_alignSection(quint64 offset) noexcept {
+            return (offset + 7) & ~quint64{ 7 };
+        }
+        /**
+         * \brief  checks whether a section lies within a snapshot
+         * \param  [in] offset byte offset of the section
+         * \param  [in] count number of records in the section
+         * \param  [in] recsize size of each record, in bytes
+         * \param  [in] size size of the snapshot, in bytes
+         * \return *true* if the section is aligned and lies behind the header and within the
+         *         snapshot, *false* if not
+         */
+        static bool int_isValidSection(quint64 offset, quint64 count, quint64 recsize, quint64 size) noexcept {
+            if (offset % 8 != 0 || offset < sizeof(SnapshotHeader) || offset > size)
+                return false;
+
+            return count <= (size - offset) / recsize;
+        }
+        /**
+         * \brief  checks whether a range of records lies within a section
+         * \param  [in] first index of the first record
+         * \param  [in] count number of records
+         * \param  [in] total number of records in the section
+         * \return *true* if the range is valid, *false* if not
+         */
+        static constexpr bool int_isValidRange(quint64 first, quint64 count, quint64 total) noexcept {
+            return first <= total && count <= total - first;
+        }
+        /**
+         * \brief  encodes a color
+         * \param  [in] col color
+         * \return color as stored in a snapshot
+         */
+        static SnapshotColor int_packColor(QColor const &col) noexcept {
+            SnapshotColor res;
+            res.m_isValid = col.isValid();
+            res.m_rgba    = res.m_isValid ? static_cast<quint64>(col.rgba64()) : 0;
+            return res;
+        }
+        /**
+         * \brief  decodes a color
+         * \param  [in] col color as stored in a snapshot
+         * \return color
+         */
+        static QColor int_unpackColor(SnapshotColor const &col) noexcept {
+            return col.m_isValid != 0 ? QColor::fromRgba64(QRgba64::fromRgba64(col.m_rgba)) : QColor{};
+        }
+
+        /**
+         * \brief  validates a snapshot before it's used in-place
+         * 
+         * Besides the header, the bounds of every section and of every reference into another
+         * section (identifiers, geometries, simplified vertex sets) are checked, so that decoding
+         * the snapshot can read all records unchecked. The values of view properties are not
+         * validated here.
+         * 
+         * \param  [in] data start of the snapshot; must be aligned to eight bytes
+         * \param  [in] size size of the snapshot, in bytes
+         * \return pointer to the header, or *nullptr* if the snapshot is malformed, truncated or of
+         *         an unsupported version
+         */
+        static SnapshotHeader const *int_checkSnapshot(uchar const *data, size_t size) noexcept {
+            if (data == nullptr || size < sizeof(SnapshotHeader) || reinterpret_cast<quintptr>(data) % 8 != 0)
+                return nullptr;
+
+            auto const *hdr = reinterpret_cast<SnapshotHeader const *>(data);
+            if (hdr->m_magic != gl_SnapshotMagic || hdr->m_version != gl_SnapshotVersion || hdr->m_size != size)
+                return nullptr;
+            if (!int_isValidSection(hdr->m_objectOffset, hdr->m_objectCount, sizeof(SnapshotObject), size)
+                || !int_isValidSection(hdr->m_lodOffset, hdr->m_lodCount, sizeof(SnapshotLod), size)
+                || !int_isValidSection(hdr->m_vertexOffset, hdr->m_vertexCount, sizeof(SnapshotVertex), size)
+                || !int_isValidSection(hdr->m_stringOffset, hdr->m_stringLength, sizeof(char16_t), size)
+            ) return nullptr;
+
+            /* References into other sections. */
+            auto const isstr = [hdr](SnapshotString const &str) {
+                return int_isValidRange(str.m_offset, str.m_length, hdr->m_stringLength);
+            };
+            for (SnapshotFont const &font : hdr->m_view.m_fonts)
+                if (!isstr(font.m_family))
+                    return nullptr;
+            if (hdr->m_view.m_trackedObject != gl_SnapshotNoObject && hdr->m_view.m_trackedObject >= hdr->m_objectCount)
+                return nullptr;
+
+            auto const *objs = reinterpret_cast<SnapshotObject const *>(data + hdr->m_objectOffset);
+            for (quint32 i = 0; i < hdr->m_objectCount; i++) {
+                SnapshotObject const &obj = objs[i];
+
+                if (obj.m_type >= static_cast<quint32>(ObjectRadar::ObjectType::__N__) || !isstr(obj.m_ident))
+                    return nullptr;
+                if (!int_isValidRange(obj.m_vertexIndex, obj.m_vertexCount, hdr->m_vertexCount)
+                    || !int_isValidRange(obj.m_lodIndex, obj.m_lodCount, hdr->m_lodCount)
+                ) return nullptr;
+            }
+            auto const *lods = reinterpret_cast<SnapshotLod const *>(data + hdr->m_lodOffset);
+            for (quint32 i = 0; i < hdr->m_lodCount; i++)
+                if (!int_isValidRange(lods[i].m_vertexIndex, lods[i].m_vertexCount, hdr->m_vertexCount))
+                    return nullptr;
+
+            return hdr;
+        }
+    }
+
+
+    /* radar object manager */
+    namespace priv {
+        /**
+         * \struct Shape
+         * \brief  geometry of area and path objects
+         * \note   Whether the shape is closed (area) or open (path) is determined by the type of
+         *         the object it belongs to.
+         */
+        struct Shape {
+            std::vector<QPointF>       m_vertices;         /**< vertices in order, in [lat, long] coordinates */
+            bool                       m_isSmooth = false; /**< whether or not vertices are joined by cubic bezier curves */
+            std::pair<QPointF, QPointF> m_extent;          /**< lower and upper [lat, long] corners of the bounding box */
+            std::vector<Lod>           m_lods;             /**< simplified vertex sets, from finest to coarsest */
+
+            /**
+             * \brief  selects the vertices to draw at a given scale
+             * \param  [in] pxpermeter scale of the view, in pixels per meter
+             * \return coarsest vertex set that deviates less than *gl_LodPxTolerance* pixels from
+             *         the full-detail vertices
+             */
+            std::vector<QPointF> const &verticesAt(double pxpermeter) const noexcept {
+                std::vector<QPointF> const *pts = &m_vertices;
+                for (Lod const &lod : m_lods)
+                    if (lod.m_tolerance * pxpermeter <= gl_LodPxTolerance)
+                        pts = &lod.m_vertices;
+                return *pts;
+            }
+        };
+
+        /**
+         * \brief  computes the bounding box of a set of vertices
+         * \param  [in] vertices vertices, in [lat, long] coordinates
+         * \return lower and upper [lat, long] corners; inverted (infinite) if there are no vertices
+         */
+        static std::pair<QPointF, QPointF> int_extentOf(std::vector<QPointF> const &vertices) noexcept {
+            double const inf = std::numeric_limits<double>::infinity();
+
+            std::pair<QPointF, QPointF> extent = { QPointF{ inf, inf }, QPointF{ -inf, -inf } };
+            for (QPointF const &v : vertices) {
+                extent.first  = QPointF{ std::min(extent.first.x(), v.x()), std::min(extent.first.y(), v.y()) };
+                extent.second = QPointF{ std::max(extent.second.x(), v.x()), std::max(extent.second.y(), v.y()) };
+            }
+            return extent;
+        }
+        /**
+         * \brief  creates a shape and precomputes its bounding box and simplified vertex sets
+         * \param  [in] vertices vertices in order, in [lat, long] coordinates
+         * \param  [in] issmooth whether or not vertices are joined by cubic bezier curves
+         * \return shape, or an empty optional if there was an error
+         */
+        static std::optional<Shape> int_makeShape(std::vector<QPointF> vertices, bool issmooth) noexcept {
+            try {
+                Shape shape;
+                shape.m_isSmooth = issmooth;
+                shape.m_extent   = int_extentOf(vertices);
+                shape.m_lods     = int_buildLods(vertices);
+                shape.m_vertices = std::move(vertices);
+
+                return shape;
+            } catch (...) { }
+
+            return std::nullopt;
+        }
+
+        /**
+         * \class RadarObject
+         * \brief represents an object of a specific type, visible on the radar screen
+         */
+        struct RadarObject {
+            /**
+             * \brief constructs a new radar object
+             * \param [in] type type identifier of the new object
+             * \note  All other fields of the RadarObject type are initialized
+             *        to sensible default values.
+             */
+            explicit RadarObject(ObjectRadar::ObjectType type)
+                : m_type(type), m_isVisible(true), m_altitude(0.f)
+            { }
+            /**
+             * \brief make a new radar object
+             * \param [in] type type of the new object
+             * \param [in] pos initial [lat, long] position of object
+             * \param [in] alt initial altitude in meters above sea-level
+             * \note  Radar objects are visible by default.
+             */
+            explicit RadarObject(ObjectRadar::ObjectType type, QPointF const &pos, float alt)
+                : m_type(type), m_position(pos), m_altitude(alt), m_isVisible(true)
+            { }
+
+            ObjectRadar::ObjectType m_type;      /**< object type ID */
+            QPointF                 m_position;  /**< [lat, long] position */
+            QColor                  m_color;     /**< color of indicator and identifier */
+            Shape                   m_shape;     /**< geometry (only used for *Area* and *Path* type objects) */
+            float                   m_altitude;  /**< altitude in meters above sea-level */
+            bool                    m_isVisible; /**< whether or not the object is visible or hidden */
+            float                   m_groundSpeed = 0.f; /**< ground speed, in meters per second */
+            float                   m_heading     = 0.f; /**< track, in degrees clockwise from true north */
+        };
+
+        /**
+         * \brief  converts ground speed and track into a [lat, long] rate of change
+         * \param  [in] pos [lat, long] position of the object
+         * \param  [in] speed ground speed, in meters per second
+         * \param  [in] heading track, in degrees clockwise from true north
+         * \return velocity, in degrees of latitude and longitude per second
+         * \note   Uses the same local equirectangular approximation as the projection.
+         */
+        static QPointF int_velocityOf(QPointF const &pos, float speed, float heading) noexcept {
+            double const h = heading * gl_PI / 180.;
+
+            return QPointF{
+                speed * std::cos(h) / gl_MetersPerDeg,
+                speed * std::sin(h) / (gl_MetersPerDeg * std::max(std::cos(pos.x() * gl_PI / 180.), 1e-6))
+            };
+        }
+        using RO = RadarObject;
+
+        /**
+         * \class IdentIndex
+         * \brief open-addressing hash index mapping object identifiers to slot indices
+         *
+         * Entries live in a single power-of-two sized table and collisions are resolved by
+         * linear probing; removal shifts subsequent entries back instead of leaving tombstones.
+         * Unlike a node-based map, inserting and removing identifiers never allocates as long as
+         * the table does not have to grow, so a table sized up-front (see *reserve()*) serves any
+         * number of add/remove cycles without touching the heap.
+         */
+        class IdentIndex {
+        public:
+            /**
+             * \brief  looks up the slot index of an identifier
+             * \param  [in] ident identifier
+             * \return slot index, or an empty optional if the identifier is not in the index
+             */
+            std::optional<quint32> find(QString const &ident) const noexcept {
+                if (m_size == 0)
+                    return std::optional<quint32>{};
+
+                size_t const hash = qHash(ident);
+                for (size_t k = hash & m_mask;; k = (k + 1) & m_mask) {
+                    Entry const &e = m_entries[k];
+                    if (e.m_slot == gl_Empty)
+                        return std::optional<quint32>{};
+                    if (e.m_hash == hash && e.m_ident == ident)
+                        return std::optional<quint32>(e.m_slot);
+                }
+            }
+            /**
+             * \brief adds an identifier to the index
+             * \param [in] ident identifier; must not be in the index yet
+             * \param [in] slot slot index of the object
+             * \note  This function may throw *std::bad_alloc*. In that case, the index is left
+             *        untouched.
+             */
+            void insert(QString const &ident, quint32 slot) {
+                reserve(m_size + 1);
+
+                size_t const hash = qHash(ident);
+                size_t       k    = hash & m_mask;
+                while (m_entries[k].m_slot != gl_Empty)
+                    k = (k + 1) & m_mask;
+
+                m_entries[k] = Entry{ ident, hash, slot };
+                m_size++;
+            }
+            /**
+             * \brief removes an identifier from the index
+             * \param [in] ident identifier; if it is not in the index, nothing happens
+             */
+            void erase(QString const &ident) noexcept {
+                if (m_size == 0)
+                    return;
+
+                size_t const hash = qHash(ident);
+                size_t       k    = hash & m_mask;
+                for (;; k = (k + 1) & m_mask) {
+                    Entry const &e = m_entries[k];
+                    if (e.m_slot == gl_Empty)
+                        return;
+                    if (e.m_hash == hash && e.m_ident == ident)
+                        break;
+                }
+
+                /* Shift back every following entry that would not be found past the hole anymore. */
+                for (size_t j = (k + 1) & m_mask; m_entries[j].m_slot != gl_Empty; j = (j + 1) & m_mask) {
+                    size_t const home = m_entries[j].m_hash & m_mask;
+                    if (((j - home) & m_mask) < ((j - k) & m_mask))
+                        continue;
+
+                    m_entries[k] = std::move(m_entries[j]);
+                    k            = j;
+                }
+                m_entries[k] = Entry{};
+                m_size--;
+            }
+            /**
+             * \brief removes all identifiers, keeping the table
+             */
+            void clear() noexcept {
+                std::fill(m_entries.begin(), m_entries.end(), Entry{});
+
+                m_size = 0;
+            }
+            /**
+             * \brief makes room for a given number of identifiers
+             * \param [in] n number of identifiers
+             * \note  The table is kept at most half full.
+             * \note  This function may throw *std::bad_alloc*. In that case, the index is left
+             *        untouched.
+             */
+            void reserve(size_t n) {
+                if (2 * n <= m_entries.size())
+                    return;
+
+                size_t len = std::max<size_t>(m_entries.size(), 16);
+                while (len < 2 * n)
+                    len *= 2;
+
+                std::vector<Entry> entries(len);
+                size_t const       mask = len - 1;
+                for (Entry &e : m_entries) {
+                    if (e.m_slot == gl_Empty)
+                        continue;
+
+                    size_t k = e.m_hash & mask;
+                    while (entries[k].m_slot != gl_Empty)
+                        k = (k + 1) & mask;
+                    entries[k] = std::move(e);
+                }
+                m_entries = std::move(entries);
+                m_mask    = mask;
+            }
+            /**
+             * \brief  retrieves the number of identifiers the index holds without growing
+             * \return capacity, in identifiers
+             */
+            size_t capacity() const noexcept { return m_entries.size() / 2; }
+
+        private:
+            static constexpr quint32 gl_Empty = std::numeric_limits<quint32>::max(); /**< slot index marking an unused entry */
+
+            /**
+             * \struct Entry
+             * \brief  table entry
+             */
+            struct Entry {
+                QString m_ident;            /**< identifier */
+                size_t  m_hash = 0;         /**< cached hash of the identifier */
+                quint32 m_slot = gl_Empty;  /**< slot index of the object, or *gl_Empty* */
+            };
+
+            std::vector<Entry> m_entries;  /**< power-of-two sized table */
+            size_t             m_mask = 0; /**< table size minus one */
+            size_t             m_size = 0; /**< number of used entries */
+        };
+
+        /**
+         * \class RadarObjectManager
+         * \brief manages all radar present radar objects
+         * 
+         * Objects are stored as a structure of arrays: every object field lives in its own
+         * contiguous array, indexed by the *dense index* of the object. This way, passes that
+         * only need a few fields (projection, culling, etc.) stream linearly through memory.
+         * Removal uses swap-and-pop, i.e., the last object is moved into the hole, which keeps
+         * the arrays dense but changes the dense index of the moved object.
+         * 
+         * Because dense indices are not stable, objects are referenced from the outside via
+         * generation-checked handles. A handle refers to a slot which in turn stores the current
+         * dense index of the object. Each slot carries a generation counter that is incremented
+         * when the object occupying that slot is removed, which makes outstanding handles
+         * *stale*. The string identifiers are only kept for labels and for reverse lookup.
+         * 
+         * All objects are additionally registered in a spatial grid (by slot index) which is kept
+         * up-to-date on every add, remove and position update.
+         * 
+         * Every modification marks the slot of the affected object as *dirty*. Each view showing
+         * the objects opens a change tracker of its own (see *openTracker()*) and collects the
+         * dirty slots of that tracker once per frame (see *takeChanges()*) to find out which
+         * parts of the widget actually need to be repainted. The first modification after a
+         * frame emits *changesPending()* so that the views can schedule the next frame.
+         */
+        class RadarObjectManager : public QObject {
+            Q_OBJECT
+            
+            /**
+             * \struct Slot
+             * \brief  indirection entry mapping a handle to the current dense index of an object
+             */
+            struct Slot {
+                quint32 m_dense      = 0;     /**< dense index of the object occupying the slot */
+                quint32 m_generation = 1;     /**< current slot generation (never 0) */
+                quint32 m_dirtyMask  = 0;     /**< change trackers (one bit each) whose dirty list contains the slot */
+                bool    m_isAlive    = false; /**< whether or not the slot is occupied */
+            };
+            /**
+             * \struct Tracker
+             * \brief  changes made since a view last collected them
+             */
+            struct Tracker {
+                std::vector<quint32> m_dirtySlots; /**< indices of slots modified since the last *takeChanges()* */
+            };
+
+        public:
+            friend class tests::ObjectRadarTests;
+
+            /**
+             * \brief  adds an object to the radar (if there is no object with the same identifier)
+             * \param  [in] ident identifier of the radar object that is to be added
+             * \param  [in] obj radar object properties
+             * \return handle of the new object, or an invalid handle if the object could not be
+             *         added
+             * \note   This function never throws exceptions.
+             */
+            ObjectHandle addObject(QString const &ident, priv::RadarObject const &obj) noexcept {
+                try {
+                    /* Check if object with the same identifier already exists. If yes, abort. */
+                    if (m_identMap.find(ident).has_value())
+                        return ObjectHandle{};
+                    /* A fixed capacity is a hard limit. */
+                    if (m_capacity != 0 && size() >= m_capacity)
+                        return ObjectHandle{};
+
+                    /*
+                     * Reserve space in all field arrays first so that the actual insertion below
+                     * cannot fail half-way through.
+                     */
+                    int_reserve(size() + 1);
+                    priv::Shape shape = obj.m_shape;
+
+                    /* Reuse a free slot if there is one, otherwise append a new slot. */
+                    bool const    isnew = m_freeSlots.empty();
+                    quint32 const index = isnew ? static_cast<quint32>(m_slots.size()) : m_freeSlots.back();
+                    auto const    key   = m_grid.keyOf(obj.m_position);
+                    m_grid.insert(key, index);
+                    try {
+                        m_identMap.insert(ident, index);
+                        if (isnew)
+                            m_slots.emplace_back();
+                    } catch (...) {
+                        m_identMap.erase(ident);
+                        m_grid.remove(key, index);
+
+                        throw;
+                    }
+                    if (!isnew)
+                        m_freeSlots.pop_back();
+
+                    /* Append object fields. */
+                    Slot &slot = m_slots[index];
+                    slot.m_dense   = static_cast<quint32>(size());
+                    slot.m_isAlive = true;
+                    m_types.push_back(obj.m_type);
+                    m_positions.push_back(obj.m_position);
+                    m_localPositions.push_back(int_toLocalPosition(obj.m_position));
+                    m_colors.push_back(obj.m_color);
+                    m_shapes.push_back(std::move(shape));
+                    m_shapeRevs.push_back(++m_shapeCounter);
+                    m_altitudes.push_back(obj.m_altitude);
+                    m_visibility.push_back(obj.m_isVisible);
+                    m_speeds.push_back(obj.m_groundSpeed);
+                    m_headings.push_back(obj.m_heading);
+                    m_maxSpeed = std::max(m_maxSpeed, std::abs(obj.m_groundSpeed));
+                    m_velocities.push_back(int_velocityOf(obj.m_position, obj.m_groundSpeed, obj.m_heading));
+                    m_fixTimes.push_back(now());
+                    m_idents.push_back(ident);
+                    m_cellKeys.push_back(key);
+                    m_denseToSlot.push_back(index);
+                    int_markDirty(index);
+
+                    int_notifyAdded(ident);
+                    return ObjectHandle{ index, slot.m_generation };
+                } catch (...) { }
+
+                return ObjectHandle{};
+            }
+            /**
+             * \brief  removes an object from the radar, identified by their name
+             * \param  [in] ident (unique) identifier of the object that is to be removed
+             * \return *true* if the object was removed, *false* if not
+             * \note   This function never throws exceptions.
+             */
+            bool removeObject(QString const &ident) noexcept {
+                return removeObject(findObject(ident));
+            }
+            /**
+             * \brief  removes an object from the radar, identified by their handle
+             * \param  [in] handle handle of the object that is to be removed
+             * \return *true* if the object was removed, *false* if the handle is invalid or stale
+             * \note   This function never throws exceptions.
+             */
+            bool removeObject(ObjectHandle handle) noexcept {
+                auto const i = getIndex(handle);
+                if (!i.has_value())
+                    return false;
+
+                /* Release the slot which invalidates all outstanding handles. */
+                QString const ident = std::move(m_idents[*i]);
+                m_identMap.erase(ident);
+                m_grid.remove(m_cellKeys[*i], handle.index());
+                int_markDirty(handle.index());
+                int_releaseSlot(handle.index());
+
+                /* Move the last object into the hole and shrink arrays. */
+                int_swapAndPop(*i);
+
+                int_notifyRemoved(ident);
+                return true;
+            }
+            /**
+             * \brief removes all radar objects
+             * \note  This function never throws exceptions.
+             * \note  Slots are kept (with their generations incremented) so that handles issued
+             *        before the call are reliably recognized as stale.
+             */
+            void clearObjects() noexcept {
+                m_identMap.clear();
+                m_grid.clear();
+                for (size_t i = size(); i-- > 0;)
+                    int_releaseSlot(m_denseToSlot[i]);
+
+                int_clearFields();
+                int_markAllDirty();
+
+                int_notifyRemoved({});
+            }
+            /**
+             * \brief  replaces all objects with the objects stored in a snapshot
+             * 
+             * The object records are decoded in a single pass: the field arrays are reserved once
+             * and filled straight from the records, and the identifier index and the spatial
+             * index are built alongside. Geometries are taken over together with their simplified
+             * vertex sets, which are not rebuilt. The current objects are only replaced once all
+             * allocations succeeded, so that they are kept if there is an error.
+             * 
+             * \param  [in] hdr header of the snapshot; must have been validated with
+             *         *int_checkSnapshot()*
+             * \return *true* on success, *false* if the snapshot holds more objects than the
+             *         capacity allows, contains duplicate identifiers, or there was an error
+             * \note   Like *clearObjects()*, this makes all handles issued before the call stale
+             *         and emits *objectRemoved()* once with an empty identifier. Loaded objects
+             *         are not announced individually.
+             * \note   The spatial index is sized for the radar range stored in the snapshot.
+             * \note   This function never throws exceptions.
+             */
+            bool loadSnapshot(priv::SnapshotHeader const &hdr) noexcept {
+                size_t const n = hdr.m_objectCount;
+                if (m_capacity != 0 && n > m_capacity)
+                    return false;
+
+                uchar const *data = reinterpret_cast<uchar const *>(&hdr);
+                auto const  *objs = reinterpret_cast<priv::SnapshotObject const *>(data + hdr.m_objectOffset);
+                auto const  *strs = reinterpret_cast<QChar const *>(data + hdr.m_stringOffset);
+                try {
+                    /*
+                     * Assign slots the way *clearObjects()* followed by *addObject()* would: the
+                     * slots of the current objects are freed (in reverse order), then free slots
+                     * are reused before new slots are appended.
+                     */
+                    std::vector<quint32> freeSlots;
+                    freeSlots.reserve(std::max(m_freeSlots.size() + size(), m_freeSlots.capacity()));
+                    freeSlots.insert(freeSlots.end(), m_freeSlots.begin(), m_freeSlots.end());
+                    for (size_t i = size(); i-- > 0;)
+                        freeSlots.push_back(m_denseToSlot[i]);
+
+                    std::vector<quint32> indices(n);
+                    size_t               nslots = m_slots.size();
+                    for (size_t i = 0; i < n; i++) {
+                        if (freeSlots.empty()) {
+                            indices[i] = static_cast<quint32>(nslots++);
+                            continue;
+                        }
+
+                        indices[i] = freeSlots.back();
+                        freeSlots.pop_back();
+                    }
+
+                    /* Build everything that allocates up-front. */
+                    IdentIndex                    identMap;
+                    SpatialGrid                   grid{ int_idealCellSize(hdr.m_view.m_range[1]) };
+                    std::vector<QString>          idents(n);
+                    std::vector<priv::Shape>      shapes(n);
+                    std::vector<SpatialGrid::Key> keys(n);
+                    identMap.reserve(std::max(n, m_identMap.capacity()));
+                    for (size_t i = 0; i < n; i++) {
+                        priv::SnapshotObject const &obj = objs[i];
+
+                        idents[i] = QString{ strs + obj.m_ident.m_offset, static_cast<qsizetype>(obj.m_ident.m_length) };
+                        if (identMap.find(idents[i]).has_value())
+                            return false;
+                        identMap.insert(idents[i], indices[i]);
+
+                        keys[i] = grid.keyOf(QPointF{ obj.m_position[0], obj.m_position[1] });
+                        grid.insert(keys[i], indices[i]);
+
+                        if (obj.m_vertexCount != 0)
+                            shapes[i] = int_decodeShape(hdr, obj);
+                    }
+                    int_reserve(n);
+                    m_slots.reserve(nslots);
+
+                    /* Commit; nothing below allocates. */
+                    for (size_t i = size(); i-- > 0;)
+                        int_retireSlot(m_slots[m_denseToSlot[i]]);
+                    m_slots.resize(nslots);
+                    m_freeSlots = std::move(freeSlots);
+                    m_identMap  = std::move(identMap);
+                    m_grid      = std::move(grid);
+                    int_clearFields();
+
+                    double const t = now();
+                    for (size_t i = 0; i < n; i++) {
+                        priv::SnapshotObject const &obj = objs[i];
+                        QPointF const               pos = QPointF{ obj.m_position[0], obj.m_position[1] };
+
+                        Slot &slot = m_slots[indices[i]];
+                        slot.m_dense   = static_cast<quint32>(i);
+                        slot.m_isAlive = true;
+                        m_types.push_back(static_cast<ObjectRadar::ObjectType>(obj.m_type));
+                        m_positions.push_back(pos);
+                        m_localPositions.push_back(int_toLocalPosition(pos));
+                        m_colors.push_back(priv::int_unpackColor(obj.m_color));
+                        m_shapes.push_back(std::move(shapes[i]));
+                        m_shapeRevs.push_back(++m_shapeCounter);
+                        m_altitudes.push_back(obj.m_altitude);
+                        m_visibility.push_back(obj.m_isVisible != 0);
+                        m_speeds.push_back(obj.m_groundSpeed);
+                        m_headings.push_back(obj.m_heading);
+                        m_maxSpeed = std::max(m_maxSpeed, std::abs(obj.m_groundSpeed));
+                        m_velocities.push_back(int_velocityOf(pos, obj.m_groundSpeed, obj.m_heading));
+                        m_fixTimes.push_back(t);
+                        m_idents.push_back(std::move(idents[i]));
+                        m_cellKeys.push_back(keys[i]);
+                        m_denseToSlot.push_back(indices[i]);
+                    }
+                } catch (...) { return false; }
+
+                int_markAllDirty();
+
+                int_notifyRemoved({});
+                return true;
+            }
+            /**
+             * \brief  retrieves a copy of the properties of an object with a given name
+             * \param  [in] ident (unique) identifier of the object that is to be retrieved
+             * \return an *std::optional* with the properties of the retrieved object if it could
+             *         be retrieved, or an empty optional if there was an error or the object
+             *         could not be retrieved
+             * \note   This function never throws exceptions.
+             */
+            std::optional<priv::RadarObject> getObject(QString const &ident) const noexcept {
+                return getObject(findObject(ident));
+            }
+            /**
+             * \brief  retrieves a copy of the properties of an object referred to by a handle
+             * \param  [in] handle handle of the object that is to be retrieved
+             * \return an *std::optional* with the properties of the retrieved object, or an empty
+             *         optional if the handle is invalid or stale
+             * \note   This function never throws exceptions.
+             * \note   This assembles the object from the individual field arrays. Passes touching
+             *         many objects should use the field accessors instead.
+             */
+            std::optional<priv::RadarObject> getObject(ObjectHandle handle) const noexcept {
+                auto const i = getIndex(handle);
+                if (!i.has_value())
+                    return std::optional<priv::RadarObject>{};
+
+                try {
+                    priv::RadarObject obj{ m_types[*i], m_positions[*i], m_altitudes[*i] };
+                    obj.m_color     = m_colors[*i];
+                    obj.m_shape     = m_shapes[*i];
+                    obj.m_isVisible   = m_visibility[*i];
+                    obj.m_groundSpeed = m_speeds[*i];
+                    obj.m_heading     = m_headings[*i];
+                    return std::optional<priv::RadarObject>(std::move(obj));
+                } catch (...) { }
+
+                return std::optional<priv::RadarObject>{};
+            }
+            /**
+             * \brief  resolves a handle to the current dense index of the object
+             * \param  [in] handle handle of the object
+             * \return dense index of the object, or an empty optional if the handle is invalid or
+             *         stale
+             * \note   Dense indices are only valid until the next object is removed.
+             */
+            std::optional<size_t> getIndex(ObjectHandle handle) const noexcept {
+                if (!handle.isValid() || handle.index() >= m_slots.size())
+                    return std::optional<size_t>{};
+
+                Slot const &slot = m_slots[handle.index()];
+                if (!slot.m_isAlive || slot.m_generation != handle.generation())
+                    return std::optional<size_t>{};
+                return std::optional<size_t>(slot.m_dense);
+            }
+            /**
+             * \brief  looks up the handle of an object given its identifier
+             * \param  [in] ident identifier of the object
+             * \return handle of the object, or an invalid handle if there is no such object
+             * \note   This function never throws exceptions.
+             */
+            ObjectHandle findObject(QString const &ident) const noexcept {
+                auto const index = m_identMap.find(ident);
+                if (!index.has_value())
+                    return ObjectHandle{};
+
+                return ObjectHandle{ *index, m_slots[*index].m_generation };
+            }
+            /**
+             * \brief  retrieves the handle of the object at a given dense index
+             * \param  [in] i dense index in range [0, size() - 1]
+             * \return handle of the object
+             */
+            ObjectHandle getHandle(size_t i) const noexcept {
+                quint32 const index = m_denseToSlot[i];
+
+                return ObjectHandle{ index, m_slots[index].m_generation };
+            }
+            /**
+             * \brief  retrieves the identifier of an object
+             * \param  [in] handle handle of the object
+             * \return *std::optional* with the identifier, or an empty optional if the handle is
+             *         invalid or stale
+             */
+            std::optional<QString> getIdentifier(ObjectHandle handle) const noexcept {
+                auto const i = getIndex(handle);
+                if (!i.has_value())
+                    return std::optional<QString>{};
+
+                return std::optional<QString>(m_idents[*i]);
+            }
+            /**
+             * \brief  changes the identifier of an object
+             * \param  [in] handle handle of the object that is to be renamed
+             * \param  [in] ident new identifier
+             * \return *true* if the object was renamed, *false* if the handle is stale or the new
+             *         identifier is already taken
+             * \note   The handle of the object stays the same.
+             * \note   This function never throws exceptions.
+             */
+            bool renameObject(ObjectHandle handle, QString const &ident) noexcept {
+                auto const i = getIndex(handle);
+                if (!i.has_value() || m_identMap.find(ident).has_value())
+                    return false;
+
+                try {
+                    m_identMap.insert(ident, handle.index());
+                } catch (...) { return false; }
+                m_identMap.erase(m_idents[*i]);
+
+                QString const oldIdent = std::exchange(m_idents[*i], ident);
+                int_markDirty(handle.index());
+                int_notifyRenamed(oldIdent, ident);
+                return true;
+            }
+            /**
+             * \brief opens a (nested) transaction
+             * \note  Until the outermost transaction is committed, added, removed and renamed
+             *        objects are recorded instead of signaled.
+             */
+            void beginTransaction() noexcept { ++m_txDepth; }
+            /**
+             * \brief  commits the innermost open transaction
+             * \return changes made since the outermost transaction was opened if it was the
+             *         outermost one, otherwise (or if no transaction was open) an empty optional
+             */
+            std::optional<ObjectRadar::ChangeSet> commitTransaction() noexcept {
+                if (m_txDepth == 0 || --m_txDepth > 0)
+                    return std::optional<ObjectRadar::ChangeSet>{};
+
+                emit transactionCommitted();
+                return std::optional<ObjectRadar::ChangeSet>(std::exchange(m_txChanges, ObjectRadar::ChangeSet{}));
+            }
+            /**
+             * \brief  checks whether a transaction is open
+             * \return *true* if a transaction is open, *false* if not
+             */
+            bool isInTransaction() const noexcept { return m_txDepth > 0; }
+            /**
+             * \brief  retrieves the number of objects currently managed
+             * \return number of objects
+             */
+            size_t size() const noexcept { return m_denseToSlot.size(); }
+            /**
+             * \brief  retrieves the number of slots (occupied or not)
+             * \return number of slots; all slot indices are less than this value
+             */
+            size_t slotCount() const noexcept { return m_slots.size(); }
+            /**
+             * \brief  retrieves the maximum number of objects
+             * \return maximum number of objects, or 0 if the number of objects is unlimited
+             */
+            size_t capacity() const noexcept { return m_capacity; }
+            /**
+             * \brief  limits the number of objects and allocates all per-object storage up-front
+             *
+             * After this call, adding and removing objects does not allocate as long as the number
+             * of objects stays within **n**; *addObject()* fails once the limit is reached. The
+             * only remaining allocations are those of identifier strings that are not shared
+             * with the caller and of spatial index cells that were never occupied before.
+             *
+             * \param  [in] n maximum number of objects, or 0 to lift the limit (storage is kept)
+             * \return *true* on success, *false* if there are more than **n** objects or if there
+             *         was an error
+             * \note   This function never throws exceptions.
+             */
+            bool setCapacity(size_t n) noexcept {
+                if (n != 0 && n < size())
+                    return false;
+
+                try {
+                    m_types.reserve(n);
+                    m_positions.reserve(n);
+                    m_localPositions.reserve(n);
+                    m_colors.reserve(n);
+                    m_shapes.reserve(n);
+                    m_shapeRevs.reserve(n);
+                    m_altitudes.reserve(n);
+                    m_visibility.reserve(n);
+                    m_speeds.reserve(n);
+                    m_headings.reserve(n);
+                    m_velocities.reserve(n);
+                    m_fixTimes.reserve(n);
+                    m_idents.reserve(n);
+                    m_cellKeys.reserve(n);
+                    m_denseToSlot.reserve(n);
+                    m_slots.reserve(n);
+                    m_freeSlots.reserve(n);
+                    for (quint32 bits = m_openTrackers; bits != 0; bits &= bits - 1)
+                        m_trackers[qCountTrailingZeroBits(bits)].m_dirtySlots.reserve(n);
+                    m_identMap.reserve(n);
+                } catch (...) { return false; }
+
+                m_capacity = n;
+                return true;
+            }
+            /**
+             * \brief  resolves a slot index to the dense index of the object occupying it
+             * \param  [in] slot slot index
+             * \return dense index of the object, or an empty optional if the slot is unoccupied
+             */
+            std::optional<size_t> getSlotIndex(quint32 slot) const noexcept {
+                if (slot >= m_slots.size() || !m_slots[slot].m_isAlive)
+                    return std::optional<size_t>{};
+
+                return std::optional<size_t>(m_slots[slot].m_dense);
+            }
+            /**
+             * \brief  opens a change tracker for a view
+             * \return tracker ID, or an empty optional if *gl_MaxTrackers* trackers are open
+             *         already (or if there was an error)
+             * \note   A new tracker considers all objects dirty.
+             * \note   This function never throws exceptions.
+             */
+            std::optional<quint32> openTracker() noexcept {
+                for (quint32 t = 0; t < gl_MaxTrackers; t++) {
+                    if ((m_openTrackers & (1u << t)) != 0)
+                        continue;
+
+                    try {
+                        m_trackers[t].m_dirtySlots.reserve(m_capacity);
+                    } catch (...) { return std::optional<quint32>{}; }
+
+                    m_openTrackers |= 1u << t;
+                    m_allDirtyMask |= 1u << t;
+                    return std::optional<quint32>(t);
+                }
+                return std::optional<quint32>{};
+            }
+            /**
+             * \brief closes a change tracker
+             * \param [in] tracker tracker ID, as returned by *openTracker()*
+             */
+            void closeTracker(quint32 tracker) noexcept {
+                if (tracker >= gl_MaxTrackers)
+                    return;
+
+                Tracker &trk = m_trackers[tracker];
+                for (quint32 const slot : trk.m_dirtySlots)
+                    m_slots[slot].m_dirtyMask &= ~(1u << tracker);
+
+                trk.m_dirtySlots = std::vector<quint32>{};
+                m_openTrackers &= ~(1u << tracker);
+                m_allDirtyMask &= ~(1u << tracker);
+            }
+            /**
+             * \brief  collects all slots that were modified since the last call
+             * \param  [in] tracker tracker ID of the view, as returned by *openTracker()*
+             * \param  [out] out receives the indices of all dirty slots (appended); each slot is
+             *         reported once regardless of how often it was modified
+             * \return *true* if the changes could not be tracked individually (e.g., after all
+             *         objects were removed) and the entire view must be considered dirty,
+             *         *false* otherwise
+             * \note   Slots in **out** may be unoccupied by now, i.e., their object was removed.
+             * \note   The changes collected by other trackers are not affected.
+             * \note   This function may throw *std::bad_alloc*. In that case, the dirty state is
+             *         left untouched.
+             */
+            bool takeChanges(quint32 tracker, std::vector<quint32> &out) {
+                Tracker &trk = m_trackers[tracker];
+
+                out.insert(out.end(), trk.m_dirtySlots.begin(), trk.m_dirtySlots.end());
+                for (quint32 const slot : trk.m_dirtySlots)
+                    m_slots[slot].m_dirtyMask &= ~(1u << tracker);
+
+                trk.m_dirtySlots.clear();
+
+                bool const isall = (m_allDirtyMask & (1u << tracker)) != 0;
+                m_allDirtyMask &= ~(1u << tracker);
+                return isall;
+            }
+
+            /**
+             * \defgroup field accessors
+             * \brief    per-field access to the object arrays, indexed by dense index
+             */
+            std::vector<ObjectRadar::ObjectType> const &types() const noexcept { return m_types; }
+            std::vector<QPointF> const &positions() const noexcept              { return m_positions; }
+            /**
+             * \brief  retrieves the positions of all objects in the local frame
+             * \return local positions, in the frame returned by *localFrame()*
+             */
+            std::vector<priv::LocalPosition> const &localPositions() const noexcept { return m_localPositions; }
+            /**
+             * \brief  retrieves the local frame of *localPositions()*
+             * \return local frame
+             */
+            priv::LocalFrame const &localFrame() const noexcept { return m_frame; }
+            std::vector<QColor> const &colors() const noexcept                  { return m_colors; }
+            std::vector<priv::Shape> const &shapes() const noexcept             { return m_shapes; }
+            /**
+             * \brief  retrieves the shape revisions of all objects
+             * \return shape revisions; a revision changes whenever the shape of an object is
+             *         replaced, and is never reused (even across objects)
+             */
+            std::vector<quint64> const &shapeRevisions() const noexcept         { return m_shapeRevs; }
+            std::vector<float> const &altitudes() const noexcept                { return m_altitudes; }
+            std::vector<bool> const &visibility() const noexcept                { return m_visibility; }
+            std::vector<float> const &groundSpeeds() const noexcept             { return m_speeds; }
+            std::vector<float> const &headings() const noexcept                 { return m_headings; }
+            /**
+             * \brief  retrieves an upper bound of the ground speeds of all objects
+             * \return maximum ground speed, in meters per second
+             * \note   The bound only grows as objects speed up; it is reset when all objects are
+             *         replaced at once.
+             */
+            float maxGroundSpeed() const noexcept { return m_maxSpeed; }
+            /**
+             * \brief  retrieves the velocities of all objects
+             * \return velocities, in degrees of latitude and longitude per second
+             */
+            std::vector<QPointF> const &velocities() const noexcept             { return m_velocities; }
+            /**
+             * \brief  retrieves the times of the last position update of all objects
+             * \return times, in seconds on the clock of *now()*
+             */
+            std::vector<double> const &fixTimes() const noexcept                { return m_fixTimes; }
+            /**
+             * \brief  reads the clock position updates are timestamped with
+             * \return seconds since the object manager was created
+             */
+            double now() const noexcept {
+                return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_epoch).count();
+            }
+            std::vector<QString> const &identifiers() const noexcept            { return m_idents; }
+
+            /**
+             * \defgroup field mutators
+             * \brief    per-field updates, indexed by dense index
+             * \note     No range checking is done on the index.
+             */
+            void setType(size_t i, ObjectRadar::ObjectType type) noexcept { m_types[i]      = type; int_markDirty(m_denseToSlot[i]); }
+            void setPosition(size_t i, QPointF const &pos) noexcept {
+                m_positions[i]      = pos;
+                m_localPositions[i] = int_toLocalPosition(pos);
+                m_fixTimes[i]       = now();
+                if (m_speeds[i] != 0.f)
+                    m_velocities[i] = int_velocityOf(pos, m_speeds[i], m_headings[i]);
+                int_markDirty(m_denseToSlot[i]);
+
+                /* Move the object to its new cell if it crossed a cell boundary. */
+                auto const key = m_grid.keyOf(pos);
+                if (key == m_cellKeys[i])
+                    return;
+                try {
+                    m_grid.insert(key, m_denseToSlot[i]);
+                } catch (...) { return; /* Keep the object in its old cell. */ }
+
+                m_grid.remove(m_cellKeys[i], m_denseToSlot[i]);
+                m_cellKeys[i] = key;
+            }
+            void setColor(size_t i, QColor const &col) noexcept           { m_colors[i]     = col;  int_markDirty(m_denseToSlot[i]); }
+            void setShape(size_t i, priv::Shape shape) noexcept {
+                m_shapes[i]    = std::move(shape);
+                m_shapeRevs[i] = ++m_shapeCounter;
+                int_markDirty(m_denseToSlot[i]);
+            }
+            void setAltitude(size_t i, float alt) noexcept                { m_altitudes[i]  = alt;  int_markDirty(m_denseToSlot[i]); }
+            void setVisibility(size_t i, bool vis) noexcept               { m_visibility[i] = vis;  int_markDirty(m_denseToSlot[i]); }
+            /**
+             * \brief sets the ground speed and track of an object
+             * \note  Extrapolation always starts from the last reported position; this does not
+             *        move the object.
+             */
+            void setMotion(size_t i, float speed, float heading) noexcept {
+                m_maxSpeed      = std::max(m_maxSpeed, std::abs(speed));
+                m_speeds[i]     = speed;
+                m_headings[i]   = heading;
+                m_velocities[i] = int_velocityOf(m_positions[i], speed, heading);
+                int_markDirty(m_denseToSlot[i]);
+            }
+            /**
+             * \brief marks an object as modified for a single view without changing it
+             * \param [in] i dense index of the object
+             * \param [in] tracker tracker ID of the view
+             * \note  Used for objects whose drawn position changes by extrapolation alone, which
+             *        depends on the settings of the view.
+             */
+            void touch(size_t i, quint32 tracker) noexcept { int_markDirty(m_denseToSlot[i], 1u << tracker); }
+
+            /**
+             * \brief collects all objects within a given distance of a position
+             * \param [in] center [lat, long] center of the query
+             * \param [in] radius maximum distance, in meters
+             * \param [out] out receives the dense indices of all objects within range (appended)
+             * \note  This function may throw *std::bad_alloc*.
+             */
+            void queryRadius(QPointF const &center, double radius, std::vector<quint32> &out) const {
+                auto const [lo, hi] = int_boundingBox(center, radius);
+                double const     r2 = radius * radius;
+
+                m_grid.forEachInBox(lo, hi, [&](quint32 slot) {
+                    quint32 const i = m_slots[slot].m_dense;
+
+                    if (int_distanceSquared(center, m_positions[i]) <= r2)
+                        out.push_back(i);
+                });
+            }
+            /**
+             * \brief  finds the object closest to a given position
+             * \param  [in] pos [lat, long] position
+             * \param  [in] radius maximum distance, in meters
+             * \param  [in] visibleOnly whether or not to ignore hidden objects {def: true}
+             * \return dense index of the closest object, or an empty optional if there is no
+             *         object within **radius**
+             */
+            std::optional<size_t> findNearest(QPointF const &pos, double radius, bool visibleOnly = true) const noexcept {
+                auto const [lo, hi] = int_boundingBox(pos, radius);
+
+                std::optional<size_t> best;
+                double                bestd2 = radius * radius;
+                m_grid.forEachInBox(lo, hi, [&](quint32 slot) {
+                    quint32 const i = m_slots[slot].m_dense;
+                    if (visibleOnly && !m_visibility[i])
+                        return;
+
+                    double const d2 = int_distanceSquared(pos, m_positions[i]);
+                    if (d2 <= bestd2) {
+                        best   = i;
+                        bestd2 = d2;
+                    }
+                });
+
+                return best;
+            }
+            /**
+             * \brief adapts the cell size of the spatial index to the radar range
+             * \param [in] range maximum radar range, in meters
+             * \note  The index is only rebuilt if the ideal cell size differs from the current cell
+             *        size by more than a factor of two, so that small range changes are free.
+             * \note  If the index cannot be rebuilt (out of memory), the old index is kept.
+             */
+            void adaptIndex(double range) noexcept {
+                double const ideal = int_idealCellSize(range);
+                double const ratio = ideal / m_grid.cellSize();
+                if (ratio > 0.5 && ratio < 2.)
+                    return;
+
+                try {
+                    SpatialGrid grid{ ideal };
+                    std::vector<SpatialGrid::Key> keys(size());
+
+                    for (size_t i = 0; i < size(); i++) {
+                        keys[i] = grid.keyOf(m_positions[i]);
+
+                        grid.insert(keys[i], m_denseToSlot[i]);
+                    }
+
+                    m_grid     = std::move(grid);
+                    m_cellKeys = std::move(keys);
+                } catch (...) { }
+            }
+
+        signals:
+            /**
+             * \brief emitted when an object was successfully added
+             * \param [in] ident identifier of the object that was added
+             */
+            void objectAdded(QString const &ident);
+            /**
+             * \brief emitted when an (or all) object was successfully removed
+             * \param [in] ident identifier of removed object, or empty if all objects were removed
+             * \note  The *std::optional* parameter is empty if all objects were removed, otherwise
+             *        it holds the name of the removed object as a *QString*.
+             */
+            void objectRemoved(std::optional<QString> const &ident);
+            /**
+             * \brief emitted when an object was renamed
+             * \param [in] oldIdent previous identifier of the object
+             * \param [in] newIdent new identifier of the object
+             */
+            void objectRenamed(QString const &oldIdent, QString const &newIdent);
+            /**
+             * \brief emitted when an object is modified for the first time after the last call to
+             *        *takeChanges()* of any change tracker
+             * \note  This is emitted at most once per frame and tracker regardless of how many
+             *        objects are modified.
+             */
+            void changesPending();
+            /**
+             * \brief emitted when the outermost transaction was committed
+             * \note  Views that did not commit it themselves use this to catch up on the objects
+             *        that were added or removed in the meantime.
+             */
+            void transactionCommitted();
+
+        private:
+            /* object fields (indexed by dense index) */
+            std::vector<ObjectRadar::ObjectType> m_types;       /**< object type IDs */
+            std::vector<QPointF>                 m_positions;   /**< [lat, long] positions */
+            std::vector<priv::LocalPosition>     m_localPositions; /**< positions in *m_frame* (mirror of *m_positions*) */
+            std::vector<QColor>                  m_colors;      /**< colors of indicators and identifiers */
+            std::vector<priv::Shape>             m_shapes;      /**< geometries (only used for *Area* and *Path* type objects) */
+            std::vector<quint64>                 m_shapeRevs;   /**< revision of each geometry */
+            quint64                              m_shapeCounter = 0; /**< last issued geometry revision */
+            float                                m_maxSpeed = 0.f;   /**< upper bound of *m_speeds* */
+            std::vector<float>                   m_altitudes;   /**< altitudes in meters above sea-level */
+            std::vector<bool>                    m_visibility;  /**< visibility bitset */
+            std::vector<float>                   m_speeds;      /**< ground speeds, in meters per second */
+            std::vector<float>                   m_headings;    /**< tracks, in degrees clockwise from true north */
+            std::vector<QPointF>                 m_velocities;  /**< velocities derived from speed and track, in degrees per second */
+            std::vector<double>                  m_fixTimes;    /**< time of the last position update, in seconds on the clock of *now()* */
+            std::vector<QString>                 m_idents;      /**< object identifiers */
+            std::vector<SpatialGrid::Key>        m_cellKeys;    /**< spatial index cell of each object */
+            std::vector<quint32>                 m_denseToSlot; /**< slot index of each object */
+
+            /* handle indirection */
+            std::vector<Slot>                    m_slots;       /**< handle slots */
+            std::vector<quint32>                 m_freeSlots;   /**< indices of unoccupied slots */
+            IdentIndex                           m_identMap;    /**< identifier to slot index map (reverse lookup) */
+            SpatialGrid                          m_grid;        /**< spatial index (by slot index) */
+            priv::LocalFrame                     m_frame;       /**< local frame of *m_localPositions* */
+            bool                                 m_isClamped = false; /**< whether some local positions are clamped even after rebasing (see *int_rebaseFrame()*) */
+            size_t                               m_capacity = 0; /**< maximum number of objects, or 0 if unlimited */
+            std::chrono::steady_clock::time_point m_epoch = std::chrono::steady_clock::now(); /**< origin of *now()* */
+
+            /* change tracking */
+            static constexpr quint32 gl_MaxTrackers = 32;             /**< maximum number of change trackers (one bit of *Slot::m_dirtyMask* each) */
+            std::array<Tracker, gl_MaxTrackers>  m_trackers;          /**< change trackers, by tracker ID */
+            quint32                              m_openTrackers = 0;  /**< open change trackers (one bit each) */
+            quint32                              m_allDirtyMask = 0;  /**< change trackers that lost individual changes (one bit each) */
+
+            /* transactions */
+            quint32                              m_txDepth = 0;       /**< number of open (nested) transactions */
+            ObjectRadar::ChangeSet               m_txChanges;         /**< changes made in the open transaction */
+
+            /**
+             * \brief reports an added object, or records it if a transaction is open
+             * \param [in] ident identifier of the object
+             */
+            void int_notifyAdded(QString const &ident) noexcept {
+                if (m_txDepth == 0) {
+                    emit objectAdded(ident);
+
+                    return;
+                }
+
+                try {
+                    m_txChanges.m_added.push_back(ident);
+                } catch (...) { m_txChanges.m_isComplete = false; }
+            }
+            /**
+             * \brief reports a removed object, or records it if a transaction is open
+             * \param [in] ident identifier of the object, or empty if all objects were removed
+             */
+            void int_notifyRemoved(std::optional<QString> const &ident) noexcept {
+                if (m_txDepth == 0) {
+                    emit objectRemoved(ident);
+
+                    return;
+                }
+
+                /* Whatever happened to individual objects before is moot now. */
+                if (!ident.has_value()) {
+                    m_txChanges.m_added.clear();
+                    m_txChanges.m_removed.clear();
+                    m_txChanges.m_renamed.clear();
+                    m_txChanges.m_isCleared = true;
+
+                    return;
+                }
+
+                try {
+                    m_txChanges.m_removed.push_back(*ident);
+                } catch (...) { m_txChanges.m_isComplete = false; }
+            }
+            /**
+             * \brief reports a renamed object, or records it if a transaction is open
+             * \param [in] oldIdent previous identifier of the object
+             * \param [in] newIdent new identifier of the object
+             */
+            void int_notifyRenamed(QString const &oldIdent, QString const &newIdent) noexcept {
+                if (m_txDepth == 0) {
+                    emit objectRenamed(oldIdent, newIdent);
+
+                    return;
+                }
+
+                try {
+                    m_txChanges.m_renamed.emplace_back(oldIdent, newIdent);
+                } catch (...) { m_txChanges.m_isComplete = false; }
+            }
+
+            /**
+             * \brief marks a slot as modified
+             * \param [in] index slot index
+             * \param [in] trackers change trackers (one bit each) to mark the slot dirty for {def:
+             *        all open trackers}
+             * \note  If the slot cannot be added to the dirty list of a tracker (out of memory),
+             *        all objects are considered dirty for that tracker instead.
+             */
+            void int_markDirty(quint32 index, quint32 trackers = ~quint32{ 0 }) noexcept {
+                Slot &slot = m_slots[index];
+
+                quint32 const pending = trackers & m_openTrackers & ~(slot.m_dirtyMask | m_allDirtyMask);
+                if (pending == 0)
+                    return;
+
+                /* Visit the pending trackers only; usually, that's the one of a single view. */
+                bool isfirst = false;
+                for (quint32 bits = pending; bits != 0; bits &= bits - 1) {
+                    quint32 const t   = qCountTrailingZeroBits(bits);
+                    Tracker      &trk = m_trackers[t];
+
+                    isfirst = isfirst || trk.m_dirtySlots.empty();
+                    try {
+                        trk.m_dirtySlots.push_back(index);
+
+                        slot.m_dirtyMask |= 1u << t;
+                    } catch (...) { m_allDirtyMask |= 1u << t; }
+                }
+
+                if (isfirst)
+                    emit changesPending();
+            }
+            /**
+             * \brief marks all objects as modified (for all open trackers)
+             */
+            void int_markAllDirty() noexcept {
+                bool isfirst = false;
+                for (quint32 bits = m_openTrackers & ~m_allDirtyMask; bits != 0; bits &= bits - 1)
+                    isfirst = isfirst || m_trackers[qCountTrailingZeroBits(bits)].m_dirtySlots.empty();
+
+                m_allDirtyMask |= m_openTrackers;
+                if (isfirst)
+                    emit changesPending();
+            }
+
+            /**
+             * \brief reserves capacity for a given number of objects in all field arrays
+             * \param [in] n number of objects
+             * \note  Capacity grows geometrically so that repeated calls with *size() + 1* stay
+             *        amortized constant.
+             * \note  This function may throw *std::bad_alloc*.
+             */
+            void int_reserve(size_t n) {
+                if (n <= m_denseToSlot.capacity())
+                    return;
+                n = std::max(n, 2 * m_denseToSlot.capacity());
+
+                m_types.reserve(n);
+                m_positions.reserve(n);
+                m_localPositions.reserve(n);
+                m_colors.reserve(n);
+                m_shapes.reserve(n);
+                m_shapeRevs.reserve(n);
+                m_altitudes.reserve(n);
+                m_visibility.reserve(n);
+                m_speeds.reserve(n);
+                m_headings.reserve(n);
+                m_velocities.reserve(n);
+                m_fixTimes.reserve(n);
+                m_idents.reserve(n);
+                m_cellKeys.reserve(n);
+                m_denseToSlot.reserve(n);
+            }
+            /**
+             * \brief  converts a [lat, long] position to a local position, anchoring or rebasing
+             *         the local frame first if needed
+             * \param  [in] pos [lat, long] position
+             * \return local position
+             * \note   The frame is anchored at the first position stored while there are no
+             *         objects, and only rebased if *pos* is beyond the range of the fixed-point
+             *         format from the anchor (see *int_rebaseFrame()*). Views never move it, so
+             *         any number of views with any centers share the frame as is.
+             * \note   Must be called before *pos* is stored in *m_localPositions*. Entries of
+             *         *m_positions* past the end of *m_localPositions* are ignored.
+             */
+            priv::LocalPosition int_toLocalPosition(QPointF const &pos) noexcept {
+                if (m_localPositions.empty()) {
+                    m_frame     = int_makeLocalFrame(pos);
+                    m_isClamped = false;
+                } else if (!m_isClamped && !int_isInFrame(m_frame, pos))
+                    int_rebaseFrame(pos);
+
+                return int_quantize(m_frame, pos);
+            }
+            /**
+             * \brief moves the anchor of the local frame to the centroid of all positions
+             * \param [in] pos [lat, long] position about to be stored in addition
+             * \note  Rebasing converts all positions anew; it only happens if objects are some
+             *        20000 kilometers apart. If they do not fit even then, the outliers are
+             *        clamped and the frame is kept until there are no objects anymore.
+             */
+            void int_rebaseFrame(QPointF const &pos) noexcept {
+                size_t const n   = m_localPositions.size();
+                QPointF      sum = pos;
+                for (size_t i = 0; i < n; i++)
+                    sum += m_positions[i];
+
+                m_frame     = int_makeLocalFrame(sum / static_cast<double>(n + 1));
+                m_isClamped = !int_isInFrame(m_frame, pos);
+                for (size_t i = 0; i < n; i++) {
+                    m_localPositions[i] = int_quantize(m_frame, m_positions[i]);
+                    m_isClamped        |= !int_isInFrame(m_frame, m_positions[i]);
+                }
+            }
+            /**
+             * \brief empties all field arrays, keeping their storage
+             */
+            void int_clearFields() noexcept {
+                m_types.clear();
+                m_positions.clear();
+                m_localPositions.clear();
+                m_colors.clear();
+                m_shapes.clear();
+                m_shapeRevs.clear();
+                m_altitudes.clear();
+                m_visibility.clear();
+                m_speeds.clear();
+                m_maxSpeed = 0.f;
+                m_headings.clear();
+                m_velocities.clear();
+                m_fixTimes.clear();
+                m_idents.clear();
+                m_cellKeys.clear();
+                m_denseToSlot.clear();
+            }
+            /**
+             * \brief  computes the cell size of the spatial index best suited for a radar range
+             * \param  [in] range maximum radar range, in meters
+             * \return edge length of a cell, in degrees
+             */
+            static double int_idealCellSize(double range) noexcept {
+                return std::max(range / gl_CellsPerView / gl_MetersPerDeg, 1e-7);
+            }
+            /**
+             * \brief  decodes the geometry of an object stored in a snapshot
+             * \param  [in] hdr header of the snapshot
+             * \param  [in] obj object record
+             * \return shape, including its simplified vertex sets
+             * \note   This function may throw *std::bad_alloc*.
+             */
+            static priv::Shape int_decodeShape(priv::SnapshotHeader const &hdr, priv::SnapshotObject const &obj) {
+                uchar const *data  = reinterpret_cast<uchar const *>(&hdr);
+                auto const  *verts = reinterpret_cast<priv::SnapshotVertex const *>(data + hdr.m_vertexOffset);
+                auto const  *lods  = reinterpret_cast<priv::SnapshotLod const *>(data + hdr.m_lodOffset);
+                auto const   read  = [verts](quint64 first, quint32 count) {
+                    std::vector<QPointF> pts;
+                    pts.reserve(count);
+                    for (quint64 k = first; k < first + count; k++)
+                        pts.emplace_back(verts[k].m_lat, verts[k].m_long);
+                    return pts;
+                };
+
+                priv::Shape shape;
+                shape.m_vertices = read(obj.m_vertexIndex, obj.m_vertexCount);
+                shape.m_isSmooth = obj.m_isSmooth != 0;
+                shape.m_extent   = priv::int_extentOf(shape.m_vertices);
+                shape.m_lods.reserve(obj.m_lodCount);
+                for (quint32 k = obj.m_lodIndex; k < obj.m_lodIndex + obj.m_lodCount; k++)
+                    shape.m_lods.push_back(priv::Lod{ lods[k].m_tolerance, read(lods[k].m_vertexIndex, lods[k].m_vertexCount) });
+                return shape;
+            }
+            /**
+             * \brief removes the object at a given dense index by moving the last object into its
+             *        place
+             * \param [in] i dense index of the object that is to be removed
+             */
+            void int_swapAndPop(size_t i) noexcept {
+                size_t const last = size() - 1;
+
+                if (i != last) {
+                    m_types[i]          = m_types[last];
+                    m_positions[i]      = m_positions[last];
+                    m_localPositions[i] = m_localPositions[last];
+                    m_colors[i]         = m_colors[last];
+                    m_shapes[i]         = std::move(m_shapes[last]);
+                    m_shapeRevs[i]      = m_shapeRevs[last];
+                    m_altitudes[i]      = m_altitudes[last];
+                    m_visibility[i]     = m_visibility[last];
+                    m_speeds[i]         = m_speeds[last];
+                    m_headings[i]       = m_headings[last];
+                    m_velocities[i]     = m_velocities[last];
+                    m_fixTimes[i]       = m_fixTimes[last];
+                    m_idents[i]         = std::move(m_idents[last]);
+                    m_cellKeys[i]       = m_cellKeys[last];
+                    m_denseToSlot[i]    = m_denseToSlot[last];
+
+                    /* Redirect the slot of the moved object. */
+                    m_slots[m_denseToSlot[i]].m_dense = static_cast<quint32>(i);
+                }
+
+                m_types.pop_back();
+                m_positions.pop_back();
+                m_localPositions.pop_back();
+                m_colors.pop_back();
+                m_shapes.pop_back();
+                m_shapeRevs.pop_back();
+                m_altitudes.pop_back();
+                m_visibility.pop_back();
+                m_speeds.pop_back();
+                m_headings.pop_back();
+                m_velocities.pop_back();
+                m_fixTimes.pop_back();
+                m_idents.pop_back();
+                m_cellKeys.pop_back();
+                m_denseToSlot.pop_back();
+            }
+            /**
+             * \brief marks a slot as unoccupied and bumps its generation
+             * \param [in,out] slot slot that is to be retired
+             */
+            static void int_retireSlot(Slot &slot) noexcept {
+                slot.m_isAlive = false;
+                /* Skip generation 0 on wrap-around as it's reserved for invalid handles. */
+                if (++slot.m_generation == 0)
+                    slot.m_generation = 1;
+            }
+            /**
+             * \brief releases an occupied slot and bumps its generation
+             * \param [in] index index of the slot that is to be released
+             * \note  If the slot cannot be added to the free-list (out of memory), it is simply
+             *        not reused.
+             */
+            void int_releaseSlot(quint32 index) noexcept {
+                int_retireSlot(m_slots[index]);
+
+                try {
+                    m_freeSlots.push_back(index);
+                } catch (...) { }
+            }
+        };
+        using ROM = RadarObjectManager;
+    }
+
+
+    /* update logs */
+    namespace priv {
+        static constexpr quint32 gl_LogMagic     = 0x52444654u; /**< "TFDR" when read as little-endian bytes */
+        static constexpr quint32 gl_LogVersion   = 2;           /**< update log format version; bumped on every encoding change */
+        static constexpr double  gl_LogPosScale  = 1e9;         /**< fixed-point units per degree of logged positions (about 0.1 mm) */
+        static constexpr size_t  gl_LogFlushSize = 64 * 1024;   /**< number of buffered bytes after which the log is written out */
+        static constexpr quint32 gl_LogMaxSlots  = 1u << 26;    /**< upper bound on logged slot indices (guards against corrupt logs) */
+        static constexpr qint64  gl_ReplaySliceNs = 4'000'000;  /**< wall time spent applying updates before yielding to the event loop (*Pace::Unthrottled*), in nanoseconds */
+
+        /*
+         * An update log is a header (magic, version) followed by records. Every record starts
+         * with the time since the previous record (in microseconds, as a varint) and an opcode.
+         * Objects are referred to by the slot index they had while recording; the replayer maps
+         * slot indices to its own handles. Positions are stored as fixed-point deltas to the
+         * last position logged for the same object (or vertex of the same shape), which keeps
+         * most position updates within a few bytes.
+         * 
+         * Integers are LEB128 varints (signed ones zigzag-encoded), floating-point numbers and
+         * fixed-size counts are stored in the byte order of the recording machine.
+         */
+
+        /**
+         * \enum  LogOp
+         * \brief record types of an update log
+         */
+        enum class LogOp : quint8 {
+            Add,            /**< object added: slot, type, position, altitude, identifier */
+            Remove,         /**< object removed: slot */
+            Clear,          /**< all objects removed */
+            ObjectProperty, /**< object property changed: slot, property, value */
+            ViewProperty,   /**< view property changed: property, value */
+            Batch,          /**< batch of typed updates: count, then slot, fields and values of each update */
+            Track,          /**< tracked object changed: slot */
+
+            __N__           /**< *only used internally* */
+        };
+
+        /**
+         * \brief  quantizes a position to the fixed-point units of update logs
+         * \param  [in] pos [lat, long] position
+         * \return fixed-point [lat, long] position
+         */
+        static std::array<qint64, 2> int_quantize(QPointF const &pos) noexcept {
+            return { std::llround(pos.x() * gl_LogPosScale), std::llround(pos.y() * gl_LogPosScale) };
+        }
+
+        /**
+         * \class UpdateLogWriter
+         * \brief encodes object and view updates into an append-only update log
+         * 
+         * Records are encoded into a buffer which is appended to the file whenever it grows past
+         * *gl_LogFlushSize*, so that recording does not touch the file system on every update.
+         * If anything fails (out of memory, file not writable), the writer stops recording; the
+         * log then ends with the last record that was written out completely.
+         */
+        class UpdateLogWriter {
+        public:
+            /**
+             * \brief constructs a writer for a given file
+             * \param [in] path path of the log file; see *open()*
+             */
+            explicit UpdateLogWriter(QString const &path)
+                : m_file(path)
+            { }
+            ~UpdateLogWriter() { close(); }
+
+            /**
+             * \brief  creates (or truncates) the log file and writes the header
+             * \return *true* on success, *false* if there was an error
+             */
+            bool open() noexcept {
+                try {
+                    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+                        return false;
+
+                    int_putRaw(gl_LogMagic);
+                    int_putRaw(gl_LogVersion);
+                    m_clock.start();
+                    return int_flush();
+                } catch (...) { }
+
+                return false;
+            }
+            /**
+             * \brief  writes out all buffered records and closes the file
+             * \return *true* if the log is complete, *false* if recording failed at some point
+             */
+            bool close() noexcept {
+                if (!m_file.isOpen())
+                    return !m_isFailed;
+
+                bool const isok = int_flush();
+                m_file.close();
+                return isok;
+            }
+            /**
+             * \brief  checks whether records are still being logged
+             * \return *true* if recording, *false* if the log was closed or recording failed
+             */
+            bool isRecording() const noexcept { return m_file.isOpen() && !m_isFailed; }
+
+            /**
+             * \defgroup records
+             * \brief    append a single record to the log
+             * \note     These functions never throw exceptions.
+             */
+            void add(quint32 slot, QString const &ident, ObjectRadar::ObjectType type, QPointF const &pos, float alt) noexcept {
+                int_record(LogOp::Add, [&]() {
+                    int_putVarint(slot);
+                    int_putVarint(static_cast<quint64>(type));
+                    /* Positions of new objects are encoded relative to the origin. */
+                    int_lastOf(slot) = {};
+                    int_putPosition(pos, int_lastOf(slot));
+                    int_putRaw(alt);
+                    int_putString(ident);
+                });
+            }
+            void remove(quint32 slot) noexcept {
+                int_record(LogOp::Remove, [&]() { int_putVarint(slot); });
+            }
+            void clear() noexcept {
+                int_record(LogOp::Clear, []() { });
+            }
+            void objectProperty(quint32 slot, ObjectRadar::Property prop, QVariant const &val) noexcept {
+                int_record(LogOp::ObjectProperty, [&]() {
+                    int_putVarint(slot);
+                    int_putRaw(static_cast<quint8>(prop));
+                    int_putValue(prop, val, int_lastOf(slot));
+                });
+            }
+            /**
+             * \brief logs the geometry of an area or path object
+             * \param [in] slot slot index of the object
+             * \param [in] prop *Property::Area* or *Property::Path*
+             * \param [in] shape new geometry
+             */
+            void shape(quint32 slot, ObjectRadar::Property prop, Shape const &shape) noexcept {
+                int_record(LogOp::ObjectProperty, [&]() {
+                    int_putVarint(slot);
+                    int_putRaw(static_cast<quint8>(prop));
+                    int_putRaw(static_cast<quint8>(shape.m_isSmooth));
+                    int_putVarint(shape.m_vertices.size());
+
+                    std::array<qint64, 2> last = {};
+                    for (QPointF const &v : shape.m_vertices)
+                        int_putPosition(v, last);
+                });
+            }
+            void viewProperty(ObjectRadar::Property prop, QVariant const &val) noexcept {
+                int_record(LogOp::ViewProperty, [&]() {
+                    int_putRaw(static_cast<quint8>(prop));
+                    int_putValue(prop, val, m_lastCenter);
+                });
+            }
+            /**
+             * \brief logs the tracked object
+             * \param [in] slot slot index of the tracked object
+             */
+            void track(quint32 slot) noexcept {
+                int_record(LogOp::Track, [&]() { int_putVarint(slot); });
+            }
+            /**
+             * \brief starts a batch of typed updates; see *update()* and *endBatch()*
+             */
+            void beginBatch() noexcept {
+                m_batchStart = m_buffer.size();
+                m_batchSize  = 0;
+                if (!isRecording())
+                    return;
+
+                try {
+                    int_putHead(LogOp::Batch);
+                    m_batchCountAt = m_buffer.size();
+                    int_putRaw(quint32{ 0 }); /* Patched by *endBatch()*. */
+                } catch (...) { int_fail(m_batchStart); }
+            }
+            /**
+             * \brief adds an update to the current batch
+             * \param [in] slot slot index of the updated object
+             * \param [in] upd update that was applied
+             */
+            void update(quint32 slot, ObjectRadar::ObjectUpdate const &upd) noexcept {
+                if (!isRecording())
+                    return;
+
+                try {
+                    int_putVarint(slot);
+                    int_putRaw(static_cast<quint8>(upd.m_fields));
+                    if (upd.m_fields & ObjectRadar::ObjectUpdate::Position)
+                        int_putPosition(upd.m_position, int_lastOf(slot));
+                    if (upd.m_fields & ObjectRadar::ObjectUpdate::Altitude)
+                        int_putRaw(upd.m_altitude);
+                    if (upd.m_fields & ObjectRadar::ObjectUpdate::Visibility)
+                        int_putRaw(static_cast<quint8>(upd.m_isVisible));
+                    if (upd.m_fields & ObjectRadar::ObjectUpdate::Motion) {
+                        int_putRaw(upd.m_groundSpeed);
+                        int_putRaw(upd.m_heading);
+                    }
+                    m_batchSize++;
+                } catch (...) { int_fail(m_batchStart); }
+            }
+            /**
+             * \brief completes the current batch; empty batches are dropped
+             */
+            void endBatch() noexcept {
+                if (!isRecording())
+                    return;
+                if (m_batchSize == 0) {
+                    m_buffer.resize(m_batchStart);
+
+                    return;
+                }
+
+                std::memcpy(m_buffer.data() + m_batchCountAt, &m_batchSize, sizeof(quint32));
+                int_endRecord();
+            }
+
+        private:
+            QFile                              m_file;              /**< log file */
+            QElapsedTimer                      m_clock;             /**< time since the log was opened */
+            qint64                             m_lastTime   = 0;    /**< time of the last record, in microseconds */
+            std::vector<uchar>                 m_buffer;            /**< records not written out yet */
+            std::vector<std::array<qint64, 2>> m_lastPos;           /**< last logged fixed-point position, by slot index */
+            std::array<qint64, 2>              m_lastCenter = {};   /**< last logged fixed-point radar center */
+            size_t                             m_batchStart = 0;    /**< buffer size before the current batch */
+            size_t                             m_batchCountAt = 0;  /**< buffer offset of the update count of the current batch */
+            quint32                            m_batchSize  = 0;    /**< number of updates in the current batch */
+            bool                               m_isFailed   = false; /**< whether or not recording failed */
+
+            /**
+             * \brief appends a complete record
+             * \param [in] op record type
+             * \param [in] body callback encoding the record body; may throw
+             */
+            template<class Body>
+            void int_record(LogOp op, Body const &body) noexcept {
+                if (!isRecording())
+                    return;
+
+                size_t const start = m_buffer.size();
+                try {
+                    int_putHead(op);
+                    body();
+                } catch (...) {
+                    int_fail(start);
+
+                    return;
+                }
+                int_endRecord();
+            }
+            /**
+             * \brief stops recording after a record could not be encoded
+             * \param [in] start buffer size before the record; the partial record is discarded so
+             *        that the buffered records can still be written out by *close()*
+             */
+            void int_fail(size_t start) noexcept {
+                m_isFailed = true;
+                m_buffer.resize(std::min(start, m_buffer.size()));
+            }
+            /**
+             * \brief appends the time and opcode of a record
+             * \param [in] op record type
+             */
+            void int_putHead(LogOp op) {
+                qint64 const now = m_clock.nsecsElapsed() / 1000;
+
+                int_putVarint(static_cast<quint64>(std::max<qint64>(now - m_lastTime, 0)));
+                int_putRaw(static_cast<quint8>(op));
+                m_lastTime = std::max(now, m_lastTime);
+            }
+            /**
+             * \brief writes out the buffer if it's full, at a record boundary
+             */
+            void int_endRecord() noexcept {
+                if (m_buffer.size() >= gl_LogFlushSize)
+                    int_flush();
+            }
+            /**
+             * \brief  appends the buffer to the file
+             * \return *true* on success, *false* if recording failed
+             */
+            bool int_flush() noexcept {
+                if (!m_buffer.empty()) {
+                    qint64 const size = static_cast<qint64>(m_buffer.size());
+                    if (m_file.write(reinterpret_cast<char const *>(m_buffer.data()), size) != size || !m_file.flush())
+                        m_isFailed = true;
+
+                    m_buffer.clear();
+                }
+                return !m_isFailed;
+            }
+            /**
+             * \brief  retrieves the last logged position of an object
+             * \param  [in] slot slot index of the object
+             * \return fixed-point position
+             * \note   This function may throw *std::bad_alloc*.
+             */
+            std::array<qint64, 2> &int_lastOf(quint32 slot) {
+                if (slot >= m_lastPos.size())
+                    m_lastPos.resize(slot + 1);
+
+                return m_lastPos[slot];
+            }
+
+            /**
+             * \defgroup encoders
+             * \brief    append a value to the buffer
+             * \note     These functions may throw *std::bad_alloc*.
+             */
+            template<class T>
+            void int_putRaw(T const &val) {
+                static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable values can be stored raw");
+
+                uchar const *bytes = reinterpret_cast<uchar const *>(&val);
+                m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+            }
+            void int_putVarint(quint64 val) {
+                for (; val >= 0x80; val >>= 7)
+                    m_buffer.push_back(static_cast<uchar>(val | 0x80));
+                m_buffer.push_back(static_cast<uchar>(val));
+            }
+            void int_putSigned(qint64 val) {
+                int_putVarint((static_cast<quint64>(val) << 1) ^ static_cast<quint64>(val >> 63));
+            }
+            void int_putPosition(QPointF const &pos, std::array<qint64, 2> &last) {
+                std::array<qint64, 2> const q = int_quantize(pos);
+
+                int_putSigned(q[0] - last[0]);
+                int_putSigned(q[1] - last[1]);
+                last = q;
+            }
+            void int_putString(QString const &str) {
+                int_putVarint(static_cast<quint64>(str.size()));
+
+                uchar const *bytes = reinterpret_cast<uchar const *>(str.utf16());
+                m_buffer.insert(m_buffer.end(), bytes, bytes + str.size() * sizeof(char16_t));
+            }
+            void int_putColor(QColor const &col) {
+                int_putRaw(static_cast<quint8>(col.isValid()));
+                if (col.isValid())
+                    int_putRaw(static_cast<quint64>(col.rgba64()));
+            }
+            /**
+             * \brief encodes a property value according to the type of the property
+             * \param [in] prop property index
+             * \param [in] val value; must have passed *int_isValidPropertyValue()*
+             * \param [in,out] last reference for delta-encoding point values
+             * \note  Geometries are logged via *shape()* instead.
+             */
+            void int_putValue(ObjectRadar::Property prop, QVariant const &val, std::array<qint64, 2> &last) {
+                switch (gl_PropertyTypeLUT[static_cast<size_t>(prop)].m_type) {
+                    case QMetaType::Float:   int_putRaw(val.toFloat());              break;
+                    case QMetaType::Int:     int_putSigned(val.toInt());             break;
+                    case QMetaType::Bool:    int_putRaw(static_cast<quint8>(val.toBool())); break;
+                    case QMetaType::QColor:  int_putColor(val.value<QColor>());      break;
+                    case QMetaType::QPointF: int_putPosition(val.toPointF(), last);  break;
+                    case QMetaType::QString: int_putString(val.toString());          break;
+                    case QMetaType::QSizeF:
+                        int_putRaw(val.toSizeF().width());
+                        int_putRaw(val.toSizeF().height());
+                        break;
+                    case gl_FPType: {
+                        FontProperties const font = val.value<FontProperties>();
+
+                        int_putString(font.m_family);
+                        int_putSigned(font.m_pointSize);
+                        int_putSigned(font.m_weight);
+                        int_putRaw(static_cast<quint8>(font.m_isItalic));
+                        break;
+                    }
+                    default:
+                        throw std::invalid_argument("property cannot be logged");
+                }
+            }
+        };
+
+        /**
+         * \class UpdateLogReader
+         * \brief decodes the values of an update log
+         * 
+         * Reading past the end of the log yields zero values and marks the reader as invalid
+         * instead of failing each read individually; check *isValid()* after each record.
+         */
+        class UpdateLogReader {
+        public:
+            UpdateLogReader() noexcept = default;
+            /**
+             * \brief constructs a reader for a range of bytes
+             * \param [in] begin first byte
+             * \param [in] end one past the last byte
+             */
+            UpdateLogReader(uchar const *begin, uchar const *end) noexcept
+                : m_pos(begin), m_end(end)
+            { }
+
+            /**
+             * \brief  checks whether all reads so far stayed within the log
+             * \return *true* if valid, *false* if the log was truncated or malformed
+             */
+            bool isValid() const noexcept { return m_isValid; }
+            /**
+             * \brief  checks whether the whole log was read
+             * \return *true* if there are no more bytes, *false* if not
+             */
+            bool atEnd() const noexcept { return m_pos == m_end; }
+            /**
+             * \brief marks the log as malformed
+             */
+            void fail() noexcept { m_isValid = false; m_pos = m_end; }
+
+            /**
+             * \defgroup decoders
+             * \brief    read a value and advance
+             */
+            template<class T>
+            T raw() noexcept {
+                T val{};
+                if (static_cast<size_t>(m_end - m_pos) < sizeof(T)) {
+                    fail();
+
+                    return val;
+                }
+                std::memcpy(&val, m_pos, sizeof(T));
+                m_pos += sizeof(T);
+                return val;
+            }
+            quint64 varint() noexcept {
+                quint64 val = 0;
+                for (int shift = 0; shift < 64; shift += 7) {
+                    if (m_pos == m_end)
+                        break;
+
+                    uchar const b = *m_pos++;
+                    val |= static_cast<quint64>(b & 0x7f) << shift;
+                    if ((b & 0x80) == 0)
+                        return val;
+                }
+                fail();
+                return 0;
+            }
+            qint64 signedVarint() noexcept {
+                quint64 const val = varint();
+
+                return static_cast<qint64>(val >> 1) ^ -static_cast<qint64>(val & 1);
+            }
+            QPointF position(std::array<qint64, 2> &last) noexcept {
+                last[0] += signedVarint();
+                last[1] += signedVarint();
+
+                return QPointF{ last[0] / gl_LogPosScale, last[1] / gl_LogPosScale };
+            }
+            /**
+             * \note This function may throw *std::bad_alloc*.
+             */
+            QString string() {
+                quint64 const n = varint();
+                if (n > static_cast<quint64>(m_end - m_pos) / sizeof(char16_t)) {
+                    fail();
+
+                    return QString{};
+                }
+
+                QString const str{ reinterpret_cast<QChar const *>(m_pos), static_cast<qsizetype>(n) };
+                m_pos += n * sizeof(char16_t);
+                return str;
+            }
+            QColor color() noexcept {
+                if (raw<quint8>() == 0)
+                    return QColor{};
+
+                return QColor::fromRgba64(QRgba64::fromRgba64(raw<quint64>()));
+            }
+            /**
+             * \brief  decodes a property value according to the type of the property
+             * \param  [in] prop property index
+             * \param  [in,out] last reference for delta-decoding point values
+             * \return value, or an invalid variant if the property cannot be logged
+             * \note   This function may throw *std::bad_alloc*.
+             */
+            QVariant value(ObjectRadar::Property prop, std::array<qint64, 2> &last) {
+                switch (gl_PropertyTypeLUT[static_cast<size_t>(prop)].m_type) {
+                    case QMetaType::Float:   return QVariant(raw<float>());
+                    case QMetaType::Int:     return QVariant(static_cast<int>(signedVarint()));
+                    case QMetaType::Bool:    return QVariant(raw<quint8>() != 0);
+                    case QMetaType::QColor:  return QVariant::fromValue(color());
+                    case QMetaType::QPointF: return QVariant(position(last));
+                    case QMetaType::QString: return QVariant(string());
+                    case QMetaType::QSizeF: {
+                        double const w = raw<double>();
+
+                        return QVariant(QSizeF{ w, raw<double>() });
+                    }
+                    case gl_FPType: {
+                        QString const family = string();
+                        int const     pt     = static_cast<int>(signedVarint());
+                        int const     weight = static_cast<int>(signedVarint());
+
+                        return QVariant::fromValue(FontProperties{ family, pt, weight, raw<quint8>() != 0 });
+                    }
+                }
+
+                fail();
+                return gl_InvVariant;
+            }
+
+        private:
+            uchar const *m_pos     = nullptr; /**< next byte */
+            uchar const *m_end     = nullptr; /**< one past the last byte */
+            bool         m_isValid = true;    /**< whether or not all reads stayed within the log */
+        };
+    }
+
+
+    /* miscellaneous internal functions used by the radar */
+    namespace priv {
+        /**
+         * \brief tries to (re-)initialize internal repaint timer
+         *
+         * When the widget is constructed, the repaint timer is initialized with the initial
+         * (default) update-rate (60hz). When the update rate is changed in response to a call
+         * to ObjectRadar::setProperty(), this function is called again on the running timer
+         * to make sure it's updated properly. Using this simplistic approach, depending on the
+         * ratio between the old and the new update rate, there might be a small lag between the
+         * last frame ratio using the old update rate and the first frame using the new update
+         * rate.
+         * 
+         * \param [in] updpersec new updates per second, in 1/f seconds
+         * \param [out] timer pointer to timer object to modify
+         * \note  If **timer** is *nullptr* or the timer is already running with the new update
+         *        interval, the function does nothing.
+         * \note  This is only used in *RedrawMode::FixedRate*.
+         */
+        static void int_tryInitializeRepaintTimer(float const updpersec, QTimer *timer) noexcept {
+            /* Calculate new interval. */
+            auto const ninterval = std::chrono::duration<float, std::milli>(1000.f / updpersec).count();
+            /*
+             * If the timer object is invalid or the new interval equals to the new interval,
+             * do nothing.
+             */
+            if (timer == nullptr || (timer->isActive() && timer->interval() == ninterval))
+                return;
+
+            /* Update interval and restart. */
+            timer->stop();
+            timer->setSingleShot(false);
+            timer->setInterval(ninterval);
+            timer->start();
+        }
+
+        /**
+         * \brief  creates a font from a set of font properties
+         * 
+         * If the font family refers to a font file (e.g., a resource path such as the default
+         * *:/fonts/B612_Mono.ttf*), the file is registered with the application font database
+         * once and the resulting family is used.
+         * 
+         * \param  [in] props font properties
+         * \return font matching the given properties as closely as possible
+         */
+        static QFont int_makeFont(FontProperties const &props) {
+            static std::unordered_map<QString, QString> famCache; /**< font file to family name */
+
+            QString family = props.m_family;
+            if (family.startsWith(":/") || family.endsWith(".ttf") || family.endsWith(".otf")) {
+                auto it = famCache.find(family);
+                if (it == famCache.end()) {
+                    QStringList const fams = QFontDatabase::applicationFontFamilies(QFontDatabase::addApplicationFont(family));
+
+                    it = famCache.insert({ family, fams.isEmpty() ? QString{} : fams.at(0) }).first;
+                }
+
+                family = it->second;
+            }
+
+            QFont font{ family };
+            if (props.m_pointSize > 0)
+                font.setPointSize(props.m_pointSize);
+            if (props.m_weight > 0)
+                font.setWeight(static_cast<QFont::Weight>(props.m_weight));
+            font.setItalic(props.m_isItalic);
+            return font;
+        }
+        /**
+         * \brief  formats a distance for display on the radar scale
+         * \param  [in] meters distance, in meters
+         * \return formatted distance (meters below 1 km, kilometers otherwise)
+         */
+        static QString int_formatDistance(double meters) {
+            if (meters < 1000.)
+                return QString("%1 m").arg(meters, 0, 'f', meters < 10. ? 1 : 0);
+
+            return QString("%1 km").arg(meters / 1000., 0, 'f', meters < 10000. ? 1 : 0);
+        }
+        /**
+         * \brief  allocates a transparent pixmap matching the widget size and pixel ratio
+         * \param  [in] size widget size, in pixels
+         * \param  [in] dpr device pixel ratio
+         * \return new pixmap
+         */
+        static QPixmap int_makeLayer(QSize const &size, qreal dpr) {
+            QPixmap layer{ size * dpr };
+
+            layer.setDevicePixelRatio(dpr);
+            layer.fill(Qt::transparent);
+            return layer;
+        }
+
+        /**
+         * \brief  pre-renders the compass rose (bearing ticks and labels around the radar view)
+         * \param  [out] target pixmap receiving the rendered layer
+         * \param  [in] params projection parameters (radar view origin and radius)
+         * \param  [in] size widget size, in pixels
+         * \param  [in] dpr device pixel ratio
+         * \param  [in] fg foreground color used for ticks and labels
+         * \param  [in] font font used for the labels
+         * \return *true* if the layer was rendered, *false* if there was an error
+         * \note   The layer has a transparent background and is drawn on top of all objects.
+         */
+        static bool int_drawCompass(QPixmap &target, ProjectionParams const &params, QSize const &size, qreal dpr, QColor const &fg, QFont const &font) noexcept {
+            try {
+                target = int_makeLayer(size, dpr);
+
+                QPainter painter(&target);
+                if (!painter.isActive())
+                    return false;
+                painter.setRenderHint(QPainter::Antialiasing);
+                painter.setFont(font);
+                painter.setPen(QPen{ fg, 1. });
+
+                QFontMetricsF const fm{ font };
+                double const        r = params.m_radius;
+                for (int deg = 0; deg < 360; deg += 5) {
+                    double const rad = deg * gl_PI / 180.;
+                    double const len = deg % 30 == 0 ? 10. : (deg % 10 == 0 ? 6. : 3.);
+                    QPointF const dir{ std::sin(rad), -std::cos(rad) };
+
+                    painter.drawLine(params.m_origin + dir * r, params.m_origin + dir * (r + len));
+                    if (deg % 30 != 0)
+                        continue;
+
+                    /* Label cardinal directions by letter, everything else by tens of degrees. */
+                    QString const text = deg % 90 == 0 ? QString{ "NESW"[deg / 90] } : QString::number(deg / 10);
+                    QPointF const pos  = params.m_origin + dir * (r + len + fm.height() * 0.75);
+                    QSizeF const  ext{ fm.horizontalAdvance(text), fm.height() };
+
+                    painter.drawText(QRectF{ pos - QPointF{ ext.width() / 2., ext.height() / 2. }, ext }, Qt::AlignCenter, text);
+                }
+
+                return true;
+            } catch (...) { }
+
+            return false;
+        }
+        /**
+         * \brief  pre-renders the radar scale (background, range rings and their labels)
+         * \param  [out] target pixmap receiving the rendered layer
+         * \param  [in] params projection parameters (radar view origin, radius and scale)
+         * \param  [in] range radar range {min, max}, in meters
+         * \param  [in] size widget size, in pixels
+         * \param  [in] dpr device pixel ratio
+         * \param  [in] fg foreground color used for rings and labels
+         * \param  [in] bg background color
+         * \param  [in] font font used for the labels
+         * \return *true* if the layer was rendered, *false* if there was an error
+         * \note   The layer is opaque and replaces the background fill of the widget.
+         */
+        static bool int_drawScale(QPixmap &target, ProjectionParams const &params, QSizeF const &range, QSize const &size, qreal dpr, QColor const &fg, QColor const &bg, QFont const &font) noexcept {
+            try {
+                target = int_makeLayer(size, dpr);
+                target.fill(bg);
+
+                QPainter painter(&target);
+                if (!painter.isActive())
+                    return false;
+                painter.setRenderHint(QPainter::Antialiasing);
+                painter.setFont(font);
+                painter.setBrush(Qt::NoBrush);
+
+                QPointF const o = params.m_origin;
+                double const  r = params.m_radius;
+
+                /* Crosshair. */
+                QColor faint = fg;
+                faint.setAlpha(fg.alpha() / 3);
+                painter.setPen(QPen{ faint, 1. });
+                painter.drawLine(o - QPointF{ r, 0. }, o + QPointF{ r, 0. });
+                painter.drawLine(o - QPointF{ 0., r }, o + QPointF{ 0., r });
+
+                /* Minimum range. */
+                if (range.width() > 0. && range.width() < range.height()) {
+                    double const rmin = range.width() * params.m_pxPerMeter;
+
+                    painter.setPen(QPen{ faint, 1., Qt::DashLine });
+                    painter.drawEllipse(o, rmin, rmin);
+                }
+
+                /* Range rings, labelled with their distance from the center. */
+                QFontMetricsF const fm{ font };
+                for (int k = 1; k <= gl_RangeRings; k++) {
+                    double const rk = r * k / gl_RangeRings;
+
+                    painter.setPen(QPen{ k == gl_RangeRings ? fg : faint, 1. });
+                    painter.drawEllipse(o, rk, rk);
+
+                    painter.setPen(fg);
+                    painter.drawText(o + QPointF{ 3., -rk + fm.ascent() + 1. }, int_formatDistance(range.height() * k / gl_RangeRings));
+                }
+
+                return true;
+            } catch (...) { }
+
+            return false;
+        }
+    }
+
+    /* icon sprites */
+    namespace priv {
+        static constexpr qreal gl_SpriteSize    = 2. * gl_MarkerRadius; /**< logical size of an icon sprite, in pixels */
+        static constexpr int   gl_AtlasColumns  = 16;                   /**< number of sprites per atlas row */
+        static constexpr int   gl_MaxSprites    = 1024;                 /**< number of sprites after which the atlas is rebuilt from scratch */
+        static constexpr float gl_AltitudeLevel = 30.f;                 /**< maximum altitude difference to the radar center for an object to count as level, in meters */
+
+        /**
+         * \enum  AltitudeBand
+         * \brief altitude of an object relative to the radar center, as shown by its icon
+         */
+        enum class AltitudeBand : quint8 {
+            Unknown, /**< no altitude (*NaN*) */
+            Below,   /**< more than *gl_AltitudeLevel* below the radar center */
+            Level,   /**< within *gl_AltitudeLevel* of the radar center */
+            Above    /**< more than *gl_AltitudeLevel* above the radar center */
+        };
+
+        /**
+         * \brief  classifies the altitude of an object relative to the radar center
+         * \param  [in] alt altitude of the object, in meters above sea-level
+         * \param  [in] ref altitude of the radar center, in meters above sea-level
+         * \return altitude band
+         */
+        static AltitudeBand int_altitudeBand(float alt, float ref) noexcept {
+            if (std::isnan(alt))
+                return AltitudeBand::Unknown;
+
+            float const d = alt - ref;
+            return d > gl_AltitudeLevel ? AltitudeBand::Above : (d < -gl_AltitudeLevel ? AltitudeBand::Below : AltitudeBand::Level);
+        }
+        /**
+         * \brief draws the icon of an object
+         * \param [in,out] painter painter to draw with
+         * \param [in] center center of the icon, in logical pixels
+         * \param [in] type object type
+         * \param [in] band altitude band of the object
+         * \param [in] col icon color
+         */
+        static void int_drawIcon(QPainter &painter, QPointF const &c, ObjectRadar::ObjectType type, AltitudeBand band, QColor const &col) {
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(col);
+
+            switch (type) {
+                case ObjectRadar::ObjectType::Vehicle:
+                    /* Chevron. */
+                    painter.drawPolygon(QPolygonF{ { c + QPointF{ 0., -4.5 }, c + QPointF{ 4., 4. }, c + QPointF{ 0., 2. }, c + QPointF{ -4., 4. } } });
+                    break;
+                case ObjectRadar::ObjectType::Person:
+                    /* Dot with ring. */
+                    painter.drawEllipse(c, 2., 2.);
+                    painter.setPen(QPen{ col, 1. });
+                    painter.setBrush(Qt::NoBrush);
+                    painter.drawEllipse(c, 4., 4.);
+                    break;
+                default:
+                    /* Diamond. */
+                    painter.drawPolygon(QPolygonF{ { c + QPointF{ 0., -4. }, c + QPointF{ 4., 0. }, c + QPointF{ 0., 4. }, c + QPointF{ -4., 0. } } });
+                    break;
+            }
+
+            /* Altitude indicator: small arrow in the top-right (above) or bottom-right (below) corner. */
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(col);
+            if (band == AltitudeBand::Above)
+                painter.drawPolygon(QPolygonF{ { c + QPointF{ 6., -7. }, c + QPointF{ 8., -4. }, c + QPointF{ 4., -4. } } });
+            else if (band == AltitudeBand::Below)
+                painter.drawPolygon(QPolygonF{ { c + QPointF{ 6., 7. }, c + QPointF{ 8., 4. }, c + QPointF{ 4., 4. } } });
+        }
+
+        /**
+         * \class SpriteAtlas
+         * \brief lazily filled atlas of pre-rasterized object icons
+         * 
+         * Every combination of (type, altitude band, color) that is drawn is rasterized once into
+         * a cell of a single pixmap, at the device pixel ratio of the widget. Drawing an object
+         * then is a blit from the atlas, and all objects can be drawn with a single call to
+         * *QPainter::drawPixmapFragments()* (or a single instanced draw on the GPU).
+         * 
+         * Cells never move once allocated, so source rectangles stay valid when the atlas grows.
+         * All views of a scene with the same device pixel ratio share one atlas (see
+         * *RadarScenePrivate::sprites()*).
+         */
+        class SpriteAtlas {
+        public:
+            /**
+             * \brief discards all sprites
+             * \param [in] dpr device pixel ratio used for all future sprites
+             */
+            void reset(qreal dpr) noexcept {
+                m_dpr   = dpr;
+                m_atlas = QPixmap{};
+                m_cells.clear();
+                m_revision = int_nextRevision();
+            }
+            /**
+             * \brief discards all sprites if the atlas holds more than *gl_MaxSprites* sprites
+             * \note  Call this only between frames since it invalidates all source rectangles.
+             */
+            void trim() noexcept {
+                if (m_cells.size() > static_cast<size_t>(gl_MaxSprites))
+                    reset(m_dpr);
+            }
+            /**
+             * \brief  retrieves the sprite of an icon, rasterizing it if it isn't in the atlas yet
+             * \param  [in] type object type
+             * \param  [in] band altitude band of the object
+             * \param  [in] col icon color
+             * \return source rectangle of the sprite in the atlas, in device pixels, or an empty
+             *         optional if the sprite could not be created
+             * \note   This function never throws exceptions.
+             */
+            std::optional<QRectF> get(ObjectRadar::ObjectType type, AltitudeBand band, QColor const &col) noexcept {
+                try {
+                    quint64 const key = static_cast<quint64>(col.rgba())
+                        | static_cast<quint64>(band) << 32
+                        | static_cast<quint64>(type) << 40;
+
+                    auto it = m_cells.find(key);
+                    if (it == m_cells.end()) {
+                        int const cell = static_cast<int>(m_cells.size());
+                        if (!int_reserve(cell + 1))
+                            return std::optional<QRectF>{};
+
+                        QPainter painter(&m_atlas);
+                        painter.setRenderHint(QPainter::Antialiasing);
+                        int_drawIcon(painter, int_cellOrigin(cell) + QPointF{ gl_SpriteSize / 2., gl_SpriteSize / 2. }, type, band, col);
+
+                        it = m_cells.insert({ key, cell }).first;
+                        m_revision = int_nextRevision();
+                    }
+
+                    return std::optional<QRectF>(QRectF{ int_cellOrigin(it->second) * m_dpr, QSizeF{ gl_SpriteSize, gl_SpriteSize } * m_dpr });
+                } catch (...) { }
+
+                return std::optional<QRectF>{};
+            }
+
+            qreal dpr() const noexcept            { return m_dpr; }
+            QPixmap const &pixmap() const noexcept { return m_atlas; }
+            /**
+             * \brief  retrieves a counter that changes whenever the atlas pixmap changes
+             * \return revision of the atlas; unique across all atlases, so that a view switching
+             *         atlases never mistakes one for another
+             */
+            quint64 revision() const noexcept      { return m_revision; }
+
+        private:
+            qreal                            m_dpr      = 1.; /**< device pixel ratio of all sprites */
+            QPixmap                          m_atlas;         /**< atlas pixmap */
+            std::unordered_map<quint64, int> m_cells;         /**< sprite key to cell index map */
+            quint64                          m_revision = 0;  /**< atlas revision */
+
+            /**
+             * \brief  issues a new atlas revision
+             * \return revision that was never issued before, to any atlas
+             * \note   Atlases are only used on the GUI thread.
+             */
+            static quint64 int_nextRevision() noexcept {
+                static quint64 counter = 0;
+
+                return ++counter;
+            }
+            /**
+             * \brief  calculates the logical top-left corner of a cell
+             * \param  [in] cell cell index
+             * \return top-left corner, in logical pixels
+             */
+            static QPointF int_cellOrigin(int cell) noexcept {
+                return QPointF{ (cell % gl_AtlasColumns) * gl_SpriteSize, (cell / gl_AtlasColumns) * gl_SpriteSize };
+            }
+            /**
+             * \brief  makes sure the atlas has room for a given number of cells
+             * \param  [in] n number of cells
+             * \return *true* if there is enough room, *false* if the atlas could not be grown
+             * \note   The atlas grows by doubling its number of rows; existing cells are copied.
+             */
+            bool int_reserve(int n) {
+                int const rows = (n + gl_AtlasColumns - 1) / gl_AtlasColumns;
+                int const have = m_atlas.isNull() ? 0 : static_cast<int>(m_atlas.height() / m_dpr / gl_SpriteSize + 0.5);
+                if (rows <= have)
+                    return true;
+
+                int const nrows = std::max({ rows, 2 * have, 1 });
+                QPixmap   atlas{ QSize{ gl_AtlasColumns, nrows } * (gl_SpriteSize * m_dpr) };
+                if (atlas.isNull())
+                    return false;
+                atlas.setDevicePixelRatio(m_dpr);
+                atlas.fill(Qt::transparent);
+
+                if (!m_atlas.isNull()) {
+                    QPainter painter(&atlas);
+
+                    painter.drawPixmap(0, 0, m_atlas);
+                }
+                m_atlas = std::move(atlas);
+                return true;
+            }
+        };
+    }
+
+    /* area and path geometry */
+    namespace priv {
+        /**
+         * \struct ShapeGeometry
+         * \brief  screen-space geometry of an area or path object, cached between frames
+         * \note   Outline and triangles are immutable once built and are replaced as a whole, so
+         *         that scenes of the threaded backend can share them with the cache.
+         */
+        struct ShapeGeometry {
+            quint64                                     m_shapeRev = 0;     /**< shape revision the geometry was built from */
+            quint64                                     m_viewRev  = 0;     /**< view revision (center, range, size) the geometry was built for */
+            std::shared_ptr<QPolygonF const>            m_outline;          /**< projected and curve-flattened outline (closed for areas); never null once built */
+            bool                                        m_isCulled = false; /**< whether or not *m_outline* was left empty because the shape was outside of the view */
+            QRectF                                      m_bounds;           /**< bounding rectangle of *m_outline* */
+            std::shared_ptr<std::vector<QPointF> const> m_triangles;        /**< triangulated fill (three points per triangle; areas only), or *nullptr* until triangulated */
+        };
+
+        /**
+         * \brief  projects and flattens the geometry of an area or path
+         * 
+         * If the shape is smooth, the vertices are joined by cubic bezier curves (Catmull-Rom
+         * splines through all vertices) which are then flattened into line segments so that
+         * drawing never has to evaluate curves.
+         * 
+         * \param  [in] params projection parameters
+         * \param  [in] vertices vertices in order, in [lat, long] coordinates
+         * \param  [in] issmooth whether or not vertices are joined by cubic bezier curves
+         * \param  [in] isclosed whether the shape is closed (area) or open (path)
+         * \return outline in screen coordinates; closed outlines repeat the first point at the end
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        static QPolygonF int_flattenShape(ProjectionParams const &params, std::vector<QPointF> const &vertices, bool issmooth, bool isclosed) {
+            qsizetype const n = static_cast<qsizetype>(vertices.size());
+
+            QPolygonF pts(n);
+            int_projectPositions(params, vertices.data(), pts.data(), static_cast<size_t>(n));
+            if (!issmooth || n < 3) {
+                if (isclosed && n > 0)
+                    pts.push_back(pts.front());
+
+                return pts;
+            }
+
+            /* Wrap around for closed shapes, clamp at the ends for open ones. */
+            auto const at = [&](qsizetype k) -> QPointF const & {
+                return pts[isclosed ? (k % n + n) % n : std::clamp<qsizetype>(k, 0, n - 1)];
+            };
+            QPainterPath path{ pts.front() };
+            for (qsizetype k = 0; k < (isclosed ? n : n - 1); k++)
+                path.cubicTo(at(k) + (at(k + 1) - at(k - 1)) / 6., at(k + 1) - (at(k + 2) - at(k)) / 6., at(k + 1));
+
+            QList<QPolygonF> const polys = path.toSubpathPolygons();
+            return polys.isEmpty() ? pts : polys.front();
+        }
+        /**
+         * \brief  triangulates a simple polygon by ear clipping
+         * \param  [in] poly polygon; a repeated first point at the end is ignored
+         * \param  [out] out receives the triangles (three points per triangle, appended)
+         * \return *true* if the polygon could be triangulated, *false* if it has less than three
+         *         vertices or is not simple (self-intersecting)
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        static bool int_triangulate(QPolygonF const &poly, std::vector<QPointF> &out) {
+            qsizetype n = poly.size();
+            if (n > 1 && poly.front() == poly.back())
+                --n;
+            if (n < 3)
+                return false;
+
+            auto const cross = [](QPointF const &a, QPointF const &b, QPointF const &c) {
+                return (b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x());
+            };
+
+            /* Normalize winding so that convex corners have a positive cross product. */
+            double area = 0.;
+            for (qsizetype k = 0; k < n; k++)
+                area += poly[k].x() * poly[(k + 1) % n].y() - poly[(k + 1) % n].x() * poly[k].y();
+            std::vector<qsizetype> idx(static_cast<size_t>(n));
+            for (qsizetype k = 0; k < n; k++)
+                idx[k] = area >= 0. ? k : n - 1 - k;
+
+            size_t const first = out.size();
+            size_t       k     = 0;
+            size_t       tries = 0;
+            while (idx.size() > 3) {
+                size_t const m = idx.size();
+                if (tries++ > m) {
+                    /* Went around once without finding an ear. */
+                    out.resize(first);
+
+                    return false;
+                }
+
+                QPointF const &a = poly[idx[(k + m - 1) % m]];
+                QPointF const &b = poly[idx[k % m]];
+                QPointF const &c = poly[idx[(k + 1) % m]];
+                bool isear = cross(a, b, c) > 0.;
+
+                /* Only reflex vertices can lie inside an ear. */
+                for (size_t q = 0; isear && q < m; q++) {
+                    QPointF const &p = poly[idx[q]];
+                    if (&p == &a || &p == &b || &p == &c || cross(poly[idx[(q + m - 1) % m]], p, poly[idx[(q + 1) % m]]) > 0.)
+                        continue;
+
+                    isear = !(cross(a, b, p) >= 0. && cross(b, c, p) >= 0. && cross(c, a, p) >= 0.);
+                }
+                if (!isear) {
+                    k = (k + 1) % m;
+
+                    continue;
+                }
+
+                out.insert(out.end(), { a, b, c });
+                idx.erase(idx.begin() + static_cast<ptrdiff_t>(k % m));
+                k     = k % (m - 1);
+                tries = 0;
+            }
+
+            out.insert(out.end(), { poly[idx[0]], poly[idx[1]], poly[idx[2]] });
+            return true;
+        }
+    }
+
+    /* frame arena */
+    namespace priv {
+        static constexpr size_t gl_FrameArenaSize = 64 * 1024; /**< initial size of the frame arena, in bytes */
+
+#if (defined TFD_INSTRUMENTATION)
+        /**
+         * \class CountingResource
+         * \brief memory resource counting the allocations it forwards to the global heap
+         */
+        class CountingResource : public std::pmr::memory_resource {
+        public:
+            /**
+             * \brief  retrieves the number of allocations made so far
+             * \return number of allocations
+             */
+            quint64 allocations() const noexcept { return m_allocations; }
+
+        private:
+            quint64 m_allocations = 0; /**< number of allocations made so far */
+
+            virtual void *do_allocate(size_t n, size_t align) override {
+                void *p = std::pmr::new_delete_resource()->allocate(n, align);
+                m_allocations++;
+
+                return p;
+            }
+            virtual void do_deallocate(void *p, size_t n, size_t align) override {
+                std::pmr::new_delete_resource()->deallocate(p, n, align);
+            }
+            virtual bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+                return this == &other;
+            }
+        };
+#endif
+
+        /**
+         * \class FrameArena
+         * \brief bump allocator for the temporaries of one frame
+         *
+         * Allocations are carved out of one buffer and never freed individually; *reset()* makes
+         * the entire buffer available again at the start of the next frame. If a frame needed
+         * more than the buffer holds, the rest is taken from the heap and the buffer is grown
+         * on reset, so that steady-state frames do not touch the heap at all.
+         *
+         * \note  Containers using the arena must be emptied (and their storage given up) before
+         *        the arena is reset.
+         */
+        class FrameArena : public std::pmr::memory_resource {
+        public:
+            /**
+             * \brief constructs a new arena
+             * \param [in] size initial size of the buffer, in bytes
+             */
+            explicit FrameArena(size_t size = gl_FrameArenaSize) {
+                int_allocateBuffer(size);
+                m_arena.emplace(m_buffer, m_size, int_upstream());
+#if (defined TFD_INSTRUMENTATION)
+                m_frameStart = m_upstream.allocations();
+#endif
+            }
+            ~FrameArena() {
+                m_arena.reset();
+                int_upstream()->deallocate(m_buffer, m_size, alignof(std::max_align_t));
+            }
+            FrameArena(FrameArena const &) = delete;
+            FrameArena &operator =(FrameArena const &) = delete;
+
+            /**
+             * \brief makes the entire buffer available again, growing it first if the last frame
+             *        did not fit
+             * \note  If the buffer cannot be grown, the old one is kept.
+             */
+            void reset() noexcept {
+#if (defined TFD_INSTRUMENTATION)
+                m_frameStart = m_upstream.allocations();
+#endif
+                m_arena.reset();
+                reserve(std::exchange(m_used, 0));
+                m_arena.emplace(m_buffer, m_size, int_upstream());
+            }
+            /**
+             * \brief grows the buffer to hold at least the given number of bytes
+             * \param [in] n number of bytes
+             * \note  Must only be called while nothing is allocated from the arena (e.g., right
+             *        before or after *reset()*). If the buffer cannot be grown, the old one is
+             *        kept.
+             */
+            void reserve(size_t n) noexcept {
+                if (n <= m_size)
+                    return;
+
+                size_t size = m_size;
+                while (size < n)
+                    size *= 2;
+                void *const  old     = m_buffer;
+                size_t const oldsize = m_size;
+                try {
+                    int_allocateBuffer(size);
+                } catch (...) { return; }
+
+                bool const isactive = m_arena.has_value();
+                m_arena.reset();
+                int_upstream()->deallocate(old, oldsize, alignof(std::max_align_t));
+                if (isactive)
+                    m_arena.emplace(m_buffer, m_size, int_upstream());
+            }
+            /**
+             * \brief  retrieves the size of the buffer
+             * \return size, in bytes
+             */
+            size_t capacity() const noexcept { return m_size; }
+#if (defined TFD_INSTRUMENTATION)
+            /**
+             * \brief  retrieves the number of heap allocations made since the last reset
+             * \return number of allocations (including growing the buffer on reset)
+             */
+            quint64 frameAllocations() const noexcept { return m_upstream.allocations() - m_frameStart; }
+#endif
+
+        private:
+#if (defined TFD_INSTRUMENTATION)
+            CountingResource m_upstream;       /**< heap the buffer and any overflow are taken from */
+            quint64          m_frameStart = 0; /**< number of heap allocations as of the last reset */
+#endif
+            void   *m_buffer = nullptr; /**< buffer allocations are carved out of */
+            size_t  m_size   = 0;       /**< size of *m_buffer*, in bytes */
+            size_t  m_used   = 0;       /**< bytes requested since the last reset (including alignment) */
+            std::optional<std::pmr::monotonic_buffer_resource> m_arena; /**< bump allocator over *m_buffer* */
+
+            /**
+             * \brief  retrieves the heap the buffer and any overflow are taken from
+             * \return memory resource
+             */
+            std::pmr::memory_resource *int_upstream() noexcept {
+#if (defined TFD_INSTRUMENTATION)
+                return &m_upstream;
+#else
+                return std::pmr::new_delete_resource();
+#endif
+            }
+            /**
+             * \brief allocates a new buffer (without releasing the current one)
+             * \param [in] size size of the buffer, in bytes
+             * \note  This function may throw *std::bad_alloc*.
+             */
+            void int_allocateBuffer(size_t size) {
+                m_buffer = int_upstream()->allocate(size, alignof(std::max_align_t));
+                m_size   = size;
+            }
+
+            virtual void *do_allocate(size_t n, size_t align) override {
+                m_used += n + align - 1;
+
+                return m_arena->allocate(n, align);
+            }
+            virtual void do_deallocate(void *, size_t, size_t) override { /* Released on reset. */ }
+            virtual bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+                return this == &other;
+            }
+        };
+    }
+
+    /* frame statistics */
+    namespace priv {
+#if (defined TFD_INSTRUMENTATION)
+        using StatsClock = std::chrono::steady_clock; /**< clock all stages are timed with */
+
+        /**
+         * \class StageTimer
+         * \brief adds the time spent during its lifetime to one stage of the current frame
+         *
+         * Stages may be entered several times per frame (e.g., once per paint event); their
+         * times add up.
+         */
+        class StageTimer {
+        public:
+            /**
+             * \brief starts timing
+             * \param [in,out] stats statistics of the current frame
+             * \param [in] stage stage that is timed
+             */
+            StageTimer(ObjectRadar::FrameStatistics &stats, ObjectRadar::FrameStatistics::Stage stage) noexcept
+                : m_time(stats.m_stageTimes[stage]), m_start(StatsClock::now())
+            { }
+            ~StageTimer() {
+                m_time += std::chrono::duration<double, std::milli>(StatsClock::now() - m_start).count();
+            }
+            StageTimer(StageTimer const &) = delete;
+            StageTimer &operator =(StageTimer const &) = delete;
+
+        private:
+            double                       &m_time;  /**< time of the stage, in milliseconds */
+            StatsClock::time_point const  m_start; /**< time the timer was started */
+        };
+
+        /**
+         * \class FrameProfiler
+         * \brief collects the statistics of one frame at a time
+         */
+        class FrameProfiler {
+        public:
+            ObjectRadar::FrameStatistics m_current; /**< statistics of the frame being produced */
+            ObjectRadar::FrameStatistics m_last;    /**< statistics of the last completed frame */
+
+            /**
+             * \brief  completes the current frame and starts the next one
+             * \param  [in] rate requested frame rate, in frames per second
+             * \param  [in] statsrate rate at which statistics are published, per second (0 if
+             *         they are not published; the achieved rate is averaged over one second then)
+             * \return *true* if the statistics are due to be published, *false* otherwise
+             */
+            bool beginFrame(float rate, float statsrate) noexcept {
+                StatsClock::time_point const now = StatsClock::now();
+
+                bool isdue = false;
+                if (m_frames != 0) {
+                    double total = 0.;
+                    for (int k = 0; k < ObjectRadar::FrameStatistics::Compose; k++)
+                        total += m_current.m_stageTimes[k];
+
+                    m_current.m_frame         = m_frames;
+                    m_current.m_frameTime     = total;
+                    m_current.m_interval      = std::chrono::duration<double, std::milli>(now - m_frameStart).count();
+                    m_current.m_requestedRate = rate;
+                    m_current.m_achievedRate  = m_last.m_achievedRate;
+
+                    /* Average the rate over the statistics period so that it does not jitter. */
+                    double const window = std::chrono::duration<double>(now - m_windowStart).count();
+                    if (window >= (statsrate > 0.f ? 1. / statsrate : 1.)) {
+                        m_current.m_achievedRate = static_cast<float>((m_frames - m_windowFrames) / window);
+                        m_windowStart            = now;
+                        m_windowFrames           = m_frames;
+                        isdue                    = true;
+                    }
+                    m_last = m_current;
+                } else
+                    m_windowStart = now;
+
+                m_frames++;
+                m_frameStart = now;
+                m_current    = ObjectRadar::FrameStatistics{};
+                return isdue;
+            }
+
+        private:
+            quint64                m_frames       = 0; /**< number of frames started so far */
+            quint64                m_windowFrames = 0; /**< value of *m_frames* at the start of the averaging window */
+            StatsClock::time_point m_frameStart;       /**< time the current frame was started */
+            StatsClock::time_point m_windowStart;      /**< time the averaging window was started */
+        };
+#endif
+    }
+
+    /* clustering */
+    namespace priv {
+        static constexpr double gl_BadgeRadius   = gl_MarkerRadius + 4.; /**< radius of cluster badges, in pixels */
+        static constexpr int    gl_BadgeMaxCount = 999;                  /**< larger counts are shown as "999+" */
+
+        /**
+         * \struct Cluster
+         * \brief  objects merged into one badge
+         */
+        struct Cluster {
+            QPointF m_center;    /**< screen position of the badge (center of the cluster cell) */
+            quint32 m_count = 0; /**< number of objects in the cluster */
+            quint32 m_cell  = 0; /**< index of the cluster cell */
+        };
+
+        /**
+         * \brief  calculates the screen area covered by a cluster badge
+         * \param  [in] center screen position of the badge
+         * \return bounding rectangle of the badge, including a margin for anti-aliasing
+         */
+        static QRect int_badgeBounds(QPointF const &center) noexcept {
+            double const r = gl_BadgeRadius + 1.;
+
+            return QRectF{ center - QPointF{ r, r }, QSizeF{ 2. * r, 2. * r } }.toAlignedRect();
+        }
+        /**
+         * \brief draws a cluster badge
+         * \param [in,out] painter painter to draw with (font set up already)
+         * \param [in] cluster cluster
+         * \param [in] fg color of the badge outline and count
+         * \param [in] bg color of the badge fill
+         */
+        static void int_drawBadge(QPainter &painter, Cluster const &cluster, QColor const &fg, QColor const &bg) {
+            QString const text = cluster.m_count > static_cast<quint32>(gl_BadgeMaxCount) ? QString::number(gl_BadgeMaxCount) + "+" : QString::number(cluster.m_count);
+
+            painter.setPen(QPen{ fg, 1.5 });
+            painter.setBrush(bg);
+            painter.drawEllipse(cluster.m_center, gl_BadgeRadius, gl_BadgeRadius);
+            painter.drawText(QRectF{ cluster.m_center - QPointF{ gl_BadgeRadius, gl_BadgeRadius }, QSizeF{ 2. * gl_BadgeRadius, 2. * gl_BadgeRadius } }, Qt::AlignCenter, text);
+            painter.setBrush(Qt::NoBrush);
+        }
+    }
+
+    /* off-thread frame composition */
+    namespace priv {
+        /**
+         * \struct Scene
+         * \brief  immutable snapshot of everything that is drawn in a frame
+         * 
+         * Scenes are assembled on the GUI thread and composed into an image on a worker thread.
+         * Members are owned by the scene (containers are deep copies), implicitly shared Qt
+         * types, or shared pointers to immutable geometry from the cache of the view; all of
+         * them are safe to read from another thread, and nothing refers back to the object
+         * radar.
+         */
+        struct Scene {
+            /**
+             * \struct Marker
+             * \brief  object drawn as an icon
+             */
+            struct Marker {
+                QPointF m_position; /**< screen position */
+                QRectF  m_sprite;   /**< source rectangle in *m_sprites* */
+                QColor  m_color;    /**< label color */
+                QString m_label;    /**< label text; empty if the label is hidden */
+                QPointF m_labelOffset; /**< top-left corner of the label relative to the screen position of the object */
+            };
+            /**
+             * \struct Outline
+             * \brief  object drawn as an area or path
+             */
+            struct Outline {
+                std::shared_ptr<QPolygonF const> m_outline;          /**< projected and flattened outline, shared with the geometry cache of the view (see *m_zoomScale*) */
+                QColor                           m_color;            /**< outline color */
+                bool                             m_isClosed = false; /**< whether the outline is an area (closed and filled) or a path */
+            };
+
+            ProjectionParams     m_projection;          /**< projection terms */
+            double               m_zoomScale = 1.;      /**< scale from the screen space of the outlines and *m_scale* to the one of *m_projection* (about its origin); 1 unless zooming */
+            QSize                m_size;                /**< widget size, in pixels */
+            qreal                m_dpr = 1.;            /**< device pixel ratio */
+            QImage               m_scale;               /**< pre-rendered radar scale */
+            QImage               m_compass;             /**< pre-rendered compass rose */
+            QImage               m_sprites;             /**< sprite atlas */
+            QFont                m_labelFont;           /**< font of object labels */
+            int                  m_areaOpacity = 0;     /**< fill opacity of areas, in range [0 ... 255] */
+            int                  m_outlineStrength = 0; /**< width of area and path outlines, in pixels */
+            int                  m_outlineStyle = 0;    /**< style of area and path outlines */
+            std::vector<Outline> m_outlines;            /**< areas and paths overlapping the view */
+            std::vector<Marker>  m_markers;             /**< visible objects within the radar range drawn as icons */
+            std::vector<Cluster> m_clusters;            /**< badges of objects merged into clusters */
+            QColor               m_fgndColor;           /**< color of badge outlines and counts */
+            QColor               m_bgndColor;           /**< fill color of badges */
+        };
+
+        /**
+         * \brief  composes a frame from a scene
+         * \param  [in] scene scene that is to be drawn
+         * \return composed frame, or a null image if there was an error
+         * \note   Uses the same layering as the object radar: scale, areas and paths, icons and
+         *         labels, compass. Safe to call from any thread.
+         */
+        static QImage int_composeFrame(Scene const &scene) noexcept {
+            try {
+                QImage frame{ scene.m_size * scene.m_dpr, QImage::Format_ARGB32_Premultiplied };
+                if (frame.isNull())
+                    return QImage{};
+                frame.setDevicePixelRatio(scene.m_dpr);
+
+                QPainter     painter(&frame);
+                QRectF const all{ QPointF{ 0., 0. }, QSizeF{ scene.m_size } };
+                painter.setRenderHint(QPainter::Antialiasing);
+                if (scene.m_zoomScale == 1.)
+                    painter.drawImage(all, scene.m_scale);
+                else {
+                    QPointF const o = scene.m_projection.m_origin;
+                    painter.fillRect(all, scene.m_bgndColor);
+                    painter.drawImage(QRectF{ o - o * scene.m_zoomScale, all.size() * scene.m_zoomScale }, scene.m_scale);
+                }
+
+                /* Areas and paths. */
+                QPolygonF     zoomed;
+                QPointF const origin = scene.m_projection.m_origin;
+                for (Scene::Outline const &o : scene.m_outlines) {
+                    if (scene.m_zoomScale != 1.) {
+                        zoomed.resize(o.m_outline->size());
+                        for (qsizetype k = 0; k < zoomed.size(); k++)
+                            zoomed[k] = origin + ((*o.m_outline)[k] - origin) * scene.m_zoomScale;
+                    }
+                    QPolygonF const &outline = scene.m_zoomScale == 1. ? *o.m_outline : zoomed;
+
+                    painter.setPen(QPen{ o.m_color, static_cast<qreal>(scene.m_outlineStrength), static_cast<Qt::PenStyle>(scene.m_outlineStyle), Qt::RoundCap, Qt::RoundJoin });
+                    if (!o.m_isClosed) {
+                        painter.setBrush(Qt::NoBrush);
+                        painter.drawPolyline(outline);
+
+                        continue;
+                    }
+
+                    QColor fill = o.m_color;
+                    fill.setAlpha(scene.m_areaOpacity * o.m_color.alpha() / 255);
+                    painter.setBrush(fill);
+                    painter.drawPolygon(outline);
+                }
+                painter.setBrush(Qt::NoBrush);
+
+                /* Icons, ... */
+                QPointF const half{ gl_SpriteSize / 2., gl_SpriteSize / 2. };
+                for (Scene::Marker const &m : scene.m_markers)
+                    painter.drawImage(QRectF{ m.m_position - half, QSizeF{ gl_SpriteSize, gl_SpriteSize } }, scene.m_sprites, m.m_sprite);
+
+                /* ... badges ... */
+                painter.setFont(scene.m_labelFont);
+                for (Cluster const &c : scene.m_clusters)
+                    int_drawBadge(painter, c, scene.m_fgndColor, scene.m_bgndColor);
+
+                /* ... and labels, where the layout pass placed them. */
+                QFontMetricsF const fm{ scene.m_labelFont };
+                for (Scene::Marker const &m : scene.m_markers) {
+                    if (m.m_label.isEmpty())
+                        continue;
+
+                    painter.setPen(m.m_color);
+                    painter.drawText(m.m_position + m.m_labelOffset + QPointF{ 0., fm.ascent() }, m.m_label);
+                }
+
+                painter.drawImage(all, scene.m_compass);
+                painter.end();
+
+                return frame;
+            } catch (...) { }
+
+            return QImage{};
+        }
+
+        /**
+         * \class FrameComposer
+         * \brief worker thread composing frames from scenes
+         * 
+         * The composer holds at most one pending scene: submitting a scene replaces one that was
+         * not picked up yet, so the worker always composes the latest state and never falls
+         * behind. Completed frames are published for the paint event, which only blits them.
+         */
+        class FrameComposer {
+        public:
+            /**
+             * \brief constructs a new composer and starts its worker thread
+             * \param [in] target widget that is repainted whenever a frame was completed
+             */
+            explicit FrameComposer(QWidget *target)
+                : m_target(target), m_worker([this]() { int_run(); })
+            { }
+            ~FrameComposer() {
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    m_isStopping = true;
+                }
+                m_wakeup.notify_one();
+                m_worker.join();
+            }
+
+            /**
+             * \brief hands the next scene to the worker
+             * \param [in] scene scene that is to be composed
+             */
+            void submit(std::shared_ptr<Scene const> scene) noexcept {
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    m_pending = std::move(scene);
+                }
+                m_wakeup.notify_one();
+            }
+            /**
+             * \brief  retrieves the most recently completed frame
+             * \return frame, or a null image if no frame was completed yet
+             */
+            QImage latest() const noexcept {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                return m_completed;
+            }
+#if (defined TFD_INSTRUMENTATION)
+            /**
+             * \brief  retrieves the time it took to compose the most recently completed frame
+             * \return composition time, in milliseconds
+             */
+            double composeTime() const noexcept {
+                return m_composeTime.load(std::memory_order_relaxed);
+            }
+#endif
+
+        private:
+            QWidget                     *m_target;            /**< widget displaying the frames */
+            mutable std::mutex           m_lock;              /**< guards all members below */
+            std::condition_variable      m_wakeup;            /**< signaled on new scenes and on shutdown */
+            std::shared_ptr<Scene const> m_pending;           /**< scene that is to be composed next, if any */
+            QImage                       m_completed;         /**< most recently completed frame */
+            bool                         m_isStopping = false; /**< whether or not the worker is to exit */
+#if (defined TFD_INSTRUMENTATION)
+            std::atomic<double>          m_composeTime{ 0. }; /**< time it took to compose *m_completed*, in milliseconds */
+#endif
+            std::thread                  m_worker;            /**< worker thread; started last */
+
+            /**
+             * \brief worker loop
+             */
+            void int_run() noexcept {
+                std::unique_lock<std::mutex> lock{ m_lock };
+                for (;;) {
+                    m_wakeup.wait(lock, [this]() { return m_isStopping || m_pending != nullptr; });
+                    if (m_isStopping)
+                        return;
+
+                    /* Compose without holding the lock so that neither side waits for the other. */
+                    std::shared_ptr<Scene const> const scene = std::move(m_pending);
+                    m_pending.reset();
+                    lock.unlock();
+#if (defined TFD_INSTRUMENTATION)
+                    StatsClock::time_point const start = StatsClock::now();
+                    QImage frame = int_composeFrame(*scene);
+                    m_composeTime.store(std::chrono::duration<double, std::milli>(StatsClock::now() - start).count(), std::memory_order_relaxed);
+#else
+                    QImage frame = int_composeFrame(*scene);
+#endif
+                    lock.lock();
+
+                    if (frame.isNull())
+                        continue;
+                    m_completed = std::move(frame);
+
+                    QWidget *target = m_target;
+                    QMetaObject::invokeMethod(target, [target]() { target->update(); }, Qt::QueuedConnection);
+                }
+            }
+        };
+    }
+
+    /* parallel culling and projection */
+    namespace priv {
+        static constexpr size_t gl_ParallelThreshold = 8192; /**< minimum number of objects for the per-frame pass to be run in parallel */
+        static constexpr size_t gl_ParallelChunk     = 2048; /**< number of objects per chunk of the parallel pass */
+
+        /**
+         * \class ThreadPool
+         * \brief fixed set of worker threads executing chunked loops
+         * 
+         * Chunks are handed out through a shared atomic counter, so threads that finish early
+         * simply take the next chunk (no static partitioning). The calling thread works on
+         * chunks, too.
+         */
+        class ThreadPool {
+        public:
+            /**
+             * \brief constructs a new pool and starts its workers
+             * \param [in] nworkers number of worker threads (besides the calling thread)
+             */
+            explicit ThreadPool(size_t nworkers) {
+                try {
+                    for (size_t k = 0; k < nworkers; k++)
+                        m_workers.emplace_back([this]() { int_run(); });
+                } catch (...) {
+                    int_stop();
+                    throw;
+                }
+            }
+            ~ThreadPool() { int_stop(); }
+
+            /**
+             * \brief  retrieves the number of threads working on a loop, including the caller
+             * \return number of threads
+             */
+            size_t concurrency() const noexcept { return m_workers.size() + 1; }
+            /**
+             * \brief runs a function for a range of chunks and waits until all of them are done
+             * \param [in] nchunks number of chunks
+             * \param [in] fn function called with each chunk index in [0, nchunks); must not throw
+             *        and must only touch data owned by that chunk
+             * \note  The function is referenced, not copied, so posting a job never allocates.
+             */
+            template<class Fn>
+            void parallelFor(size_t nchunks, Fn const &fn) noexcept {
+                Job const job{ &fn, [](void const *f, size_t c) { (*static_cast<Fn const *>(f))(c); } };
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    m_job     = job;
+                    m_nchunks = nchunks;
+                    m_pending = m_workers.size();
+                    m_next.store(0, std::memory_order_relaxed);
+                    ++m_generation;
+                }
+                m_start.notify_all();
+
+                int_work(job, nchunks);
+
+                std::unique_lock<std::mutex> lock{ m_lock };
+                m_done.wait(lock, [this]() { return m_pending == 0; });
+                m_job = Job{};
+            }
+
+        private:
+            /**
+             * \struct Job
+             * \brief  type-erased reference to the function of a loop
+             */
+            struct Job {
+                void const *m_fn = nullptr;                         /**< function object */
+                void      (*m_invoke)(void const *, size_t) = nullptr; /**< calls *m_fn* with a chunk index */
+            };
+
+            std::vector<std::thread>           m_workers;          /**< worker threads */
+            std::mutex                         m_lock;             /**< guards the job description */
+            std::condition_variable            m_start;            /**< signaled when a job is posted or the pool stops */
+            std::condition_variable            m_done;             /**< signaled when a worker finished its part of a job */
+            Job                                m_job;              /**< current job */
+            size_t                             m_nchunks = 0;      /**< number of chunks of the current job */
+            size_t                             m_pending = 0;      /**< number of workers still working on the current job */
+            quint64                            m_generation = 0;   /**< incremented for every job */
+            bool                               m_isStopping = false; /**< whether or not the workers are to exit */
+            std::atomic<size_t>                m_next{ 0 };        /**< next chunk to hand out */
+
+            /**
+             * \brief works on chunks until none are left
+             */
+            void int_work(Job const &job, size_t nchunks) noexcept {
+                for (size_t c = m_next.fetch_add(1, std::memory_order_relaxed); c < nchunks; c = m_next.fetch_add(1, std::memory_order_relaxed))
+                    job.m_invoke(job.m_fn, c);
+            }
+            /**
+             * \brief worker loop
+             */
+            void int_run() noexcept {
+                quint64 seen = 0;
+
+                std::unique_lock<std::mutex> lock{ m_lock };
+                for (;;) {
+                    m_start.wait(lock, [&]() { return m_isStopping || m_generation != seen; });
+                    if (m_isStopping)
+                        return;
+                    seen = m_generation;
+
+                    Job const    job = m_job;
+                    size_t const n   = m_nchunks;
+                    lock.unlock();
+                    int_work(job, n);
+                    lock.lock();
+
+                    if (--m_pending == 0)
+                        m_done.notify_one();
+                }
+            }
+            /**
+             * \brief stops and joins all workers
+             */
+            void int_stop() noexcept {
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    m_isStopping = true;
+                }
+                m_start.notify_all();
+                for (std::thread &t : m_workers)
+                    t.join();
+                m_workers.clear();
+            }
+        };
+
+        /**
+         * \struct CullChunk
+         * \brief  draw list of one chunk of the parallel culling and projection pass
+         */
+        struct CullChunk {
+            std::vector<QPointF> m_projected; /**< scratch buffer receiving the screen positions of all objects of the chunk */
+            std::vector<quint32> m_inRange;   /**< dense indices of the objects within the radar range */
+            std::vector<QPointF> m_positions; /**< screen positions of the objects in *m_inRange* */
+            std::vector<QPointF> m_predicted; /**< scratch buffer receiving the extrapolated [lat, long] positions of all objects of the chunk */
+        };
+    }
+
+    /* label placement */
+    namespace priv {
+        static constexpr double gl_LabelCellSize   = 32.; /**< edge length of the cells of the label collision grid, in pixels */
+        static constexpr double gl_LabelStickiness = 1.;  /**< objects that moved less than this many pixels keep their label where it is */
+        static constexpr int    gl_LabelCandidates = 4;   /**< number of candidate positions per label */
+
+        /**
+         * \brief  calculates the top-left corner of a label at one of its candidate positions
+         * \param  [in] pt screen position of the object
+         * \param  [in] size size of the label
+         * \param  [in] candidate candidate position in order of preference: right of, left of,
+         *         above or below the marker {def: 0}
+         * \return top-left corner of the label
+         */
+        static QPointF int_labelOrigin(QPointF const &pt, QSizeF const &size, int candidate = 0) noexcept {
+            double const gap = gl_MarkerRadius + 1.;
+
+            switch (candidate) {
+                case 1:  return pt + QPointF{ -gap - size.width(), -size.height() / 2. };
+                case 2:  return pt + QPointF{ -size.width() / 2., -gap - size.height() };
+                case 3:  return pt + QPointF{ -size.width() / 2., gap };
+                default: return pt + QPointF{ gap, -size.height() / 2. };
+            }
+        }
+
+        /**
+         * \brief  calculates the area labels must not overlap around an object marker
+         * \param  [in] pt screen position of the object
+         * \return area of the marker (unlike *int_markerBounds()*, without margins and not
+         *         aligned to pixels, so that labels at the candidate positions never collide with
+         *         their own marker)
+         */
+        static QRectF int_markerObstacle(QPointF const &pt) noexcept {
+            return QRectF{ pt - QPointF{ gl_MarkerRadius, gl_MarkerRadius }, QSizeF{ 2. * gl_MarkerRadius, 2. * gl_MarkerRadius } };
+        }
+
+        /**
+         * \struct LabelPlacement
+         * \brief  where the label of an object was placed in the last layout pass
+         */
+        struct LabelPlacement {
+            QPointF m_anchor;             /**< screen position of the object when the label was placed */
+            QRectF  m_rect;               /**< screen area of the label; null if the label is hidden */
+            int     m_candidate  = 0;     /**< candidate position the label was placed at (or tried first) */
+            bool    m_isLaidOut  = false; /**< whether or not the label was laid out at all */
+        };
+
+        /**
+         * \class LabelGrid
+         * \brief uniform grid over the widget used to find overlapping labels and markers
+         *
+         * Every rectangle is registered in all cells it overlaps, so a collision test only
+         * looks at the few rectangles near the one being tested. The grid keeps its storage
+         * between frames.
+         */
+        class LabelGrid {
+        public:
+            /**
+             * \brief removes all rectangles and resizes the grid to cover a widget
+             * \param [in] size widget size, in pixels
+             * \note  This function may throw *std::bad_alloc*.
+             */
+            void reset(QSize const &size) {
+                m_cols = std::max(static_cast<int>(std::ceil(size.width() / gl_LabelCellSize)), 1);
+                m_rows = std::max(static_cast<int>(std::ceil(size.height() / gl_LabelCellSize)), 1);
+
+                m_cells.resize(static_cast<size_t>(m_cols) * m_rows);
+                for (auto &cell : m_cells)
+                    cell.clear();
+                m_rects.clear();
+            }
+            /**
+             * \brief  checks whether a rectangle overlaps any rectangle in the grid
+             * \param  [in] rect rectangle, in pixels
+             * \return *true* if there is an overlap, *false* otherwise
+             */
+            bool overlaps(QRectF const &rect) const noexcept {
+                auto const [c0, r0, c1, r1] = int_cellsOf(rect);
+                for (int r = r0; r <= r1; r++)
+                    for (int c = c0; c <= c1; c++)
+                        for (quint32 const id : m_cells[static_cast<size_t>(r) * m_cols + c])
+                            if (m_rects[id].intersects(rect))
+                                return true;
+
+                return false;
+            }
+            /**
+             * \brief adds a rectangle to the grid
+             * \param [in] rect rectangle, in pixels
+             * \note  This function may throw *std::bad_alloc*.
+             */
+            void insert(QRectF const &rect) {
+                auto const [c0, r0, c1, r1] = int_cellsOf(rect);
+
+                m_rects.push_back(rect);
+                for (int r = r0; r <= r1; r++)
+                    for (int c = c0; c <= c1; c++)
+                        m_cells[static_cast<size_t>(r) * m_cols + c].push_back(static_cast<quint32>(m_rects.size() - 1));
+            }
+
+        private:
+            int                               m_cols = 0; /**< number of columns */
+            int                               m_rows = 0; /**< number of rows */
+            std::vector<std::vector<quint32>> m_cells;    /**< indices of the rectangles overlapping each cell, row by row */
+            std::vector<QRectF>               m_rects;    /**< all rectangles */
+
+            /* Cells overlapped by a rectangle, clamped to the grid: { c0, r0, c1, r1 }. */
+            std::array<int, 4> int_cellsOf(QRectF const &rect) const noexcept {
+                auto const cell = [](double v, int n) {
+                    return static_cast<int>(std::clamp(std::floor(v / gl_LabelCellSize), 0., n - 1.));
+                };
+                return { cell(rect.left(), m_cols), cell(rect.top(), m_rows), cell(rect.right(), m_cols), cell(rect.bottom(), m_rows) };
+            }
+        };
+    }
+
+    /* OpenGL rendering backend */
+    namespace priv {
+        /**
+         * \class GLSurface
+         * \brief GPU-accelerated drawing surface of the object radar
+         * 
+         * The surface is a child widget covering the entire object radar. It draws from the same
+         * state (*ObjectRadarPrivate*) as the raster path: the pre-rendered layers are uploaded
+         * as textures whenever they are re-rendered, and object icons are drawn as instanced
+         * quads textured from the sprite atlas, i.e., one draw call for all icons. Area fills
+         * are drawn from their cached triangulation in one draw call as well. Outlines, paths
+         * and labels are drawn with *QPainter*.
+         * 
+         * \note  Requires OpenGL 3.3 or OpenGL ES 3.0. If the context does not meet the
+         *        requirements or the shaders cannot be built, the object radar falls back to the
+         *        raster backend. So it does if the context is destroyed, becomes invalid or runs
+         *        out of memory later on.
+         */
+        class GLSurface : public QOpenGLWidget, protected QOpenGLExtraFunctions {
+            /**
+             * \struct Layer
+             * \brief  texture holding one of the pre-rendered layers
+             */
+            struct Layer {
+                std::unique_ptr<QOpenGLTexture> m_texture;      /**< texture, or *nullptr* if not yet uploaded */
+                qint64                          m_cacheKey = 0; /**< cache key of the pixmap the texture was uploaded from */
+            };
+            /**
+             * \struct Marker
+             * \brief  per-instance attributes of an object marker
+             */
+            struct Marker {
+                GLfloat m_x, m_y;               /**< screen position, in pixels */
+                GLfloat m_u0, m_v0, m_u1, m_v1; /**< normalized source rectangle in the sprite atlas */
+            };
+            /**
+             * \struct MeshVertex
+             * \brief  vertex of the area fill mesh
+             */
+            struct MeshVertex {
+                GLfloat m_x, m_y;             /**< screen position, in pixels */
+                GLfloat m_r, m_g, m_b, m_a;   /**< fill color */
+            };
+
+        public:
+            /**
+             * \brief constructs a new surface
+             * \param [in] data state of the object radar to draw
+             * \param [in] parent object radar the surface belongs to
+             */
+            explicit GLSurface(ObjectRadarPrivate *data, QWidget *parent);
+            ~GLSurface();
+
+        protected:
+            virtual void initializeGL() override;
+            virtual void paintGL() override;
+
+        private:
+            ObjectRadarPrivate      *m_data;          /**< state of the object radar */
+            bool                     m_isReady;       /**< whether or not all GL resources were created and are still usable */
+            QOpenGLShaderProgram     m_layerProgram;  /**< program drawing full-screen textured quads (scaled about the center during zoom gestures) */
+            QOpenGLShaderProgram     m_markerProgram; /**< program drawing instanced marker quads */
+            QOpenGLShaderProgram     m_meshProgram;   /**< program drawing colored triangles */
+            QOpenGLVertexArrayObject m_vao;           /**< vertex array object used for all draws */
+            QOpenGLBuffer            m_quadBuffer;    /**< unit quad (triangle strip) */
+            QOpenGLBuffer            m_markerBuffer;  /**< per-instance marker attributes, re-uploaded every frame */
+            QOpenGLBuffer            m_meshBuffer;    /**< area fill vertices, re-uploaded every frame */
+            Layer                    m_scale;         /**< radar scale layer */
+            Layer                    m_compass;       /**< compass rose layer */
+            Layer                    m_sprites;       /**< sprite atlas */
+            std::vector<Marker>      m_markers;       /**< scratch buffer for marker attributes */
+            std::vector<MeshVertex>  m_mesh;          /**< scratch buffer for area fill vertices */
+
+            /**
+             * \brief releases all GL resources
+             * \note  Requires the context to be current.
+             */
+            void int_releaseResources() noexcept;
+            /**
+             * \brief stops drawing and hands the object radar back to the raster backend
+             * \note  The surface is destroyed later on; it must not be used anymore.
+             */
+            void int_fallBack() noexcept;
+            /**
+             * \brief  uploads a pixmap into a texture if it changed since the last upload
+             * \param  [in,out] layer texture
+             * \param  [in] pixmap pixmap that is to be uploaded
+             * \param  [in] key value identifying the contents of **pixmap**
+             * \return *true* if the texture is usable, *false* if **pixmap** is empty or the texture
+             *         could not be created (in which case the surface is no longer ready)
+             */
+            bool int_uploadLayer(Layer &layer, QPixmap const &pixmap, qint64 key);
+            /**
+             * \brief draws a pre-rendered layer across the entire surface
+             * \param [in,out] layer texture of the layer; re-uploaded if **pixmap** changed
+             * \param [in] pixmap pre-rendered layer
+             * \param [in] scale scale about the center of the surface (see *int_scaleRect()*) {def: 1}
+             */
+            void int_drawLayer(Layer &layer, QPixmap const &pixmap, GLfloat scale = 1.f);
+            /**
+             * \brief draws all visible markers within the radar range in a single instanced draw
+             */
+            void int_drawMarkers();
+            /**
+             * \brief draws the fills of all visible areas in a single draw
+             */
+            void int_drawAreas();
+        };
+    }
+}
+
+
+/* lock-free update ingestion */
+namespace tfd {
+    /**
+     * \class UpdateChannelPrivate
+     * \brief internal state of an update channel
+     * 
+     * The ring buffer indices grow monotonically and are masked on access. The write index is
+     * only written by the producer and the read index only by the consumer; each side caches
+     * the last value of the other side's index it has seen so that the shared cache lines are
+     * only touched once the cached view runs out.
+     */
+    class UpdateChannelPrivate {
+    public:
+        /**
+         * \brief constructs a new ring buffer
+         * \param [in] capacity capacity of the buffer; a power of two
+         */
+        explicit UpdateChannelPrivate(size_t capacity)
+            : m_records(std::make_unique<ObjectRadar::ObjectUpdate[]>(capacity)), m_mask(capacity - 1)
+        { }
+
+        /**
+         * \brief  queues records (producer side)
+         * \param  [in] upd pointer to the first record
+         * \param  [in] n number of records
+         * \return number of records that were queued
+         */
+        size_t push(ObjectRadar::ObjectUpdate const *upd, size_t n) noexcept {
+            if (!m_isOpen.load(std::memory_order_relaxed))
+                return 0;
+
+            size_t const head = m_head.load(std::memory_order_relaxed);
+            if (head + n - m_cachedTail > m_mask + 1)
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+            size_t const m = std::min(n, m_mask + 1 - (head - m_cachedTail));
+            for (size_t k = 0; k < m; k++)
+                m_records[(head + k) & m_mask] = upd[k];
+            m_head.store(head + m, std::memory_order_release);
+
+            if (m < n)
+                m_dropped.fetch_add(n - m, std::memory_order_relaxed);
+            if (m > 0)
+                int_wakeConsumer();
+            return m;
+        }
+        /**
+         * \brief appends all queued records to a buffer (consumer side)
+         * \param [out] out receives the records, in order
+         * \note  This function may throw *std::bad_alloc*; no records are consumed in that case.
+         */
+        void drain(std::vector<ObjectRadar::ObjectUpdate> &out) {
+            /* Re-arm the wake-up first so that records pushed while draining trigger another frame. */
+            m_isWakeupPending.store(false, std::memory_order_release);
+
+            size_t const tail = m_tail.load(std::memory_order_relaxed);
+            size_t const head = m_head.load(std::memory_order_acquire);
+            out.reserve(out.size() + (head - tail));
+            for (size_t k = tail; k != head; k++)
+                out.push_back(m_records[k & m_mask]);
+            m_tail.store(head, std::memory_order_release);
+        }
+        /**
+         * \brief detaches the channel from its consumer (consumer side)
+         * \note  Blocks only while the producer is posting a wake-up.
+         */
+        void close() noexcept {
+            std::lock_guard<std::mutex> lock{ m_consumerLock };
+
+            m_isOpen.store(false, std::memory_order_relaxed);
+            m_consumer = nullptr;
+        }
+
+    private:
+        friend class UpdateChannel;
+        friend class ObjectRadar;
+        friend class ObjectRadarPrivate;
+
+        /* shared state */
+        std::unique_ptr<ObjectRadar::ObjectUpdate[]> m_records;                /**< ring buffer */
+        size_t const                                 m_mask;                   /**< capacity - 1 */
+        std::atomic<quint64>                         m_dropped{ 0 };           /**< number of rejected records */
+        std::atomic<bool>                            m_isOpen{ true };         /**< whether or not the consumer still exists */
+        std::atomic<bool>                            m_isWakeupPending{ false }; /**< whether or not a wake-up was posted since the last drain */
+        std::mutex                                   m_consumerLock;           /**< guards *m_consumer* */
+        ObjectRadarPrivate                          *m_consumer = nullptr;     /**< object radar draining the channel */
+
+        /* producer state */
+        alignas(64) std::atomic<size_t> m_head{ 0 };   /**< write index */
+        size_t                          m_cachedTail = 0; /**< last read index seen by the producer */
+
+        /* consumer state */
+        alignas(64) std::atomic<size_t> m_tail{ 0 };   /**< read index */
+
+        /**
+         * \brief schedules a frame on the consumer, at most once per drain
+         * \note  Never waits: if the consumer is being detached, no wake-up is posted.
+         */
+        void int_wakeConsumer() noexcept;
+    };
+}
+
+
+/* update log replay */
+namespace tfd {
+    /**
+     * \class UpdateReplayPrivate
+     * \brief internal state of an update log replay
+     */
+    class UpdateReplayPrivate {
+    public:
+        /**
+         * \brief constructs the replay state
+         * \param [in] radar object radar the log is replayed into
+         */
+        explicit UpdateReplayPrivate(ObjectRadar *radar) noexcept
+            : m_radar(radar)
+        { }
+
+        /**
+         * \brief  rewinds to the first record and empties the object radar
+         * \return *true* on success, *false* if the object radar was destroyed
+         */
+        bool rewind() noexcept {
+            if (m_radar.isNull())
+                return false;
+
+            m_reader   = priv::UpdateLogReader{ m_log.data() + gl_HeaderSize, m_log.data() + m_log.size() };
+            m_nextTime = 0;
+            m_updates  = 0;
+            m_handles.clear();
+            m_lastPos.clear();
+            m_lastCenter = {};
+            m_radar->removeAllObjects();
+
+            int_readTime();
+            return true;
+        }
+        /**
+         * \brief  applies the records that are due
+         * 
+         * In *Pace::RealTime*, all records up to the current replay time are applied. In
+         * *Pace::Unthrottled*, records are applied until *gl_ReplaySliceNs* have passed.
+         * 
+         * \return *true* if the replay is complete, *false* if there are records left
+         */
+        bool step() noexcept {
+            if (m_radar.isNull())
+                return true;
+
+            qint64 const now = m_clock.nsecsElapsed();
+            for (size_t k = 0; m_hasNext; k++) {
+                if (m_pace == UpdateReplay::Pace::RealTime && static_cast<qint64>(m_nextTime) * 1000 > now)
+                    return false;
+                /* Reading the clock for every record would dominate small records. */
+                if (m_pace == UpdateReplay::Pace::Unthrottled && k % 64 == 63 && m_clock.nsecsElapsed() - now >= priv::gl_ReplaySliceNs)
+                    return false;
+
+                if (!int_applyRecord())
+                    m_hasNext = false;
+                else
+                    int_readTime();
+            }
+            m_elapsed = m_clock.nsecsElapsed() / 1e9;
+            return true;
+        }
+        /**
+         * \brief  computes the time until the next record is due
+         * \return delay, in milliseconds
+         */
+        int delay() const noexcept {
+            if (m_pace == UpdateReplay::Pace::Unthrottled)
+                return 0;
+
+            qint64 const due = static_cast<qint64>(m_nextTime) - m_clock.nsecsElapsed() / 1000;
+            return static_cast<int>(std::clamp<qint64>(due / 1000, 0, INT_MAX));
+        }
+
+    private:
+        friend class UpdateReplay;
+        friend class tests::ObjectRadarTests;
+
+        static constexpr size_t gl_HeaderSize = 2 * sizeof(quint32); /**< size of the log header (magic, version), in bytes */
+
+        QPointer<ObjectRadar>              m_radar;              /**< object radar the log is replayed into */
+        std::vector<uchar>                 m_log;                /**< entire log */
+        priv::UpdateLogReader              m_reader;             /**< position in the log */
+        UpdateReplay::Pace                 m_pace = UpdateReplay::Pace::RealTime; /**< replay speed */
+        QTimer                             m_timer;              /**< drives the replay */
+        QElapsedTimer                      m_clock;              /**< time since the replay was started */
+        quint64                            m_nextTime = 0;       /**< time of the next record, in microseconds since the start of the recording */
+        bool                               m_hasNext  = false;   /**< whether or not there is another record */
+        quint64                            m_updates  = 0;       /**< number of updates replayed */
+        double                             m_elapsed  = 0.;      /**< duration of the completed replay, in seconds */
+        std::vector<ObjectHandle>          m_handles;            /**< handles of the replayed objects, by logged slot index */
+        std::vector<std::array<qint64, 2>> m_lastPos;            /**< last decoded fixed-point position, by logged slot index */
+        std::array<qint64, 2>              m_lastCenter = {};    /**< last decoded fixed-point radar center */
+        std::vector<ObjectRadar::ObjectUpdate> m_batch;          /**< decoded typed update batch */
+
+        /**
+         * \brief reads the time of the next record, if there is one
+         */
+        void int_readTime() noexcept {
+            m_hasNext = !m_reader.atEnd();
+            if (m_hasNext)
+                m_nextTime += m_reader.varint();
+        }
+        /**
+         * \brief  reads a logged slot index and makes room for its state
+         * \return slot index, or an empty optional if the log is malformed
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        std::optional<quint32> int_readSlot() {
+            quint64 const slot = m_reader.varint();
+            if (!m_reader.isValid() || slot >= priv::gl_LogMaxSlots)
+                return std::optional<quint32>{};
+
+            if (slot >= m_handles.size()) {
+                m_handles.resize(slot + 1);
+                m_lastPos.resize(slot + 1);
+            }
+            return std::optional<quint32>(static_cast<quint32>(slot));
+        }
+        /**
+         * \brief  reads a logged property index
+         * \param  [in] isview whether a view or an object property is expected
+         * \return property index, or an empty optional if the log is malformed
+         */
+        std::optional<ObjectRadar::Property> int_readProperty(bool isview) noexcept {
+            auto const prop = static_cast<ObjectRadar::Property>(m_reader.raw<quint8>());
+            if (!m_reader.isValid() || !(isview ? ObjectRadar::isViewProperty(prop) : ObjectRadar::isObjectProperty(prop)))
+                return std::optional<ObjectRadar::Property>{};
+
+            return std::optional<ObjectRadar::Property>(prop);
+        }
+        /**
+         * \brief  decodes and applies the next record
+         * \return *true* on success, *false* if the log ends with an incomplete or malformed
+         *         record, or there was an error
+         */
+        bool int_applyRecord() noexcept {
+            try {
+                auto const op = static_cast<priv::LogOp>(m_reader.raw<quint8>());
+                switch (op) {
+                    case priv::LogOp::Add: {
+                        auto const slot = int_readSlot();
+                        if (!slot.has_value())
+                            return false;
+
+                        auto const  type = static_cast<ObjectRadar::ObjectType>(m_reader.varint());
+                        m_lastPos[*slot] = {};
+                        QPointF const pos = m_reader.position(m_lastPos[*slot]);
+                        float const   alt = m_reader.raw<float>();
+                        QString const ident = m_reader.string();
+                        if (!m_reader.isValid())
+                            return false;
+
+                        m_handles[*slot] = m_radar->addObject(ident, type, pos, alt);
+                        break;
+                    }
+                    case priv::LogOp::Remove: {
+                        auto const slot = int_readSlot();
+                        if (!slot.has_value())
+                            return false;
+
+                        m_radar->removeObject(std::exchange(m_handles[*slot], ObjectHandle{}));
+                        break;
+                    }
+                    case priv::LogOp::Clear:
+                        m_radar->removeAllObjects();
+                        std::fill(m_handles.begin(), m_handles.end(), ObjectHandle{});
+                        break;
+                    case priv::LogOp::ObjectProperty: {
+                        auto const slot = int_readSlot();
+                        auto const prop = int_readProperty(false);
+                        if (!slot.has_value() || !prop.has_value())
+                            return false;
+
+                        ObjectHandle const handle = m_handles[*slot];
+                        if (*prop == ObjectRadar::Property::Area || *prop == ObjectRadar::Property::Path) {
+                            bool const    issmooth = m_reader.raw<quint8>() != 0;
+                            quint64 const n        = m_reader.varint();
+                            /* Every vertex takes at least two bytes. */
+                            if (!m_reader.isValid() || n > m_log.size() / 2)
+                                return false;
+
+                            std::vector<QPointF>  vertices(n);
+                            std::array<qint64, 2> last = {};
+                            for (QPointF &v : vertices)
+                                v = m_reader.position(last);
+                            if (!m_reader.isValid())
+                                return false;
+
+                            if (*prop == ObjectRadar::Property::Area)
+                                m_radar->setArea(handle, RadarArea{ std::move(vertices), issmooth });
+                            else
+                                m_radar->setPath(handle, RadarPath{ std::move(vertices), issmooth });
+                            break;
+                        }
+
+                        QVariant const val = m_reader.value(*prop, m_lastPos[*slot]);
+                        if (!m_reader.isValid())
+                            return false;
+                        m_radar->setProperty(handle, *prop, val);
+                        break;
+                    }
+                    case priv::LogOp::ViewProperty: {
+                        auto const prop = int_readProperty(true);
+                        if (!prop.has_value())
+                            return false;
+
+                        QVariant const val = m_reader.value(*prop, m_lastCenter);
+                        if (!m_reader.isValid())
+                            return false;
+                        m_radar->setProperty(*prop, val);
+                        break;
+                    }
+                    case priv::LogOp::Batch: {
+                        quint32 const n = m_reader.raw<quint32>();
+                        /* Every update takes at least two bytes. */
+                        if (!m_reader.isValid() || n > m_log.size() / 2)
+                            return false;
+
+                        m_batch.clear();
+                        for (quint32 k = 0; k < n; k++) {
+                            auto const slot = int_readSlot();
+                            if (!slot.has_value())
+                                return false;
+
+                            ObjectRadar::ObjectUpdate upd;
+                            upd.m_handle = m_handles[*slot];
+                            upd.m_fields = m_reader.raw<quint8>();
+                            if (upd.m_fields & ObjectRadar::ObjectUpdate::Position)
+                                upd.m_position = m_reader.position(m_lastPos[*slot]);
+                            if (upd.m_fields & ObjectRadar::ObjectUpdate::Altitude)
+                                upd.m_altitude = m_reader.raw<float>();
+                            if (upd.m_fields & ObjectRadar::ObjectUpdate::Visibility)
+                                upd.m_isVisible = m_reader.raw<quint8>() != 0;
+                            if (upd.m_fields & ObjectRadar::ObjectUpdate::Motion) {
+                                upd.m_groundSpeed = m_reader.raw<float>();
+                                upd.m_heading     = m_reader.raw<float>();
+                            }
+                            m_batch.push_back(upd);
+                        }
+                        if (!m_reader.isValid())
+                            return false;
+
+                        m_radar->updateObjects(m_batch);
+                        m_updates += n;
+                        return true;
+                    }
+                    case priv::LogOp::Track: {
+                        auto const slot = int_readSlot();
+                        if (!slot.has_value())
+                            return false;
+
+                        m_radar->setTrackedObject(m_handles[*slot]);
+                        break;
+                    }
+                    default:
+                        /* Unknown record type. */
+                        return false;
+                }
+
+                ++m_updates;
+                return true;
+            } catch (...) { }
+
+            return false;
+        }
+    };
+}
+
+
+/* shared scene */
+namespace tfd {
+    /**
+     * \class RadarScenePrivate
+     * \brief internal state of a scene shared by object radars
+     */
+    class RadarScenePrivate {
+    public:
+        /**
+         * \brief  retrieves the sprite atlas for a given device pixel ratio
+         * \param  [in] dpr device pixel ratio of the view
+         * \return atlas shared by all views with the same device pixel ratio; created if there
+         *         is none yet
+         * \note   Atlases are released with the last view using them.
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        std::shared_ptr<priv::SpriteAtlas> sprites(qreal dpr) {
+            m_sprites.erase(std::remove_if(m_sprites.begin(), m_sprites.end(), [](auto const &atlas) { return atlas.expired(); }), m_sprites.end());
+            for (auto const &ref : m_sprites) {
+                auto atlas = ref.lock();
+                if (atlas->dpr() == dpr)
+                    return atlas;
+            }
+
+            auto atlas = std::make_shared<priv::SpriteAtlas>();
+            atlas->reset(dpr);
+            m_sprites.push_back(atlas);
+            return atlas;
+        }
+        /**
+         * \brief logs an object change to every update log recording the scene
+         * \param [in] write function writing the change to an update log
+         * \note  All object changes are logged through here, whichever view they were made
+         *        through (including the update channels it drains), so that the recording of
+         *        any view sees the whole scene. View properties and tracked objects are per view
+         *        and only logged by the view itself.
+         */
+        template<class F>
+        void record(F &&write) {
+            for (priv::UpdateLogWriter *log : m_recorders)
+                write(*log);
+        }
+
+        priv::ROM                                     m_objManager;    /**< radar object manager */
+        std::vector<std::weak_ptr<priv::SpriteAtlas>> m_sprites;       /**< sprite atlases in use, one per device pixel ratio */
+        std::vector<priv::UpdateLogWriter *>          m_recorders;     /**< update logs of the views recording the scene (owned by the views) */
+        size_t                                        m_viewCount = 0; /**< number of views showing the scene */
+    };
+}
+
+
+namespace tfd {
+    class tests::ObjectRadarTests;
+    class tests::ObjectRadarBenchmarks;
+
+    /**
+     * \class ObjectRadarPrivate
+     * \brief internal state of object radar
+     */
+    class ObjectRadarPrivate : public QObject {
+        Q_OBJECT
+
+    public:
+        /**
+         * \brief constructs the internal state of a view of a scene
+         * \param [in] scene scene the view shows; must not be *nullptr*
+         * \note  If the scene has *RadarObjectManager::gl_MaxTrackers* views already, the view
+         *        cannot track changes individually and repaints entirely every frame.
+         */
+        explicit ObjectRadarPrivate(std::shared_ptr<RadarScene> scene)
+            : m_scene(std::move(scene)), m_sceneData(*m_scene->m_data), m_objManager(m_sceneData.m_objManager),
+              m_changeTracker(m_objManager.openTracker()), m_c_sprites(m_sceneData.sprites(1.))
+        {
+            ++m_sceneData.m_viewCount;
+
+            m_zoomTimer.setSingleShot(true);
+            m_zoomTimer.setInterval(priv::gl_ZoomSettleMs);
+            connect(&m_zoomTimer, &QTimer::timeout, this, &ObjectRadarPrivate::int_settleZoom);
+        }
+        ~ObjectRadarPrivate() {
+            if (m_changeTracker.has_value())
+                m_objManager.closeTracker(*m_changeTracker);
+            auto &logs = m_sceneData.m_recorders;
+            logs.erase(std::remove(logs.begin(), logs.end(), m_recorder.get()), logs.end());
+
+            --m_sceneData.m_viewCount;
+        }
+
+    public slots:
+        /**
+         * \brief updates the internal cache that is used to store prepared display
+         *        resources and computed but rarely changed computation results
+         * 
+         * This function is usually not called by the user or the programmar explicitly.
+         * It's intended to be used as a slot. The function decides what resources to
+         * update based on the parameters of the signal.
+         * 
+         * \param [in] prop index of the property that was updated
+         * \param [in] val new value of the property
+         */
+        void updateCache(ObjectRadar::Property prop, QVariant const &val) {
+            Q_UNUSED(val);
+
+            /* Whether or not to update (= (re-)initialize) entire cache. */
+            bool const isall = prop == static_cast<ObjectRadar::Property>(INT_MAX);
+
+            int_updateCache(isall ? priv::gl_AllViewProperties : priv::int_propertyBit(prop));
+        }
+        /**
+         * \brief updates the *tracked object* after an object was added or removed
+         * \param [in] ident identifier of the object that was added or removed
+         * \note  If the tracked object was removed, the radar stops tracking. Since the tracked
+         *        object is referred to by handle, renaming it does not affect tracking.
+         */
+        void updateTrackedObject(std::optional<QString> const &ident) {
+            Q_UNUSED(ident);
+
+            if (!m_objManager.getIndex(m_trackedObject).has_value())
+                m_trackedObject = ObjectHandle{};
+        }
+        /**
+         * \brief schedules the next frame in *RedrawMode::OnDemand*
+         * 
+         * The frame is scheduled as soon as the frame rate cap (*UpdateRate*) allows. All
+         * changes arriving until then are drawn in that same frame.
+         * 
+         * \note  Every change that affects what is drawn ends up here, so this is also where the
+         *        projection of the last frame is marked as outdated. Otherwise, in
+         *        *RedrawMode::FixedRate* or if a frame is already scheduled, this does nothing.
+         */
+        void requestFrame() noexcept {
+            m_c_isProjected = false;
+            if (m_redrawMode != ObjectRadar::RedrawMode::OnDemand || m_redrawTimer.isActive())
+                return;
+
+            /* Wait for the remainder of the minimum frame period, if any. */
+            qint64 const period  = static_cast<qint64>(1000.f / m_updateRate);
+            qint64 const elapsed = m_frameClock.isValid() ? m_frameClock.elapsed() : period;
+            m_redrawTimer.start(static_cast<int>(std::clamp<qint64>(period - elapsed, 0, period)));
+        }
+
+    private:
+        friend class ObjectRadar;
+        friend class priv::GLSurface;
+        friend class tests::ObjectRadarTests;
+        friend void priv::int_layoutView(ObjectRadarPrivate &) noexcept;
+        friend size_t priv::int_ingestChannels(ObjectRadar &, ObjectRadarPrivate &) noexcept;
+        friend void priv::int_consumeChanges(ObjectRadarPrivate &) noexcept;
+
+        /* widget view settings */
+        float        m_updateRate      = 30.f;                              /**< updates (redraws) per second */
+        QPointF      m_radarCenter     = QPointF{ 0.f, 0.f };               /**< center point of the object radar, in [lat, long] */
+        QSizeF       m_radarRange      = QSizeF{ 5.f, 35.f };               /**< range of the radar view in [min, max] meters */
+        float        m_radarAlt        = 0.f;                               /**< altitude of the radar center, in meters above sea-level */
+        FP           m_staticTextFont  = FP{ ":/fonts/B612_Mono.ttf", 10 }; /**< properties for the static font INSIDE the radar view */
+        FP           m_labelFont       = FP{ ":/fonts/B612_Mono.ttf", 11 }; /**< properties for label font OUTSIDE the radar view */
+        FP           m_objLabelFont    = FP{ ":/fonts/B612_Mono.ttf", 9 };  /**< properties of the font used for object labels INSIDE the radar view */
+        QColor       m_fgndColor       = QColor(Qt::gray);                  /**< color used for text and indicators */
+        QColor       m_bgndColor       = QColor(Qt::black);                 /**< color used for backgrounds and surface fills */
+        int          m_areaOpacity     = 0.4f * 255;                        /**< opacity used for fill colors, in range [0 ... 255] */
+        int          m_outlineStrength = 2;                                 /**< width of area and path outlines, in pixels */
+        int          m_outlineStyle    = Qt::SolidLine;                     /**< style of path and area outline, one value of the *Qt::PenStyle* enum */
+        ObjectHandle m_trackedObject;                                       /**< currently tracked radar object or invalid handle if no object is being tracked */
+        ObjectRadar::RedrawMode m_redrawMode = ObjectRadar::RedrawMode::FixedRate; /**< how frames are scheduled */
+        float        m_predictionHorizon = 0.f;                             /**< maximum extrapolation time of moving objects, in seconds (0 if disabled) */
+        int          m_clusterCellSize = 0;                                 /**< edge length of the cluster cells, in pixels (0 if disabled) */
+        float        m_statisticsRate  = 0.f;                               /**< rate at which frame statistics are published, per second (0 if disabled) */
+        bool         m_isStatsOverlay  = false;                             /**< whether or not frame statistics are drawn on top of the view */
+        bool         m_isLabelVisible  = true;                              /**< whether or not objects are labeled */
+
+        /* scene */
+        std::shared_ptr<RadarScene> m_scene;         /**< scene the view shows */
+        RadarScenePrivate          &m_sceneData;     /**< internal state of the scene */
+        priv::ROM                  &m_objManager;    /**< radar object manager of the scene */
+        std::optional<quint32>      m_changeTracker; /**< change tracker of the view, or empty if the scene ran out of trackers */
+
+        /* utilities */
+        QTimer    m_redrawTimer; /**< widget redraw timer (m_updateRate hz period, or single-shot in *RedrawMode::OnDemand*) */
+        QElapsedTimer m_frameClock; /**< time since the last frame was dispatched */
+        QTimer    m_zoomTimer;   /**< single-shot; running while the range changes in quick succession (zoom gesture) */
+        priv::GLSurface *m_glSurface = nullptr; /**< GPU drawing surface, or *nullptr* if the raster backend is used */
+        std::unique_ptr<priv::FrameComposer> m_composer; /**< worker composing frames, or *nullptr* if frames are drawn on the GUI thread */
+        std::unique_ptr<priv::ThreadPool>    m_pool;     /**< workers of the parallel per-frame pass; created on first use */
+        QSize     m_viewSize;    /**< current size of the widget, in pixels */
+        qreal     m_devicePixelRatio = 1.; /**< device pixel ratio of the widget */
+        bool      m_isViewDirty = true;    /**< whether or not the entire view must be repainted on the next frame */
+        std::vector<std::shared_ptr<UpdateChannel>> m_channels;  /**< open update channels */
+        std::vector<ObjectRadar::ObjectUpdate>      m_c_ingested; /**< scratch buffer receiving the drained update records */
+        std::unique_ptr<priv::UpdateLogWriter>      m_recorder;   /**< update log being recorded, or *nullptr* if not recording (registered with the scene) */
+        quint32   m_txDepth      = 0;               /**< number of open (nested) transactions of the view */
+        quint32   m_txProperties = 0;               /**< view properties changed in the open transaction */
+#if (defined TFD_INSTRUMENTATION)
+        priv::FrameProfiler m_profiler;             /**< statistics of the frame pipeline */
+#endif
+        priv::FrameArena    m_frameArena;           /**< storage of the per-frame scratch buffers (see *int_resetFrameArena()*) */
+
+        /* cached resources */
+        QPixmap m_c_radarCompass;         /**< pre-rendered image of the compass */
+        QPixmap m_c_radarScale;           /**< pre-rendered image of the radar scale (circles around center, etc.) */
+        QFont   m_c_radarStaticTextFont;  /**< cached font for all static text that is WITHIN the radar view */
+        QFont   m_c_radarLabelFont;       /**< cached font used for labels OUTSIDE the radar view */
+        QFont   m_c_radarObjectLabelFont; /**< cached font used for object labels INSIDE the radar view */
+        std::shared_ptr<priv::SpriteAtlas> m_c_sprites; /**< pre-rasterized object icons (shared by all views of the scene with the same device pixel ratio) */
+        std::vector<QStaticText> m_c_labels;    /**< laid-out object labels (by slot index) */
+        std::pmr::vector<QPainter::PixmapFragment> m_c_fragments{ &m_frameArena }; /**< scratch buffer for batched sprite blits (frame arena) */
+        std::array<std::pair<qint64, QImage>, 3> m_c_sceneImages; /**< scale, compass and sprite atlas converted for off-thread composition, with the key of what they were converted from */
+
+        /* per-frame projection */
+        priv::ProjectionParams m_c_projection;      /**< projection terms for the current center, range and size */
+        std::vector<quint32>   m_c_inRange;         /**< dense indices of all objects within the radar range */
+        bool                   m_c_isProjected = false; /**< whether *m_c_inRange* and *m_c_screenPositions* are still current (see *int_updateProjection()*) */
+        std::pmr::vector<QPointF> m_c_geoPositions{ &m_frameArena }; /**< [lat, long] positions of all objects in *m_c_inRange* (only gathered if extrapolating; frame arena) */
+        std::pmr::vector<priv::LocalPosition> m_c_localPositions{ &m_frameArena }; /**< local positions of all objects in *m_c_inRange* (only gathered if not extrapolating; frame arena) */
+        std::vector<QPointF>   m_c_screenPositions; /**< screen positions of all objects in *m_c_inRange* */
+        std::vector<priv::CullChunk> m_c_chunks;    /**< per-chunk draw lists of the parallel pass */
+        std::pmr::vector<QPointF> m_c_velocities{ &m_frameArena }; /**< velocities of all objects in *m_c_inRange* (only gathered if extrapolating; frame arena) */
+        std::pmr::vector<double>  m_c_fixTimes{ &m_frameArena };   /**< times of the last position update of all objects in *m_c_inRange* (ditto) */
+        double                 m_c_frameTime = 0.;  /**< time the current frame shows, on the clock of the object manager */
+        quint64                m_c_viewRevision = 1; /**< incremented whenever *m_c_geometryProjection* changes */
+        priv::ProjectionParams m_c_geometryProjection; /**< projection the cached geometry of areas and paths is built with; lags behind *m_c_projection* during zoom gestures */
+        double                 m_c_zoomScale = 1.;  /**< scale from *m_c_geometryProjection* to *m_c_projection* (about the screen center); 1 unless zooming */
+        QPolygonF              m_c_zoomedOutline;   /**< scratch buffer receiving outlines scaled during zoom gestures */
+        std::pair<QPointF, QPointF>      m_c_viewExtent; /**< lower and upper [lat, long] corners of the visible area */
+        std::vector<priv::ShapeGeometry> m_c_shapes; /**< screen-space geometry of areas and paths (by slot index) */
+        std::shared_ptr<QPolygonF const> m_c_noOutline = std::make_shared<QPolygonF const>(); /**< empty outline shared by all culled shapes */
+
+        /* dirty-region tracking */
+        std::vector<QRect>   m_c_drawnRects; /**< screen area covered by each object as of the last frame (by slot index; null if not drawn) */
+        std::vector<quint32> m_c_dirtySlots; /**< scratch buffer receiving the dirty slots of a frame */
+
+        /* label layout */
+        std::vector<priv::LabelPlacement> m_c_placements; /**< label placement of each object as of the last frame (by slot index) */
+        priv::LabelGrid                   m_c_labelGrid;  /**< collision grid of the layout pass */
+        std::vector<quint32>              m_c_displaced;  /**< scratch buffer receiving the slots whose label placement or cluster changed */
+
+        /* clustering */
+        std::vector<quint32>       m_c_clusterCells;    /**< cluster cell each object was merged into as of the last frame, plus one (by slot index; 0 if drawn on its own) */
+        std::vector<priv::Cluster> m_c_clusters;        /**< badges as of the last frame */
+        std::pmr::vector<quint32>  m_c_cellCounts{ &m_frameArena };   /**< scratch buffer receiving the number of markers in each cluster cell (frame arena) */
+        std::pmr::vector<quint32>  m_c_cellClusters{ &m_frameArena }; /**< scratch buffer receiving the badge of each cluster cell, plus one (0 if none; frame arena) */
+        std::pmr::vector<quint32>  m_c_objectCells{ &m_frameArena };  /**< scratch buffer receiving the cluster cell of each object in *m_c_inRange* (frame arena) */
+        int                        m_c_clusterCols = 0; /**< number of columns of the cluster cell grid */
+        int                        m_c_clusterRows = 0; /**< number of rows of the cluster cell grid */
+
+        /**
+         * \brief switches to the raster backend if the GPU backend is in use
+         * \note  This is used if the GPU backend turns out to be unusable at run-time.
+         */
+        void int_useRasterBackend() noexcept {
+            if (m_glSurface == nullptr)
+                return;
+
+            /* The surface may be calling this; do not destroy it right away. */
+            m_glSurface->hide();
+            m_glSurface->deleteLater();
+            m_glSurface = nullptr;
+
+            m_isViewDirty = true;
+            requestFrame();
+        }
+        /**
+         * \brief  collects the objects that changed since the last frame into *m_c_dirtySlots*
+         * \return *true* if the changes could not be tracked individually and the entire view
+         *         must be considered dirty, *false* otherwise
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        bool int_collectChanges() {
+            m_c_dirtySlots.clear();
+            if (!m_changeTracker.has_value())
+                return true;
+
+            return m_objManager.takeChanges(*m_changeTracker, m_c_dirtySlots);
+        }
+        /**
+         * \brief  checks whether anything changed since the last frame, without computing where
+         * \return *true* if the next frame differs from the last one, *false* otherwise
+         */
+        bool int_takeChanges() noexcept {
+            try {
+                bool const isall  = int_collectChanges();
+                bool const isview = std::exchange(m_isViewDirty, false);
+
+                return isall || isview || !m_c_dirtySlots.empty();
+            } catch (...) { }
+
+            return true;
+        }
+        /**
+         * \brief  takes a snapshot of everything that is drawn in the next frame
+         * \return scene, or *nullptr* if there was an error
+         * \note   Only visible objects within the radar range are included; areas and paths only
+         *         if they overlap the view and at the level of detail of the current scale.
+         *         Culling, projection and layout are done here, on the same data the other
+         *         backends use; the composer only draws.
+         */
+        std::shared_ptr<priv::Scene const> int_makeScene() noexcept {
+            try {
+                auto scene = std::make_shared<priv::Scene>();
+
+                /* Convert the layers only if they were re-rendered since the last scene. */
+                auto const image = [this](size_t k, QPixmap const &pm, qint64 key) -> QImage const & {
+                    auto &[cached, img] = m_c_sceneImages[k];
+                    if (cached != key || img.isNull()) {
+                        img    = pm.toImage();
+                        cached = key;
+                    }
+                    return img;
+                };
+                scene->m_projection      = m_c_projection;
+                scene->m_zoomScale       = m_c_zoomScale;
+                scene->m_size            = m_viewSize;
+                scene->m_dpr             = m_devicePixelRatio;
+                scene->m_scale           = image(0, m_c_radarScale, m_c_radarScale.cacheKey());
+                scene->m_compass         = image(1, m_c_radarCompass, m_c_radarCompass.cacheKey());
+                scene->m_labelFont       = m_c_radarObjectLabelFont;
+                scene->m_areaOpacity     = m_areaOpacity;
+                scene->m_outlineStrength = m_outlineStrength;
+                scene->m_outlineStyle    = m_outlineStyle;
+
+                /*
+                 * Badges and labels are laid out here: placements stick from frame to frame and
+                 * are keyed like the label metrics cache, which both live on this thread.
+                 */
+                int_updateProjection();
+                int_layoutFrame();
+                scene->m_clusters  = m_c_clusters;
+                scene->m_fgndColor = m_fgndColor;
+                scene->m_bgndColor = m_bgndColor;
+
+                /* Sprites are looked up (and rasterized, if new) before the atlas is converted. */
+                m_c_sprites->trim();
+                for (size_t j = 0; j < m_c_inRange.size(); j++) {
+                    size_t const i = m_c_inRange[j];
+                    if (!int_hasMarker(i) || int_clusterOf(i).has_value())
+                        continue;
+                    auto const src = int_spriteOf(i);
+                    if (!src.has_value())
+                        continue;
+
+                    QPointF const &pt    = m_c_screenPositions[j];
+                    QRectF const   label = int_labelRect(i, pt);
+                    scene->m_markers.push_back(priv::Scene::Marker{
+                        pt, *src, int_colorOf(i), label.isNull() ? QString{} : m_objManager.identifiers()[i], label.topLeft() - pt
+                    });
+                }
+                /* Outlines are shared with the geometry cache; only shapes that changed (or came into view) are rebuilt. */
+                for (size_t i = 0; i < m_objManager.size(); i++) {
+                    if (!int_hasShape(i))
+                        continue;
+
+                    priv::ShapeGeometry const &geom = int_geometryOf(i);
+                    if (geom.m_outline->isEmpty())
+                        continue;
+                    scene->m_outlines.push_back(priv::Scene::Outline{
+                        geom.m_outline, int_colorOf(i), m_objManager.types()[i] == ObjectRadar::ObjectType::Area
+                    });
+                }
+                scene->m_sprites = image(2, m_c_sprites->pixmap(), static_cast<qint64>(m_c_sprites->revision()));
+
+                return scene;
+            } catch (...) { }
+
+            return nullptr;
+        }
+        /**
+         * \brief  drains all update channels
+         * \return drained update records, in order per channel
+         * \note   Channels that were released by their producer are closed after being drained.
+         */
+        std::vector<ObjectRadar::ObjectUpdate> const &int_drainChannels() noexcept {
+            m_c_ingested.clear();
+            for (size_t k = 0; k < m_channels.size();) {
+                UpdateChannelPrivate &ch = *m_channels[k]->m_data;
+                try {
+                    ch.drain(m_c_ingested);
+                } catch (...) { /* Try again next frame. */ }
+
+                /* Only the object radar holds a reference; nobody can push anymore. */
+                if (m_channels[k].use_count() == 1 && ch.m_head.load(std::memory_order_acquire) == ch.m_tail.load(std::memory_order_relaxed)) {
+                    ch.close();
+                    m_channels[k] = std::move(m_channels.back());
+                    m_channels.pop_back();
+
+                    continue;
+                }
+                k++;
+            }
+            return m_c_ingested;
+        }
+        /**
+         * \brief updates the cached resources that depend on a set of view properties
+         * 
+         * Every resource is rebuilt at most once, no matter how many of the properties it
+         * depends on changed; this is what makes committing a transaction cheap.
+         * 
+         * \param [in] props set of view properties that changed (see *priv::int_propertyBit()*)
+         * \param [in] issettle whether or not a zoom gesture settled, i.e., a range change is to
+         *        be applied in full without starting a new gesture {def: false}
+         */
+        void int_updateCache(quint32 props, bool issettle = false) {
+            auto const is = [props](ObjectRadar::Property p) { return (props & priv::int_propertyBit(p)) != 0; };
+            
+            /* Fonts. */
+            if (is(ObjectRadar::Property::StaticTextFont))
+                m_c_radarStaticTextFont = priv::int_makeFont(m_staticTextFont);
+            if (is(ObjectRadar::Property::LabelFont))
+                m_c_radarLabelFont = priv::int_makeFont(m_labelFont);
+            if (is(ObjectRadar::Property::ObjectLabelFont)) {
+                m_c_radarObjectLabelFont = priv::int_makeFont(m_objLabelFont);
+
+                m_c_labels.clear();
+            }
+
+            /*
+             * Icon sprites are keyed by color, so a new foreground color needs no new atlas; only
+             * a new device pixel ratio does. If there is no memory for it, the sprites of the
+             * current atlas are scaled instead.
+             */
+            if (m_c_sprites->dpr() != m_devicePixelRatio) {
+                try {
+                    m_c_sprites = m_sceneData.sprites(m_devicePixelRatio);
+                } catch (...) { }
+            }
+
+            /*
+             * Projection and spatial index. If the range alone changes in quick succession (zoom
+             * gesture), e.g., while a wheel or pinch gesture is under way, only the projection is
+             * updated. The geometry of areas and paths and the pre-rendered radar scale are kept
+             * and drawn scaled by *m_c_zoomScale* about the screen center (see *int_zoomed()*),
+             * so that range rings and shapes stay in line with the markers, which are projected
+             * anew every frame. The scale, the geometry and the spatial index are rebuilt in full
+             * once the range settled (see *int_settleZoom()*).
+             */
+            bool const iszoom = !issettle && props == priv::int_propertyBit(ObjectRadar::Property::RadarRange);
+            bool const isstep = iszoom && m_zoomTimer.isActive() && m_c_geometryProjection.m_pxPerMeter > 0.;
+            if (iszoom)
+                m_zoomTimer.start();
+            if (is(ObjectRadar::Property::RadarCenter) || is(ObjectRadar::Property::RadarRange)) {
+                m_c_projection = priv::int_makeProjection(m_radarCenter, m_radarRange, m_viewSize);
+
+                /* North is up; the top-left and bottom-right corners span the visible area. */
+                QPointF const tl = priv::int_unprojectPosition(m_c_projection, QPointF{ 0., 0. });
+                QPointF const br = priv::int_unprojectPosition(m_c_projection, QPointF{ QPoint{ m_viewSize.width(), m_viewSize.height() } });
+                m_c_viewExtent   = { QPointF{ br.x(), tl.y() }, QPointF{ tl.x(), br.y() } };
+
+                if (isstep)
+                    m_c_zoomScale = m_c_projection.m_pxPerMeter / m_c_geometryProjection.m_pxPerMeter;
+                else {
+                    /* Invalidates the screen-space geometry of all areas and paths. */
+                    m_c_geometryProjection = m_c_projection;
+                    m_c_zoomScale          = 1.;
+                    ++m_c_viewRevision;
+                }
+            }
+            if (is(ObjectRadar::Property::RadarRange) && !isstep)
+                m_objManager.adaptIndex(m_radarRange.height());
+
+            /* Frame scheduling. */
+            if (is(ObjectRadar::Property::UpdateRate) || is(ObjectRadar::Property::RedrawMode))
+                int_applyRedrawMode();
+
+            /* Every view property except the scheduling properties affects what is drawn. */
+            quint32 const scheduling = priv::int_propertyBit(ObjectRadar::Property::UpdateRate) | priv::int_propertyBit(ObjectRadar::Property::RedrawMode);
+            if ((props & ~scheduling) != 0) {
+                m_isViewDirty = true;
+
+                requestFrame();
+            }
+
+            /* Pre-rendered layers; only re-rendered if something they depend on changed. */
+            bool const isfgfont = is(ObjectRadar::Property::ForegroundColor) || is(ObjectRadar::Property::StaticTextFont);
+            if (isfgfont || is(ObjectRadar::Property::BackgroundColor) || (is(ObjectRadar::Property::RadarRange) && !isstep))
+                priv::int_drawScale(m_c_radarScale, m_c_projection, m_radarRange, m_viewSize, m_devicePixelRatio, m_fgndColor, m_bgndColor, m_c_radarStaticTextFont);
+            if (isfgfont)
+                priv::int_drawCompass(m_c_radarCompass, m_c_projection, m_viewSize, m_devicePixelRatio, m_fgndColor, m_c_radarStaticTextFont);
+        }
+        /**
+         * \brief completes a zoom gesture once the range stopped changing
+         * \note  Rebuilds everything that was only scaled while zooming (see *int_updateCache()*).
+         */
+        void int_settleZoom() noexcept {
+            m_zoomTimer.stop();
+            if (m_c_zoomScale == 1.)
+                return;
+
+            try {
+                int_updateCache(priv::int_propertyBit(ObjectRadar::Property::RadarRange), true);
+            } catch (...) { }
+        }
+        /**
+         * \brief logs the current objects as if they were all added anew
+         * 
+         * Used when a recording starts and when all objects are replaced at once (snapshots),
+         * so that the log can be replayed from an empty radar.
+         *
+         * \param [in,out] log update log to write to
+         * \note  The tracked object is not logged; it belongs to the view that recorded the log.
+         */
+        void int_recordObjects(priv::UpdateLogWriter &log) const noexcept {
+            priv::ROM const &objs = m_objManager;
+
+            log.clear();
+            for (size_t i = 0; i < objs.size(); i++) {
+                quint32 const slot = objs.getHandle(i).index();
+
+                log.add(slot, objs.identifiers()[i], objs.types()[i], objs.positions()[i], objs.altitudes()[i]);
+                if (objs.colors()[i].isValid())
+                    log.objectProperty(slot, ObjectRadar::Property::Color, QVariant::fromValue(objs.colors()[i]));
+                if (!objs.visibility()[i])
+                    log.objectProperty(slot, ObjectRadar::Property::Visibility, QVariant(false));
+                if (!objs.shapes()[i].m_vertices.empty()) {
+                    bool const ispath = objs.types()[i] == ObjectRadar::ObjectType::Path;
+
+                    log.shape(slot, ispath ? ObjectRadar::Property::Path : ObjectRadar::Property::Area, objs.shapes()[i]);
+                }
+                if (objs.groundSpeeds()[i] != 0.f || objs.headings()[i] != 0.f) {
+                    /* Typed updates don't range-check the track, unlike *Property::Heading*. */
+                    ObjectRadar::ObjectUpdate upd;
+                    upd.m_fields      = ObjectRadar::ObjectUpdate::Motion;
+                    upd.m_groundSpeed = objs.groundSpeeds()[i];
+                    upd.m_heading     = objs.headings()[i];
+
+                    log.beginBatch();
+                    log.update(slot, upd);
+                    log.endBatch();
+                }
+            }
+        }
+        /**
+         * \brief  encodes all objects and view properties into a snapshot
+         * \return snapshot, padded to whole words; the actual size is stored in the header
+         * \note   This function may throw *std::bad_alloc* and *std::overflow_error*.
+         * \see    priv::SnapshotHeader
+         */
+        std::vector<quint64> int_encodeSnapshot() const {
+            priv::ROM const &objs  = m_objManager;
+            size_t const     n     = objs.size();
+            FP const *const  fonts[] = { &m_staticTextFont, &m_labelFont, &m_objLabelFont };
+
+            /* Size all sections first so that the snapshot is written in one go. */
+            quint64 nlods = 0, nverts = 0, nchars = 0;
+            for (size_t i = 0; i < n; i++) {
+                priv::Shape const &shape = objs.shapes()[i];
+
+                nlods  += shape.m_lods.size();
+                nverts += shape.m_vertices.size();
+                for (priv::Lod const &lod : shape.m_lods)
+                    nverts += lod.m_vertices.size();
+                nchars += objs.identifiers()[i].size();
+            }
+            for (FP const *font : fonts)
+                nchars += font->m_family.size();
+            if (nlods > std::numeric_limits<quint32>::max() || nchars > std::numeric_limits<quint32>::max())
+                throw std::overflow_error("snapshot too large");
+
+            priv::SnapshotHeader hdr;
+            hdr.m_objectCount  = static_cast<quint32>(n);
+            hdr.m_lodCount     = static_cast<quint32>(nlods);
+            hdr.m_vertexCount  = nverts;
+            hdr.m_stringLength = nchars;
+            hdr.m_objectOffset = priv::int_alignSection(sizeof(priv::SnapshotHeader));
+            hdr.m_lodOffset    = priv::int_alignSection(hdr.m_objectOffset + n * sizeof(priv::SnapshotObject));
+            hdr.m_vertexOffset = priv::int_alignSection(hdr.m_lodOffset + nlods * sizeof(priv::SnapshotLod));
+            hdr.m_stringOffset = priv::int_alignSection(hdr.m_vertexOffset + nverts * sizeof(priv::SnapshotVertex));
+            hdr.m_size         = hdr.m_stringOffset + nchars * sizeof(char16_t);
+
+            std::vector<quint64> buf(priv::int_alignSection(hdr.m_size) / sizeof(quint64));
+            uchar *const         data = reinterpret_cast<uchar *>(buf.data());
+
+            quint64 nextlod = 0, nextvert = 0, nextchar = 0;
+            auto const putverts = [&](std::vector<QPointF> const &pts) {
+                quint64 const first = nextvert;
+                for (QPointF const &pt : pts) {
+                    priv::SnapshotVertex const v = { pt.x(), pt.y() };
+
+                    std::memcpy(data + hdr.m_vertexOffset + nextvert++ * sizeof(v), &v, sizeof(v));
+                }
+                return first;
+            };
+            auto const putstr = [&](QString const &str) {
+                priv::SnapshotString const ref = { static_cast<quint32>(nextchar), static_cast<quint32>(str.size()) };
+
+                std::memcpy(data + hdr.m_stringOffset + nextchar * sizeof(char16_t), str.utf16(), str.size() * sizeof(char16_t));
+                nextchar += str.size();
+                return ref;
+            };
+
+            /* Objects, in dense order. */
+            for (size_t i = 0; i < n; i++) {
+                priv::Shape const &shape = objs.shapes()[i];
+
+                priv::SnapshotObject obj;
+                obj.m_position[0]  = objs.positions()[i].x();
+                obj.m_position[1]  = objs.positions()[i].y();
+                obj.m_color        = priv::int_packColor(objs.colors()[i]);
+                obj.m_ident        = putstr(objs.identifiers()[i]);
+                obj.m_altitude     = objs.altitudes()[i];
+                obj.m_groundSpeed  = objs.groundSpeeds()[i];
+                obj.m_heading      = objs.headings()[i];
+                obj.m_type         = static_cast<quint32>(objs.types()[i]);
+                obj.m_vertexCount  = static_cast<quint32>(shape.m_vertices.size());
+                obj.m_vertexIndex  = putverts(shape.m_vertices);
+                obj.m_lodIndex     = static_cast<quint32>(nextlod);
+                obj.m_lodCount     = static_cast<quint32>(shape.m_lods.size());
+                obj.m_isVisible    = objs.visibility()[i];
+                obj.m_isSmooth     = shape.m_isSmooth;
+                for (priv::Lod const &lod : shape.m_lods) {
+                    priv::SnapshotLod rec;
+                    rec.m_tolerance   = lod.m_tolerance;
+                    rec.m_vertexCount = static_cast<quint32>(lod.m_vertices.size());
+                    rec.m_vertexIndex = putverts(lod.m_vertices);
+
+                    std::memcpy(data + hdr.m_lodOffset + nextlod++ * sizeof(rec), &rec, sizeof(rec));
+                }
+                std::memcpy(data + hdr.m_objectOffset + i * sizeof(obj), &obj, sizeof(obj));
+            }
+
+            /* View properties. */
+            priv::SnapshotView &view = hdr.m_view;
+            view.m_center[0]         = m_radarCenter.x();
+            view.m_center[1]         = m_radarCenter.y();
+            view.m_range[0]          = m_radarRange.width();
+            view.m_range[1]          = m_radarRange.height();
+            view.m_fgndColor         = priv::int_packColor(m_fgndColor);
+            view.m_bgndColor         = priv::int_packColor(m_bgndColor);
+            for (size_t k = 0; k < std::size(fonts); k++) {
+                view.m_fonts[k].m_family    = putstr(fonts[k]->m_family);
+                view.m_fonts[k].m_pointSize = fonts[k]->m_pointSize;
+                view.m_fonts[k].m_weight    = fonts[k]->m_weight;
+                view.m_fonts[k].m_isItalic  = fonts[k]->m_isItalic;
+            }
+            view.m_updateRate        = m_updateRate;
+            view.m_radarAlt          = m_radarAlt;
+            view.m_predictionHorizon = m_predictionHorizon;
+            view.m_statisticsRate    = m_statisticsRate;
+            view.m_areaOpacity       = m_areaOpacity;
+            view.m_outlineStrength   = m_outlineStrength;
+            view.m_outlineStyle      = m_outlineStyle;
+            view.m_redrawMode        = static_cast<qint32>(m_redrawMode);
+            view.m_clusterCellSize   = m_clusterCellSize;
+            view.m_isStatsOverlay    = m_isStatsOverlay;
+            view.m_isLabelVisible    = m_isLabelVisible;
+
+            auto const tracked   = objs.getIndex(m_trackedObject);
+            view.m_trackedObject = tracked.has_value() ? static_cast<quint32>(*tracked) : priv::gl_SnapshotNoObject;
+
+            std::memcpy(data, &hdr, sizeof(hdr));
+            return buf;
+        }
+        /**
+         * \brief  decodes the view properties stored in a snapshot
+         * \param  [in] hdr header of the snapshot; must have been validated with
+         *         *priv::int_checkSnapshot()*
+         * \return property values, in the order of *ObjectRadar::Property*
+         * \note   The values are not validated; see *priv::int_isValidPropertyValue()*.
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        static std::vector<std::pair<ObjectRadar::Property, QVariant>> int_decodeView(priv::SnapshotHeader const &hdr) {
+            priv::SnapshotView const &view = hdr.m_view;
+
+            auto const *strs = reinterpret_cast<QChar const *>(reinterpret_cast<uchar const *>(&hdr) + hdr.m_stringOffset);
+            auto const  font = [strs](priv::SnapshotFont const &fp) {
+                QString const family{ strs + fp.m_family.m_offset, static_cast<qsizetype>(fp.m_family.m_length) };
+
+                return QVariant::fromValue(FontProperties{ family, fp.m_pointSize, fp.m_weight, fp.m_isItalic != 0 });
+            };
+
+            return {
+                { ObjectRadar::Property::UpdateRate,        QVariant(view.m_updateRate)                                },
+                { ObjectRadar::Property::StaticTextFont,    font(view.m_fonts[0])                                      },
+                { ObjectRadar::Property::LabelFont,         font(view.m_fonts[1])                                      },
+                { ObjectRadar::Property::ObjectLabelFont,   font(view.m_fonts[2])                                      },
+                { ObjectRadar::Property::ForegroundColor,   QVariant::fromValue(priv::int_unpackColor(view.m_fgndColor)) },
+                { ObjectRadar::Property::BackgroundColor,   QVariant::fromValue(priv::int_unpackColor(view.m_bgndColor)) },
+                { ObjectRadar::Property::RadarCenter,       QVariant(QPointF{ view.m_center[0], view.m_center[1] })    },
+                { ObjectRadar::Property::RadarAltitude,     QVariant(view.m_radarAlt)                                  },
+                { ObjectRadar::Property::RadarRange,        QVariant(QSizeF{ view.m_range[0], view.m_range[1] })       },
+                { ObjectRadar::Property::AreaOpacity,       QVariant(view.m_areaOpacity)                               },
+                { ObjectRadar::Property::OutlineStrength,   QVariant(view.m_outlineStrength)                           },
+                { ObjectRadar::Property::OutlineStyle,      QVariant(view.m_outlineStyle)                              },
+                { ObjectRadar::Property::RedrawMode,        QVariant(view.m_redrawMode)                                },
+                { ObjectRadar::Property::PredictionHorizon, QVariant(view.m_predictionHorizon)                         },
+                { ObjectRadar::Property::ClusterCellSize,   QVariant(view.m_clusterCellSize)                           },
+                { ObjectRadar::Property::StatisticsRate,    QVariant(view.m_statisticsRate)                            },
+                { ObjectRadar::Property::StatisticsOverlay, QVariant(view.m_isStatsOverlay != 0)                       },
+                { ObjectRadar::Property::LabelVisibility,   QVariant(view.m_isLabelVisible != 0)                       }
+            };
+        }
+        /**
+         * \brief (re-)configures the redraw timer for the current redraw mode and update rate
+         */
+        void int_applyRedrawMode() noexcept {
+            if (m_redrawMode == ObjectRadar::RedrawMode::FixedRate) {
+                priv::int_tryInitializeRepaintTimer(m_updateRate, &m_redrawTimer);
+
+                return;
+            }
+
+            /* Stop ticking; the next frame is scheduled as soon as something changes. */
+            m_redrawTimer.stop();
+            m_redrawTimer.setSingleShot(true);
+            if (m_isViewDirty)
+                requestFrame();
+        }
+        /**
+         * \brief  checks whether an object is drawn as a marker
+         * \param  [in] i dense index of the object
+         * \return *true* if the object is visible and has a marker, *false* otherwise
+         */
+        bool int_hasMarker(size_t i) const noexcept {
+            auto const type = m_objManager.types()[i];
+
+            return m_objManager.visibility()[i] && type != ObjectRadar::ObjectType::Path && type != ObjectRadar::ObjectType::Area;
+        }
+        /**
+         * \brief  checks whether an object is drawn as an area or path
+         * \param  [in] i dense index of the object
+         * \return *true* if the object is visible and has enough vertices to be drawn, *false*
+         *         otherwise
+         */
+        bool int_hasShape(size_t i) const noexcept {
+            auto const   type = m_objManager.types()[i];
+            size_t const n    = m_objManager.shapes()[i].m_vertices.size();
+
+            return m_objManager.visibility()[i] && ((type == ObjectRadar::ObjectType::Area && n >= 3) || (type == ObjectRadar::ObjectType::Path && n >= 2));
+        }
+        /**
+         * \brief  retrieves the screen-space geometry of an area or path
+         * \param  [in] i dense index of the object
+         * \return geometry; rebuilt only if the shape or the view changed since it was built, or
+         *         if the shape came into view
+         * \note   The geometry is built with *m_c_geometryProjection*; during zoom gestures, map it
+         *         onto the screen with *int_zoomed()*.
+         * \note   The level of detail is picked from the scale of that projection; shapes outside
+         *         of the view have an empty outline.
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        priv::ShapeGeometry &int_geometryOf(size_t i) {
+            quint32 const slot = m_objManager.getHandle(i).index();
+            quint64 const rev  = m_objManager.shapeRevisions()[i];
+            if (m_c_shapes.size() <= slot)
+                m_c_shapes.resize(m_objManager.slotCount());
+
+            /* Shapes entirely outside of the view are not projected at all. */
+            priv::Shape const &shape     = m_objManager.shapes()[i];
+            auto const         isoutside = [this, &ext = shape.m_extent]() {
+                return ext.second.x() < m_c_viewExtent.first.x() || ext.first.x() > m_c_viewExtent.second.x() || ext.second.y() < m_c_viewExtent.first.y() || ext.first.y() > m_c_viewExtent.second.y();
+            };
+
+            priv::ShapeGeometry &geom = m_c_shapes[slot];
+            if (geom.m_shapeRev != rev || geom.m_viewRev != m_c_viewRevision || (geom.m_isCulled && !isoutside())) {
+                bool const isarea = m_objManager.types()[i] == ObjectRadar::ObjectType::Area;
+
+                geom.m_isCulled = isoutside();
+                if (geom.m_isCulled)
+                    geom.m_outline = m_c_noOutline;
+                else
+                    geom.m_outline = std::make_shared<QPolygonF const>(priv::int_flattenShape(m_c_geometryProjection, shape.verticesAt(m_c_geometryProjection.m_pxPerMeter), shape.m_isSmooth, isarea));
+                geom.m_bounds    = geom.m_outline->boundingRect();
+                geom.m_shapeRev  = rev;
+                geom.m_viewRev   = m_c_viewRevision;
+                geom.m_triangles = nullptr;
+            }
+            return geom;
+        }
+        /**
+         * \brief  maps a point of the cached geometry onto the screen
+         * \param  [in] pt point, in the screen space of *m_c_geometryProjection*
+         * \return point, in the screen space of *m_c_projection*; **pt** unless zooming
+         */
+        QPointF int_zoomed(QPointF const &pt) const noexcept {
+            QPointF const &o = m_c_projection.m_origin;
+
+            return o + (pt - o) * m_c_zoomScale;
+        }
+        /**
+         * \brief  maps a rectangle of the cached geometry onto the screen
+         * \param  [in] rect rectangle, in the screen space of *m_c_geometryProjection*
+         * \return rectangle, in the screen space of *m_c_projection*; **rect** unless zooming
+         */
+        QRectF int_zoomed(QRectF const &rect) const noexcept {
+            return m_c_zoomScale == 1. ? rect : QRectF{ int_zoomed(rect.topLeft()), int_zoomed(rect.bottomRight()) };
+        }
+        /**
+         * \brief  calculates where the pre-rendered radar scale is drawn
+         * \return rectangle, in the screen space of *m_c_projection*; the entire view unless
+         *         zooming, in which case the scale is mapped like the cached geometry
+         */
+        QRectF int_scaleRect() const noexcept {
+            return int_zoomed(QRectF{ QPointF{ 0., 0. }, QSizeF{ m_viewSize } });
+        }
+        /**
+         * \brief  retrieves the outline of an area or path as drawn on the screen
+         * \param  [in] geom cached geometry of the shape
+         * \return outline; scaled into *m_c_zoomedOutline* during zoom gestures
+         * \note   The result is only valid until the next call.
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        QPolygonF const &int_zoomedOutline(priv::ShapeGeometry const &geom) {
+            QPolygonF const &outline = *geom.m_outline;
+            if (m_c_zoomScale == 1.)
+                return outline;
+
+            m_c_zoomedOutline.resize(outline.size());
+            for (qsizetype k = 0; k < outline.size(); k++)
+                m_c_zoomedOutline[k] = int_zoomed(outline[k]);
+            return m_c_zoomedOutline;
+        }
+        /**
+         * \brief  retrieves the triangulated fill of an area
+         * \param  [in] i dense index of the object
+         * \return triangles (three points per triangle); empty if the outline is not simple
+         * \note   The outline is triangulated lazily, i.e., only if it's filled by the GPU backend.
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        std::vector<QPointF> const &int_trianglesOf(size_t i) {
+            priv::ShapeGeometry &geom = int_geometryOf(i);
+            if (geom.m_triangles == nullptr) {
+                std::vector<QPointF> tris;
+                if (!priv::int_triangulate(*geom.m_outline, tris))
+                    tris.clear();
+
+                geom.m_triangles = std::make_shared<std::vector<QPointF> const>(std::move(tris));
+            }
+            return *geom.m_triangles;
+        }
+        /**
+         * \brief  retrieves the position an object is drawn at in the current frame
+         * \param  [in] i dense index of the object
+         * \return [lat, long] position, extrapolated along the velocity of the object if
+         *         *PredictionHorizon* is set
+         */
+        QPointF int_positionOf(size_t i) const noexcept {
+            QPointF pos = m_objManager.positions()[i];
+            if (m_predictionHorizon > 0.f)
+                priv::int_extrapolatePositions(&pos, &m_objManager.velocities()[i], &m_objManager.fixTimes()[i], m_c_frameTime, m_predictionHorizon, 1);
+
+            return pos;
+        }
+        /**
+         * \brief releases all scratch buffers held in the frame arena and resets it
+         * \note  The buffers only hold data of the current frame, so dropping them is safe.
+         *        Buffers that must survive to expose repaints (e.g., *m_c_screenPositions*) are
+         *        not kept in the arena.
+         */
+        void int_resetFrameArena() noexcept {
+            auto const release = [](auto &v) { v = std::decay_t<decltype(v)>{ v.get_allocator() }; };
+            release(m_c_fragments);
+            release(m_c_geoPositions);
+            release(m_c_localPositions);
+            release(m_c_velocities);
+            release(m_c_fixTimes);
+            release(m_c_cellCounts);
+            release(m_c_cellClusters);
+            release(m_c_objectCells);
+            m_frameArena.reset();
+        }
+        /**
+         * \brief starts a new frame: releases the scratch buffers of the last one, fixes the time
+         *        the frame shows and marks all objects that move by extrapolation alone as modified
+         * \note  Objects are marked until they reached the prediction horizon, plus one frame to
+         *        draw them at their final extrapolated position. In *RedrawMode::OnDemand*, this
+         *        keeps frames coming while anything is extrapolated.
+         */
+        void int_beginFrame() noexcept {
+            int_resetFrameArena();
+            m_c_frameTime = m_objManager.now();
+            if (m_predictionHorizon <= 0.f || !m_changeTracker.has_value())
+                return;
+
+            auto const  &vel    = m_objManager.velocities();
+            auto const  &fix    = m_objManager.fixTimes();
+            double const period = 1. / m_updateRate;
+            for (size_t i = 0; i < m_objManager.size(); i++)
+                if (!vel[i].isNull() && m_c_frameTime - fix[i] < m_predictionHorizon + period)
+                    m_objManager.touch(i, *m_changeTracker);
+        }
+#if (defined TFD_INSTRUMENTATION)
+        /**
+         * \brief  completes the statistics of the last frame and starts collecting the next one
+         * \return *true* if the statistics are due to be published, *false* otherwise
+         */
+        bool int_completeFrameStatistics() noexcept {
+            ObjectRadar::FrameStatistics &cur = m_profiler.m_current;
+            cur.m_objectCount  = static_cast<quint32>(m_objManager.size());
+            cur.m_inRangeCount = static_cast<quint32>(std::min(m_c_inRange.size(), m_objManager.size()));
+            cur.m_culledCount  = cur.m_objectCount - cur.m_inRangeCount;
+            cur.m_allocations  = m_frameArena.frameAllocations();
+            if (m_composer != nullptr)
+                cur.m_stageTimes[ObjectRadar::FrameStatistics::Compose] = m_composer->composeTime();
+
+            return m_profiler.beginFrame(m_updateRate, m_statisticsRate);
+        }
+#endif
+        /**
+         * \brief  calculates the screen area covered by the statistics overlay
+         * \return area, or a null rectangle if the overlay is disabled (or the module was built
+         *         without *TFD_INSTRUMENTATION*)
+         */
+        QRect int_overlayRect() const noexcept {
+#if (defined TFD_INSTRUMENTATION)
+            if (!m_isStatsOverlay)
+                return QRect{};
+
+            QFontMetricsF const fm{ m_c_radarStaticTextFont };
+            return QRect{ 8, 8, std::max(m_viewSize.width() - 16, 0), static_cast<int>(std::ceil(4. * fm.lineSpacing())) + 8 };
+#else
+            return QRect{};
+#endif
+        }
+        /**
+         * \brief draws the statistics of the last completed frame on top of the view
+         * \param [in,out] painter painter to draw with
+         * \param [in] bounds part of the widget that is repainted
+         * \note  Does nothing if the overlay is disabled (or the module was built without
+         *        *TFD_INSTRUMENTATION*).
+         */
+        void int_drawStatistics(QPainter &painter, QRect const &bounds) const noexcept {
+            QRect const rect = int_overlayRect();
+            if (rect.isNull() || !bounds.intersects(rect))
+                return;
+
+#if (defined TFD_INSTRUMENTATION)
+            try {
+                using Stats = ObjectRadar::FrameStatistics;
+
+                Stats const &st = m_profiler.m_last;
+                auto const   ms = [&st](Stats::Stage k) { return QString::number(st.m_stageTimes[k], 'f', 2); };
+                QString const lines[] = {
+                    QString{ "%1 / %2 fps  frame %3 ms  interval %4 ms" }.arg(st.m_achievedRate, 0, 'f', 1).arg(st.m_requestedRate, 0, 'f', 1).arg(st.m_frameTime, 0, 'f', 2).arg(st.m_interval, 0, 'f', 2),
+                    QString{ "ingest %1  layout %2  layers %3" }.arg(ms(Stats::Ingest), ms(Stats::Layout), ms(Stats::Layers)),
+                    QString{ "shapes %1  markers %2  labels %3  compose %4" }.arg(ms(Stats::Shapes), ms(Stats::Markers), ms(Stats::Labels), ms(Stats::Compose)),
+                    QString{ "objects %1  in range %2  culled %3  allocs %4" }.arg(st.m_objectCount).arg(st.m_inRangeCount).arg(st.m_culledCount).arg(st.m_allocations)
+                };
+
+                QColor bg = m_bgndColor;
+                bg.setAlpha(192);
+                painter.fillRect(rect, bg);
+                painter.setPen(m_fgndColor);
+                painter.setFont(m_c_radarStaticTextFont);
+
+                QFontMetricsF const fm{ m_c_radarStaticTextFont };
+                for (size_t k = 0; k < std::size(lines); k++)
+                    painter.drawText(QPointF{ rect.left() + 4., rect.top() + 4. + fm.ascent() + k * fm.lineSpacing() }, lines[k]);
+            } catch (...) { }
+#endif
+        }
+        /**
+         * \brief  retrieves the color an object is drawn with
+         * \param  [in] i dense index of the object
+         * \return object color, or the foreground color if the object has none
+         */
+        QColor int_colorOf(size_t i) const noexcept {
+            QColor const &col = m_objManager.colors()[i];
+
+            return col.isValid() ? col : m_fgndColor;
+        }
+        /**
+         * \brief  retrieves the icon sprite of an object
+         * \param  [in] i dense index of the object
+         * \return source rectangle in the sprite atlas, or an empty optional on error
+         */
+        std::optional<QRectF> int_spriteOf(size_t i) noexcept {
+            auto const band = priv::int_altitudeBand(m_objManager.altitudes()[i], m_radarAlt);
+
+            return m_c_sprites->get(m_objManager.types()[i], band, int_colorOf(i));
+        }
+        /**
+         * \brief  retrieves the laid-out label of an object
+         * \param  [in] i dense index of the object
+         * \return label; laid out again only if the identifier changed
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        QStaticText const &int_labelOf(size_t i) {
+            quint32 const  slot  = m_objManager.getHandle(i).index();
+            QString const &ident = m_objManager.identifiers()[i];
+            if (m_c_labels.size() <= slot)
+                m_c_labels.resize(m_objManager.slotCount());
+
+            QStaticText &label = m_c_labels[slot];
+            if (label.text() != ident) {
+                label.setText(ident);
+                label.setTextFormat(Qt::PlainText);
+                label.prepare(QTransform{}, m_c_radarObjectLabelFont);
+            }
+            return label;
+        }
+        /**
+         * \brief  calculates the screen position of the badge of a cluster cell
+         * \param  [in] cell index of the cluster cell
+         * \return center of the cell
+         */
+        QPointF int_cellCenter(quint32 cell) const noexcept {
+            double const  r = m_clusterCellSize;
+            QPointF const o = m_c_projection.m_origin;
+            int const     c = static_cast<int>(cell % static_cast<quint32>(m_c_clusterCols)) - m_c_clusterCols / 2;
+            int const     l = static_cast<int>(cell / static_cast<quint32>(m_c_clusterCols)) - m_c_clusterRows / 2;
+
+            return QPointF{ o.x() + (c + .5) * r, o.y() + (l + .5) * r };
+        }
+        /**
+         * \brief  retrieves the badge an object was merged into
+         * \param  [in] i dense index of the object
+         * \return screen position of the badge, or an empty optional if the object is drawn on its
+         *         own
+         */
+        std::optional<QPointF> int_clusterOf(size_t i) const noexcept {
+            quint32 const slot = m_objManager.getHandle(i).index();
+            if (slot >= m_c_clusterCells.size() || m_c_clusterCells[slot] == 0)
+                return std::optional<QPointF>{};
+
+            return std::optional<QPointF>(int_cellCenter(m_c_clusterCells[slot] - 1));
+        }
+        /**
+         * \brief merges the markers of objects that are close to each other on screen into badges
+         *
+         * The widget is divided into square cells of *ClusterCellSize* pixels, aligned to the
+         * radar center, and the markers of every cell that holds more than one of them are
+         * replaced by a single badge showing their number at the center of the cell. Since the cells are
+         * fixed on screen, an object only changes its cluster when it crosses a cell boundary,
+         * and clusters split up as the range narrows and objects spread over more cells. The
+         * tracked object is never merged.
+         *
+         * This pass stays serial: it is two linear sweeps over the objects in range, far cheaper
+         * than the projection that feeds it, and badges are numbered in draw order.
+         *
+         * \param [out] changed receives the slots that were merged into a different badge or split
+         *        out (appended)
+         * \note  Requires *int_projectObjects()* to be called before.
+         * \note  This function may throw *std::bad_alloc*.
+         */
+        void int_clusterObjects(std::vector<quint32> &changed) {
+            static constexpr quint32 gl_NoCell = ~0u;
+
+            m_c_clusters.clear();
+            if (m_clusterCellSize <= 0) {
+                /* Disabling clustering is a view change; the entire widget is repainted anyway. */
+                m_c_clusterCells.clear();
+                return;
+            }
+            m_c_clusterCells.resize(m_objManager.slotCount(), 0);
+
+            /* The grid covers the widget in all directions from the radar center. */
+            double const r = m_clusterCellSize;
+            m_c_clusterCols = 2 * (static_cast<int>(std::ceil(m_viewSize.width() / (2. * r))) + 1);
+            m_c_clusterRows = 2 * (static_cast<int>(std::ceil(m_viewSize.height() / (2. * r))) + 1);
+            m_c_cellCounts.assign(static_cast<size_t>(m_c_clusterCols) * m_c_clusterRows, 0);
+            m_c_cellClusters.assign(m_c_cellCounts.size(), 0);
+            m_c_objectCells.resize(m_c_inRange.size());
+
+            QPointF const o       = m_c_projection.m_origin;
+            auto const    tracked = m_objManager.getIndex(m_trackedObject);
+            auto const    cell    = [r](double v, double o, int n) {
+                return static_cast<quint32>(std::clamp(std::floor((v - o) / r) + n / 2, 0., n - 1.));
+            };
+            for (size_t j = 0; j < m_c_inRange.size(); j++) {
+                size_t const   i  = m_c_inRange[j];
+                QPointF const &pt = m_c_screenPositions[j];
+
+                m_c_objectCells[j] = gl_NoCell;
+                if (!int_hasMarker(i) || (tracked.has_value() && *tracked == i))
+                    continue;
+                m_c_objectCells[j] = cell(pt.y(), o.y(), m_c_clusterRows) * m_c_clusterCols + cell(pt.x(), o.x(), m_c_clusterCols);
+                m_c_cellCounts[m_c_objectCells[j]]++;
+            }
+
+            for (size_t j = 0; j < m_c_inRange.size(); j++) {
+                quint32 const c   = m_c_objectCells[j];
+                quint32       key = 0;
+                if (c != gl_NoCell && m_c_cellCounts[c] > 1) {
+                    if (m_c_cellClusters[c] == 0) {
+                        m_c_clusters.push_back(priv::Cluster{ int_cellCenter(c), m_c_cellCounts[c], c });
+                        m_c_cellClusters[c] = static_cast<quint32>(m_c_clusters.size());
+                    }
+                    key = c + 1;
+                }
+
+                quint32 const slot = m_objManager.getHandle(m_c_inRange[j]).index();
+                if (std::exchange(m_c_clusterCells[slot], key) != key)
+                    changed.push_back(slot);
+            }
+        }
+        /**
+         * \brief draws all cluster badges overlapping an area
+         * \param [in,out] painter painter to draw with
+         * \param [in] bounds area that is to be drawn
+         */
+        void int_drawClusters(QPainter &painter, QRect const &bounds) {
+            painter.setFont(m_c_radarObjectLabelFont);
+            for (priv::Cluster const &c : m_c_clusters)
+                if (bounds.intersects(priv::int_badgeBounds(c.m_center)))
+                    priv::int_drawBadge(painter, c, m_fgndColor, m_bgndColor);
+        }
+        /**
+         * \brief  retrieves the screen area of the label of an object
+         * \param  [in] i dense index of the object
+         * \param  [in] pt screen position of the object
+         * \return area as placed by the last *int_layoutLabels()* pass, right of the marker if
+         *         the label was not laid out yet, or a null rectangle if the label is hidden
+         *         (or the object was merged into a badge, or labels are disabled)
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        QRectF int_labelRect(size_t i, QPointF const &pt) {
+            if (!m_isLabelVisible || int_clusterOf(i).has_value())
+                return QRectF{};
+            QStaticText const &label = int_labelOf(i);
+            if (label.text().isEmpty())
+                return QRectF{};
+
+            quint32 const slot = m_objManager.getHandle(i).index();
+            if (slot < m_c_placements.size() && m_c_placements[slot].m_isLaidOut)
+                return m_c_placements[slot].m_rect;
+            return QRectF{ priv::int_labelOrigin(pt, label.size()), label.size() };
+        }
+        /**
+         * \brief lays out the labels of all objects that are within the radar range
+         *
+         * Labels are placed greedily: all markers and badges are obstacles, and every label takes
+         * the first of its candidate positions (right of, left of, above or below the marker)
+         * that does not overlap a marker or a label placed before it; labels that fit nowhere
+         * are hidden, as are those of objects that were merged into a badge.
+         * The tracked object is labeled first. Labels try the position they had in the last
+         * frame first, and objects that moved less than *gl_LabelStickiness* pixels keep their
+         * label exactly where it was, so labels neither jitter nor flip between positions.
+         *
+         * Unlike the projection this pass stays serial, even on the thread pool: every label
+         * depends on all labels placed before it, including those in neighbouring *LabelGrid*
+         * cells, so placing cells in parallel would make the result depend on thread timing and
+         * let labels flip between frames. The grid already keeps each placement to a handful of
+         * overlap tests.
+         *
+         * \param [out] changed receives the slots whose label moved, appeared or disappeared
+         *        (appended)
+         * \note  Requires *int_projectObjects()* to be called before.
+         * \note  This function may throw *std::bad_alloc*.
+         */
+        void int_layoutLabels(std::vector<quint32> &changed) {
+            /* Disabling labels is a view change; the previous placements are kept for later. */
+            if (!m_isLabelVisible)
+                return;
+
+            m_c_placements.resize(m_objManager.slotCount());
+            m_c_labelGrid.reset(m_viewSize);
+            for (size_t j = 0; j < m_c_inRange.size(); j++)
+                if (int_hasMarker(m_c_inRange[j]) && !int_clusterOf(m_c_inRange[j]).has_value())
+                    m_c_labelGrid.insert(priv::int_markerObstacle(m_c_screenPositions[j]));
+            for (priv::Cluster const &c : m_c_clusters)
+                m_c_labelGrid.insert(priv::int_badgeBounds(c.m_center));
+
+            auto const place = [this, &changed](size_t j) {
+                size_t const   i  = m_c_inRange[j];
+                QPointF const &pt = m_c_screenPositions[j];
+                if (!int_hasMarker(i) || int_clusterOf(i).has_value())
+                    return;
+
+                quint32 const          slot  = m_objManager.getHandle(i).index();
+                priv::LabelPlacement  &p     = m_c_placements[slot];
+                QStaticText const     &label = int_labelOf(i);
+                QRectF const           old   = p.m_isLaidOut ? p.m_rect : QRectF{};
+                QSizeF const           size  = label.size();
+
+                QPointF const d       = pt - p.m_anchor;
+                bool const    isstill = p.m_isLaidOut && !old.isNull() && old.size() == size && std::abs(d.x()) < priv::gl_LabelStickiness && std::abs(d.y()) < priv::gl_LabelStickiness;
+                if (label.text().isEmpty()) {
+                    p = priv::LabelPlacement{ pt, QRectF{}, 0, true };
+                } else if (isstill && !m_c_labelGrid.overlaps(old)) {
+                    m_c_labelGrid.insert(old);
+
+                    return;
+                } else {
+                    /* The previous position first, then all others in order of preference. */
+                    int const first = p.m_isLaidOut ? p.m_candidate : 0;
+                    p = priv::LabelPlacement{ pt, QRectF{}, first, true };
+                    for (int k = 0; k < priv::gl_LabelCandidates; k++) {
+                        int const    c = k == 0 ? first : (k <= first ? k - 1 : k);
+                        QRectF const r{ priv::int_labelOrigin(pt, size, c), size };
+                        if (m_c_labelGrid.overlaps(r))
+                            continue;
+
+                        m_c_labelGrid.insert(r);
+                        p.m_rect      = r;
+                        p.m_candidate = c;
+                        break;
+                    }
+                }
+                if (p.m_rect != old)
+                    changed.push_back(slot);
+            };
+
+            /* The tracked object is always labeled if it can be. */
+            auto const tracked = m_objManager.getIndex(m_trackedObject);
+            size_t     first   = m_c_inRange.size();
+            if (tracked.has_value())
+                first = static_cast<size_t>(std::find(m_c_inRange.begin(), m_c_inRange.end(), static_cast<quint32>(*tracked)) - m_c_inRange.begin());
+            if (first < m_c_inRange.size())
+                place(first);
+            for (size_t j = 0; j < m_c_inRange.size(); j++)
+                if (j != first)
+                    place(j);
+        }
+        /**
+         * \brief lays out the next frame: merges objects into badges, then places their labels
+         * \note  The slots of objects whose badge or label changed are collected in
+         *        *m_c_displaced*.
+         * \note  Requires *int_projectObjects()* to be called before.
+         * \note  This function may throw *std::bad_alloc*.
+         */
+        void int_layoutFrame() {
+            m_c_displaced.clear();
+            int_clusterObjects(m_c_displaced);
+            int_layoutLabels(m_c_displaced);
+        }
+        /**
+         * \brief  calculates the screen area covered by an object (marker and label, badge, or
+         *         outline)
+         * \param  [in] i dense index of the object
+         * \param  [in] pt screen position of the object (ignored for areas and paths)
+         * \return bounding rectangle
+         * \note   This function may throw *std::bad_alloc*.
+         */
+        QRect int_objectBounds(size_t i, QPointF const &pt) {
+            auto const type = m_objManager.types()[i];
+            if (type == ObjectRadar::ObjectType::Area || type == ObjectRadar::ObjectType::Path) {
+                priv::ShapeGeometry const &geom = int_geometryOf(i);
+                if (geom.m_outline->isEmpty())
+                    return QRect{};
+
+                qreal const w = m_outlineStrength / 2. + 1.;
+                return int_zoomed(geom.m_bounds).adjusted(-w, -w, w, w).toAlignedRect();
+            }
+
+            auto const badge = int_clusterOf(i);
+            if (badge.has_value())
+                return priv::int_badgeBounds(*badge);
+
+            QRect const  marker = priv::int_markerBounds(pt);
+            QRectF const label  = int_labelRect(i, pt);
+            if (label.isNull())
+                return marker;
+
+            return marker.united(label.toAlignedRect());
+        }
+        /**
+         * \brief  collects the parts of the widget that changed since the last frame
+         * 
+         * For every object that was modified, added or removed, both the area it covered in the
+         * last frame and the area it covers now are added to the region. Badges and labels are
+         * laid out again first, and objects whose badge or label was displaced count as modified.
+         * View property changes and resizes invalidate the entire widget.
+         * 
+         * \return region that needs to be repainted; empty if nothing changed
+         * \note   After this call, the region is considered repainted.
+         * \note   This function never throws exceptions. If the changes cannot be tracked (out
+         *         of memory), the entire widget is repainted.
+         */
+        QRegion int_takeDirtyRegion() noexcept {
+            QRect const all{ QPoint{ 0, 0 }, m_viewSize };
+
+            try {
+                bool const isall  = int_collectChanges();
+                bool const isview = std::exchange(m_isViewDirty, false);
+                if (isall || isview) {
+                    /* Rebuild the covered areas of all objects. */
+                    int_projectObjects();
+                    m_c_isProjected = true;
+                    int_layoutFrame();
+
+                    m_c_drawnRects.assign(m_objManager.slotCount(), QRect{});
+                    for (size_t j = 0; j < m_c_inRange.size(); j++)
+                        if (int_hasMarker(m_c_inRange[j]))
+                            m_c_drawnRects[m_objManager.getHandle(m_c_inRange[j]).index()] = int_objectBounds(m_c_inRange[j], m_c_screenPositions[j]);
+                    for (size_t i = 0; i < m_objManager.size(); i++)
+                        if (int_hasShape(i))
+                            m_c_drawnRects[m_objManager.getHandle(i).index()] = int_objectBounds(i, QPointF{});
+
+                    return QRegion{ all };
+                }
+                m_c_drawnRects.resize(m_objManager.slotCount());
+
+                /* Moving one object may displace the labels or badges of others; those are dirty, too. */
+                if (!m_c_dirtySlots.empty()) {
+                    int_projectObjects();
+                    m_c_isProjected = true;
+                    int_layoutFrame();
+                    m_c_dirtySlots.insert(m_c_dirtySlots.end(), m_c_displaced.begin(), m_c_displaced.end());
+                }
+
+                QRegion      region;
+                double const r2 = m_radarRange.height() * m_radarRange.height();
+                for (quint32 const slot : m_c_dirtySlots) {
+                    /* Erase the object where it was drawn before ... */
+                    QRect &drawn = m_c_drawnRects[slot];
+                    if (!drawn.isNull())
+                        region += drawn;
+                    drawn = QRect{};
+
+                    /* ... and draw it where it is now, if it's still drawn at all. */
+                    auto const i = m_objManager.getSlotIndex(slot);
+                    if (i.has_value() && int_hasShape(*i)) {
+                        drawn   = int_objectBounds(*i, QPointF{});
+                        region += drawn;
+
+                        continue;
+                    }
+                    if (!i.has_value() || !int_hasMarker(*i))
+                        continue;
+                    QPointF const pos = int_positionOf(*i);
+                    if (priv::int_distanceSquared(m_radarCenter, pos) > r2)
+                        continue;
+
+                    drawn   = int_objectBounds(*i, priv::int_projectPosition(m_c_projection, pos));
+                    region += drawn;
+                }
+
+                return region.intersected(all);
+            } catch (...) { m_isViewDirty = true; }
+
+            return QRegion{ all };
+        }
+
+        /**
+         * \brief culls and projects all objects, unless nothing changed since the last pass
+         * \note  The dirty region of a frame is computed from a fresh projection; the paint pass
+         *        of that frame reuses it. Any change in between goes through *requestFrame()*,
+         *        which makes the next call project anew.
+         */
+        void int_updateProjection() {
+            if (m_c_isProjected)
+                return;
+
+            int_projectObjects();
+            m_c_isProjected = true;
+        }
+        /**
+         * \brief culls all objects outside of the radar range and projects the positions of the
+         *        remaining objects to screen coordinates
+         * \note  The results are stored in *m_c_inRange* and *m_c_screenPositions*.
+         */
+        void int_projectObjects() {
+            /* For very large object counts, split the pass across cores. */
+            if (m_objManager.size() >= priv::gl_ParallelThreshold && int_projectObjectsParallel())
+                return;
+
+            /*
+             * Coarse range culling via the spatial index. Extrapolated objects may have moved into
+             * range since their last position update, so the query is widened by the distance the
+             * fastest object covers within the prediction horizon.
+             */
+            bool const   ispredicting = m_predictionHorizon > 0.f;
+            double const reach        = ispredicting ? static_cast<double>(m_objManager.maxGroundSpeed()) * m_predictionHorizon : 0.;
+            m_c_inRange.clear();
+            m_objManager.queryRadius(m_radarCenter, m_radarRange.height() + reach, m_c_inRange);
+
+            /*
+             * Gather positions so that the projection kernel can stream through them. Unless
+             * positions are extrapolated (which is done in [lat, long]), the compact local
+             * positions are projected.
+             */
+            size_t const n = m_c_inRange.size();
+            m_c_screenPositions.resize(n);
+            if (!ispredicting) {
+                auto const &local = m_objManager.localPositions();
+
+                m_c_localPositions.resize(n);
+                for (size_t j = 0; j < n; j++)
+                    m_c_localPositions[j] = local[m_c_inRange[j]];
+                priv::int_projectLocalPositions(priv::int_makeLocalProjection(m_c_projection, m_objManager.localFrame()), m_c_localPositions.data(), m_c_screenPositions.data(), n);
+            } else {
+                auto const &pos = m_objManager.positions();
+                auto const &vel = m_objManager.velocities();
+                auto const &fix = m_objManager.fixTimes();
+
+                m_c_geoPositions.resize(n);
+                m_c_velocities.resize(n);
+                m_c_fixTimes.resize(n);
+                for (size_t j = 0; j < n; j++) {
+                    m_c_geoPositions[j] = pos[m_c_inRange[j]];
+                    m_c_velocities[j]   = vel[m_c_inRange[j]];
+                    m_c_fixTimes[j]     = fix[m_c_inRange[j]];
+                }
+                priv::int_extrapolatePositions(m_c_geoPositions.data(), m_c_velocities.data(), m_c_fixTimes.data(), m_c_frameTime, m_predictionHorizon, n);
+                priv::int_projectPositions(m_c_projection, m_c_geoPositions.data(), m_c_screenPositions.data(), n);
+            }
+
+            /* Exact culling in screen space, the same way the parallel pass culls. */
+            double const r = m_c_projection.m_pxPerMeter * m_radarRange.height();
+            size_t       m = 0;
+            for (size_t j = 0; j < n; j++) {
+                QPointF const d = m_c_screenPositions[j] - m_c_projection.m_origin;
+                if (QPointF::dotProduct(d, d) > r * r)
+                    continue;
+
+                m_c_inRange[m]         = m_c_inRange[j];
+                m_c_screenPositions[m] = m_c_screenPositions[j];
+                m++;
+            }
+            m_c_inRange.resize(m);
+            m_c_screenPositions.resize(m);
+        }
+        /**
+         * \brief  culls and projects all objects in parallel chunks
+         * 
+         * Instead of querying the spatial index, every chunk streams through its part of the
+         * local position array (or, if extrapolating, of the [lat, long] position array): all
+         * positions are projected by the vectorized kernel and then culled in screen space (the
+         * projection preserves distances up to scale). The per-chunk draw lists are merged in
+         * chunk order, i.e., ordered by dense index.
+         * 
+         * \return *true* if the results are stored in *m_c_inRange* and *m_c_screenPositions*,
+         *         *false* if the pass could not be run in parallel
+         */
+        bool int_projectObjectsParallel() noexcept {
+            try {
+                if (m_pool == nullptr) {
+                    /* Created on first use only; single-core targets never spawn threads. */
+                    unsigned const ncores = std::thread::hardware_concurrency();
+                    if (ncores < 2)
+                        return false;
+
+                    m_pool = std::make_unique<priv::ThreadPool>(ncores - 1);
+                }
+
+                auto const  &pos     = m_objManager.positions();
+                size_t const n       = pos.size();
+                size_t const nchunks = (n + priv::gl_ParallelChunk - 1) / priv::gl_ParallelChunk;
+                if (m_c_chunks.size() < nchunks)
+                    m_c_chunks.resize(nchunks);
+                bool const ispredicting = m_predictionHorizon > 0.f;
+                for (size_t c = 0; c < nchunks; c++) {
+                    if (ispredicting)
+                        m_c_chunks[c].m_predicted.resize(priv::gl_ParallelChunk);
+                    m_c_chunks[c].m_projected.resize(priv::gl_ParallelChunk);
+                    m_c_chunks[c].m_inRange.reserve(priv::gl_ParallelChunk);
+                    m_c_chunks[c].m_positions.reserve(priv::gl_ParallelChunk);
+                }
+
+                priv::ProjectionParams const &params = m_c_projection;
+                priv::LocalProjection const   local  = priv::int_makeLocalProjection(params, m_objManager.localFrame());
+                double const                  r      = params.m_pxPerMeter * m_radarRange.height();
+                m_pool->parallelFor(nchunks, [&](size_t c) {
+                    priv::CullChunk &chunk = m_c_chunks[c];
+                    size_t const     lo    = c * priv::gl_ParallelChunk;
+                    size_t const     len   = std::min(priv::gl_ParallelChunk, n - lo);
+
+                    chunk.m_inRange.clear();
+                    chunk.m_positions.clear();
+                    if (ispredicting) {
+                        std::copy(pos.data() + lo, pos.data() + lo + len, chunk.m_predicted.begin());
+                        priv::int_extrapolatePositions(chunk.m_predicted.data(), m_objManager.velocities().data() + lo, m_objManager.fixTimes().data() + lo, m_c_frameTime, m_predictionHorizon, len);
+                        priv::int_projectPositions(params, chunk.m_predicted.data(), chunk.m_projected.data(), len);
+                    } else
+                        priv::int_projectLocalPositions(local, m_objManager.localPositions().data() + lo, chunk.m_projected.data(), len);
+                    for (size_t k = 0; k < len; k++) {
+                        QPointF const d = chunk.m_projected[k] - params.m_origin;
+                        if (QPointF::dotProduct(d, d) > r * r)
+                            continue;
+
+                        /* Capacity was reserved up-front; this never allocates. */
+                        chunk.m_inRange.push_back(static_cast<quint32>(lo + k));
+                        chunk.m_positions.push_back(chunk.m_projected[k]);
+                    }
+                });
+
+                /* Merge the draw lists. */
+                m_c_inRange.clear();
+                m_c_screenPositions.clear();
+                for (size_t c = 0; c < nchunks; c++) {
+                    m_c_inRange.insert(m_c_inRange.end(), m_c_chunks[c].m_inRange.begin(), m_c_chunks[c].m_inRange.end());
+                    m_c_screenPositions.insert(m_c_screenPositions.end(), m_c_chunks[c].m_positions.begin(), m_c_chunks[c].m_positions.end());
+                }
+                return true;
+            } catch (...) { }
+
+            return false;
+        }
+        /**
+         * \brief draws all visible areas and paths
+         * \param [in,out] painter painter to draw with
+         * \param [in] bounds part of the widget that is repainted; shapes outside are skipped
+         * \param [in] isfilled whether or not to fill areas (the GPU backend fills them itself)
+         */
+        void int_drawShapes(QPainter &painter, QRect const &bounds, bool isfilled) {
+            try {
+                for (size_t i = 0; i < m_objManager.size(); i++) {
+                    if (!int_hasShape(i) || !bounds.intersects(int_objectBounds(i, QPointF{})))
+                        continue;
+
+                    QColor const c = int_colorOf(i);
+                    painter.setPen(QPen{ c, static_cast<qreal>(m_outlineStrength), static_cast<Qt::PenStyle>(m_outlineStyle), Qt::RoundCap, Qt::RoundJoin });
+
+                    QPolygonF const &outline = int_zoomedOutline(int_geometryOf(i));
+                    if (m_objManager.types()[i] == ObjectRadar::ObjectType::Path) {
+                        painter.setBrush(Qt::NoBrush);
+                        painter.drawPolyline(outline);
+
+                        continue;
+                    }
+
+                    QColor fill = c;
+                    fill.setAlpha(m_areaOpacity * c.alpha() / 255);
+                    painter.setBrush(isfilled ? QBrush{ fill } : QBrush{ Qt::NoBrush });
+                    painter.drawPolygon(outline);
+                }
+            } catch (...) { /* Skip the rest of the shapes. */ }
+
+            painter.setBrush(Qt::NoBrush);
+        }
+        /**
+         * \brief draws all visible objects that are within the radar range, and their badges
+         * \param [in,out] painter painter to draw with
+         * \param [in] bounds part of the widget that is repainted; objects outside are skipped
+         * \note  Requires *int_projectObjects()* to be called before.
+         * \note  All icons are blitted from the sprite atlas in a single call.
+         */
+        void int_drawObjects(QPainter &painter, QRect const &bounds) {
+            try {
+                {
+                    TFD_PROFILE_STAGE(*this, Markers);
+                    m_c_sprites->trim();
+                    m_c_fragments.clear();
+                    m_c_fragments.reserve(m_c_inRange.size());
+
+                    qreal const scale = 1. / m_c_sprites->dpr();
+                    for (size_t j = 0; j < m_c_inRange.size(); j++) {
+                        size_t const   i  = m_c_inRange[j];
+                        QPointF const &pt = m_c_screenPositions[j];
+
+                        /* Skip hidden objects, objects without a marker, objects merged into a badge and objects outside the repainted area. */
+                        if (!int_hasMarker(i) || int_clusterOf(i).has_value() || !bounds.intersects(int_objectBounds(i, pt)))
+                            continue;
+
+                        auto const src = int_spriteOf(i);
+                        if (src.has_value())
+                            m_c_fragments.push_back(QPainter::PixmapFragment::create(pt, *src, scale, scale));
+                    }
+                    if (!m_c_fragments.empty())
+                        painter.drawPixmapFragments(m_c_fragments.data(), static_cast<int>(m_c_fragments.size()), m_c_sprites->pixmap());
+
+                    int_drawClusters(painter, bounds);
+                }
+                int_drawLabels(painter, bounds);
+            } catch (...) { /* Skip the rest of the frame. */ }
+        }
+        /**
+         * \brief draws the labels of all visible objects that are within the radar range
+         * \param [in,out] painter painter to draw with
+         * \param [in] bounds part of the widget that is repainted; labels outside are skipped
+         * \note  Requires *int_projectObjects()* to be called before. Labels are drawn where the
+         *        last *int_layoutLabels()* pass placed them.
+         * \note  This function may throw *std::bad_alloc*.
+         */
+        void int_drawLabels(QPainter &painter, QRect const &bounds) {
+            TFD_PROFILE_STAGE(*this, Labels);
+            painter.setFont(m_c_radarObjectLabelFont);
+            for (size_t j = 0; j < m_c_inRange.size(); j++) {
+                size_t const   i  = m_c_inRange[j];
+                QPointF const &pt = m_c_screenPositions[j];
+                if (!int_hasMarker(i) || !bounds.intersects(int_objectBounds(i, pt)))
+                    continue;
+
+                QRectF const rect = int_labelRect(i, pt);
+                if (rect.isNull())
+                    continue;
+
+                painter.setPen(int_colorOf(i));
+                painter.drawStaticText(rect.topLeft(), int_labelOf(i));
+            }
+        }
+    };
+
+
+    void UpdateChannelPrivate::int_wakeConsumer() noexcept {
+        if (m_isWakeupPending.exchange(true, std::memory_order_acq_rel))
+            return;
+
+        /* Posting is thread-safe; the consumer is only detached on destruction. */
+        std::unique_lock<std::mutex> lock{ m_consumerLock, std::try_to_lock };
+        if (!lock.owns_lock() || m_consumer == nullptr)
+            return;
+
+        ObjectRadarPrivate *consumer = m_consumer;
+        QMetaObject::invokeMethod(consumer, [consumer]() { consumer->requestFrame(); }, Qt::QueuedConnection);
+    }
+
+
+    namespace priv {
+        /**
+         * \brief  retrieves the GLSL version directive (and default precision) for a context
+         * \param  [in] ctx current OpenGL context
+         * \return shader source prefix
+         */
+        static QByteArray int_glslHeader(QOpenGLContext const *ctx) {
+            return ctx->isOpenGLES() ? "#version 300 es\nprecision mediump float;\n" : "#version 330 core\n";
+        }
+
+        /* shaders; attribute locations are bound explicitly before linking */
+        static char const *gl_LayerVertexShader = R"(
+            uniform float u_scale;
+            in vec2 a_pos;
+            out vec2 v_uv;
+
+            void main() {
+                v_uv        = vec2(a_pos.x * 0.5 + 0.5, 0.5 - a_pos.y * 0.5);
+                gl_Position = vec4(a_pos * u_scale, 0.0, 1.0);
+            }
+        )";
+        static char const *gl_LayerFragmentShader = R"(
+            uniform sampler2D u_texture;
+            in vec2  v_uv;
+            out vec4 o_color;
+
+            void main() {
+                o_color = texture(u_texture, v_uv);
+            }
+        )";
+        static char const *gl_MarkerVertexShader = R"(
+            uniform vec2  u_viewport;
+            uniform float u_extent;
+            in vec2 a_corner;
+            in vec2 a_center;
+            in vec4 a_uv;
+            out vec2 v_uv;
+
+            void main() {
+                vec2 px     = a_center + a_corner * u_extent;
+                v_uv        = mix(a_uv.xy, a_uv.zw, a_corner * 0.5 + 0.5);
+                gl_Position = vec4(px.x / u_viewport.x * 2.0 - 1.0, 1.0 - px.y / u_viewport.y * 2.0, 0.0, 1.0);
+            }
+        )";
+        static char const *gl_MeshVertexShader = R"(
+            uniform vec2 u_viewport;
+            in vec2 a_pos;
+            in vec4 a_color;
+            out vec4 v_color;
+
+            void main() {
+                v_color     = a_color;
+                gl_Position = vec4(a_pos.x / u_viewport.x * 2.0 - 1.0, 1.0 - a_pos.y / u_viewport.y * 2.0, 0.0, 1.0);
+            }
+        )";
+        static char const *gl_MeshFragmentShader = R"(
+            in vec4  v_color;
+            out vec4 o_color;
+
+            void main() {
+                o_color = v_color;
+            }
+        )";
+        static char const *gl_MarkerFragmentShader = R"(
+            uniform sampler2D u_texture;
+            in vec2  v_uv;
+            out vec4 o_color;
+
+            void main() {
+                o_color = texture(u_texture, v_uv);
+            }
+        )";
+
+        GLSurface::GLSurface(ObjectRadarPrivate *data, QWidget *parent)
+            : QOpenGLWidget(parent), m_data(data), m_isReady(false),
+              m_quadBuffer(QOpenGLBuffer::VertexBuffer), m_markerBuffer(QOpenGLBuffer::VertexBuffer),
+              m_meshBuffer(QOpenGLBuffer::VertexBuffer)
+        {
+            /* The object radar itself handles all input. */
+            setAttribute(Qt::WA_TransparentForMouseEvents);
+
+            QSurfaceFormat fmt = format();
+            if (QOpenGLContext::openGLModuleType() == QOpenGLContext::LibGL) {
+                fmt.setVersion(3, 3);
+                fmt.setProfile(QSurfaceFormat::CoreProfile);
+            } else
+                fmt.setVersion(3, 0);
+            setFormat(fmt);
+        }
+
+        GLSurface::~GLSurface() {
+            /* The base class destroys the context; this surface must not be told about it anymore. */
+            if (context() != nullptr)
+                disconnect(context(), nullptr, this, nullptr);
+
+            /* Resources must be released with the context current. */
+            makeCurrent();
+            int_releaseResources();
+            doneCurrent();
+        }
+
+        void GLSurface::int_releaseResources() noexcept {
+            m_scale.m_texture.reset();
+            m_compass.m_texture.reset();
+            m_sprites.m_texture.reset();
+            m_meshBuffer.destroy();
+            m_markerBuffer.destroy();
+            m_quadBuffer.destroy();
+            m_vao.destroy();
+        }
+
+        void GLSurface::int_fallBack() noexcept {
+            m_isReady = false;
+            m_data->int_useRasterBackend();
+        }
+
+        void GLSurface::initializeGL() {
+            initializeOpenGLFunctions();
+
+            QByteArray const hdr = int_glslHeader(context());
+            m_layerProgram.bindAttributeLocation("a_pos", 0);
+            m_markerProgram.bindAttributeLocation("a_corner", 0);
+            m_markerProgram.bindAttributeLocation("a_center", 1);
+            m_markerProgram.bindAttributeLocation("a_uv", 2);
+            m_meshProgram.bindAttributeLocation("a_pos", 0);
+            m_meshProgram.bindAttributeLocation("a_color", 1);
+
+            m_isReady = context()->format().majorVersion() >= 3
+                && m_layerProgram.addShaderFromSourceCode(QOpenGLShader::Vertex, hdr + gl_LayerVertexShader)
+                && m_layerProgram.addShaderFromSourceCode(QOpenGLShader::Fragment, hdr + gl_LayerFragmentShader)
+                && m_layerProgram.link()
+                && m_markerProgram.addShaderFromSourceCode(QOpenGLShader::Vertex, hdr + gl_MarkerVertexShader)
+                && m_markerProgram.addShaderFromSourceCode(QOpenGLShader::Fragment, hdr + gl_MarkerFragmentShader)
+                && m_markerProgram.link()
+                && m_meshProgram.addShaderFromSourceCode(QOpenGLShader::Vertex, hdr + gl_MeshVertexShader)
+                && m_meshProgram.addShaderFromSourceCode(QOpenGLShader::Fragment, hdr + gl_MeshFragmentShader)
+                && m_meshProgram.link()
+                && m_vao.create()
+                && m_quadBuffer.create()
+                && m_markerBuffer.create()
+                && m_meshBuffer.create();
+            if (!m_isReady) {
+                int_fallBack();
+
+                return;
+            }
+
+            /* Losing the context (e.g., on a driver reset) ends GPU drawing for good. */
+            connect(context(), &QOpenGLContext::aboutToBeDestroyed, this, [this]() {
+                makeCurrent();
+                int_releaseResources();
+                doneCurrent();
+                int_fallBack();
+            }, Qt::DirectConnection);
+
+            /* Unit quad as triangle strip; shared by layers and markers. */
+            static constexpr GLfloat quad[] = { -1.f, -1.f, 1.f, -1.f, -1.f, 1.f, 1.f, 1.f };
+            m_quadBuffer.bind();
+            m_quadBuffer.allocate(quad, sizeof quad);
+            m_markerBuffer.bind();
+            m_markerBuffer.setUsagePattern(QOpenGLBuffer::StreamDraw);
+            m_meshBuffer.bind();
+            m_meshBuffer.setUsagePattern(QOpenGLBuffer::StreamDraw);
+        }
+
+        void GLSurface::paintGL() {
+            if (!m_isReady)
+                return;
+            if (!context()->isValid()) {
+                int_fallBack();
+
+                return;
+            }
+
+            QPainter painter(this);
+            painter.setRenderHint(QPainter::Antialiasing);
+
+            /* Background, scale and area fills. */
+            painter.beginNativePainting();
+            {
+                QColor const &bg = m_data->m_bgndColor;
+                glClearColor(bg.redF(), bg.greenF(), bg.blueF(), 1.f);
+                glClear(GL_COLOR_BUFFER_BIT);
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+                QOpenGLVertexArrayObject::Binder vao{ &m_vao };
+                {
+                    TFD_PROFILE_STAGE(*m_data, Layers);
+                    int_drawLayer(m_scale, m_data->m_c_radarScale, static_cast<GLfloat>(m_data->m_c_zoomScale));
+                }
+                TFD_PROFILE_STAGE(*m_data, Shapes);
+                int_drawAreas();
+            }
+            painter.endNativePainting();
+
+            /* Wide and dashed lines are not supported by core profiles; leave outlines to the painter. */
+            {
+                TFD_PROFILE_STAGE(*m_data, Shapes);
+                m_data->int_drawShapes(painter, rect(), false);
+            }
+
+            /* Markers and compass. */
+            painter.beginNativePainting();
+            {
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+                QOpenGLVertexArrayObject::Binder vao{ &m_vao };
+                {
+                    TFD_PROFILE_STAGE(*m_data, Markers);
+                    int_drawMarkers();
+                }
+                TFD_PROFILE_STAGE(*m_data, Layers);
+                int_drawLayer(m_compass, m_data->m_c_radarCompass);
+            }
+            painter.endNativePainting();
+
+            /* Badges and labels are few and text-heavy; leave them to the painter. */
+            try {
+                {
+                    TFD_PROFILE_STAGE(*m_data, Markers);
+                    m_data->int_drawClusters(painter, rect());
+                }
+                m_data->int_drawLabels(painter, rect());
+            } catch (...) { }
+            m_data->int_drawStatistics(painter, rect());
+            painter.end();
+
+            /* Textures or buffers that could not be allocated leave holes; redraw via the raster backend. */
+            if (!m_isReady || glGetError() == GL_OUT_OF_MEMORY)
+                int_fallBack();
+        }
+
+        bool GLSurface::int_uploadLayer(Layer &layer, QPixmap const &pixmap, qint64 key) {
+            if (pixmap.isNull())
+                return false;
+
+            /* Re-upload only if the pixmap changed since the last upload. */
+            if (layer.m_texture == nullptr || layer.m_cacheKey != key) {
+                layer.m_texture = std::make_unique<QOpenGLTexture>(QOpenGLTexture::Target2D);
+                layer.m_texture->setData(pixmap.toImage(), QOpenGLTexture::DontGenerateMipMaps);
+                if (!layer.m_texture->isCreated()) {
+                    layer.m_texture.reset();
+                    m_isReady = false;
+
+                    return false;
+                }
+                layer.m_texture->setMinMagFilters(QOpenGLTexture::Linear, QOpenGLTexture::Linear);
+                layer.m_texture->setWrapMode(QOpenGLTexture::ClampToEdge);
+                layer.m_cacheKey = key;
+            }
+            return true;
+        }
+
+        void GLSurface::int_drawLayer(Layer &layer, QPixmap const &pixmap, GLfloat scale) {
+            if (!int_uploadLayer(layer, pixmap, pixmap.cacheKey()))
+                return;
+
+            m_layerProgram.bind();
+            m_layerProgram.setUniformValue("u_texture", 0);
+            m_layerProgram.setUniformValue("u_scale", scale);
+            layer.m_texture->bind(0);
+
+            m_quadBuffer.bind();
+            m_layerProgram.enableAttributeArray(0);
+            m_layerProgram.setAttributeBuffer(0, GL_FLOAT, 0, 2);
+            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+            layer.m_texture->release();
+            m_layerProgram.release();
+        }
+
+        void GLSurface::int_drawMarkers() {
+            priv::SpriteAtlas &atlas = *m_data->m_c_sprites;
+
+            /* Gather per-instance attributes from the projection pass. */
+            atlas.trim();
+            m_data->int_updateProjection();
+            m_markers.clear();
+            for (size_t j = 0; j < m_data->m_c_inRange.size(); j++) {
+                size_t const i = m_data->m_c_inRange[j];
+                if (!m_data->int_hasMarker(i) || m_data->int_clusterOf(i).has_value())
+                    continue;
+
+                auto const src = m_data->int_spriteOf(i);
+                if (!src.has_value())
+                    continue;
+                QPointF const pos = m_data->m_c_screenPositions[j];
+                m_markers.push_back(Marker{
+                    static_cast<GLfloat>(pos.x()), static_cast<GLfloat>(pos.y()),
+                    static_cast<GLfloat>(src->left()), static_cast<GLfloat>(src->top()),
+                    static_cast<GLfloat>(src->right()), static_cast<GLfloat>(src->bottom())
+                });
+            }
+            /* Upload the atlas after gathering since that may have added sprites. */
+            if (m_markers.empty() || !int_uploadLayer(m_sprites, atlas.pixmap(), static_cast<qint64>(atlas.revision())))
+                return;
+
+            /* Normalize source rectangles. */
+            GLfloat const sx = 1.f / atlas.pixmap().width();
+            GLfloat const sy = 1.f / atlas.pixmap().height();
+            for (Marker &m : m_markers) {
+                m.m_u0 *= sx; m.m_u1 *= sx;
+                m.m_v0 *= sy; m.m_v1 *= sy;
+            }
+
+            m_markerBuffer.bind();
+            m_markerBuffer.allocate(m_markers.data(), static_cast<int>(m_markers.size() * sizeof(Marker)));
+
+            m_markerProgram.bind();
+            m_markerProgram.setUniformValue("u_viewport", static_cast<GLfloat>(width()), static_cast<GLfloat>(height()));
+            m_markerProgram.setUniformValue("u_extent", static_cast<GLfloat>(gl_SpriteSize / 2.));
+            m_markerProgram.setUniformValue("u_texture", 0);
+            m_sprites.m_texture->bind(0);
+
+            /* Per-vertex corners ... */
+            m_quadBuffer.bind();
+            m_markerProgram.enableAttributeArray(0);
+            m_markerProgram.setAttributeBuffer(0, GL_FLOAT, 0, 2);
+            glVertexAttribDivisor(0, 0);
+            /* ... and per-instance position and color. */
+            m_markerBuffer.bind();
+            m_markerProgram.enableAttributeArray(1);
+            m_markerProgram.enableAttributeArray(2);
+            m_markerProgram.setAttributeBuffer(1, GL_FLOAT, offsetof(Marker, m_x), 2, sizeof(Marker));
+            m_markerProgram.setAttributeBuffer(2, GL_FLOAT, offsetof(Marker, m_u0), 4, sizeof(Marker));
+            glVertexAttribDivisor(1, 1);
+            glVertexAttribDivisor(2, 1);
+
+            glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(m_markers.size()));
+
+            glVertexAttribDivisor(1, 0);
+            glVertexAttribDivisor(2, 0);
+            m_markerProgram.disableAttributeArray(1);
+            m_markerProgram.disableAttributeArray(2);
+            m_sprites.m_texture->release();
+            m_markerProgram.release();
+        }
+
+        void GLSurface::int_drawAreas() {
+            ObjectRadarPrivate &data = *m_data;
+
+            /* Gather the cached triangulations of all visible areas into one mesh. */
+            m_mesh.clear();
+            try {
+                QRect const all = rect();
+                for (size_t i = 0; i < data.m_objManager.size(); i++) {
+                    if (data.m_objManager.types()[i] != ObjectRadar::ObjectType::Area || !data.int_hasShape(i))
+                        continue;
+                    if (!all.intersects(data.int_objectBounds(i, QPointF{})))
+                        continue;
+
+                    QColor const c = data.int_colorOf(i);
+                    GLfloat const a = static_cast<GLfloat>(c.alphaF() * data.m_areaOpacity / 255.);
+                    for (QPointF const &tri : data.int_trianglesOf(i)) {
+                        QPointF const pt = data.int_zoomed(tri);
+                        m_mesh.push_back(MeshVertex{
+                            static_cast<GLfloat>(pt.x()), static_cast<GLfloat>(pt.y()),
+                            static_cast<GLfloat>(c.redF()), static_cast<GLfloat>(c.greenF()), static_cast<GLfloat>(c.blueF()), a
+                        });
+                    }
+                }
+            } catch (...) { /* Draw what was gathered. */ }
+            if (m_mesh.empty())
+                return;
+
+            m_meshBuffer.bind();
+            m_meshBuffer.allocate(m_mesh.data(), static_cast<int>(m_mesh.size() * sizeof(MeshVertex)));
+
+            m_meshProgram.bind();
+            m_meshProgram.setUniformValue("u_viewport", static_cast<GLfloat>(width()), static_cast<GLfloat>(height()));
+            m_meshProgram.enableAttributeArray(0);
+            m_meshProgram.enableAttributeArray(1);
+            m_meshProgram.setAttributeBuffer(0, GL_FLOAT, offsetof(MeshVertex, m_x), 2, sizeof(MeshVertex));
+            m_meshProgram.setAttributeBuffer(1, GL_FLOAT, offsetof(MeshVertex, m_r), 4, sizeof(MeshVertex));
+
+            glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_mesh.size()));
+
+            m_meshProgram.disableAttributeArray(1);
+            m_meshProgram.release();
+        }
+    }
+
+
+    ObjectRadar::ObjectRadar(QSize const &dim, QWidget *parent, ObjectRadar::Backend backend)
+        : ObjectRadar(nullptr, dim, parent, backend)
+    { }
+
+    ObjectRadar::ObjectRadar(std::shared_ptr<RadarScene> scene, QSize const &dim, QWidget *parent, ObjectRadar::Backend backend)
+        : QWidget(parent), m_data(std::make_unique<ObjectRadarPrivate>(scene != nullptr ? std::move(scene) : std::make_shared<RadarScene>()))
+    {
+        /* Setup widget. */
+        setFixedSize(dim);
+        setCursor(Qt::CursorShape::BlankCursor);
+
+        /* Setup repaint timer. */
+        connect(&m_data->m_redrawTimer, &QTimer::timeout, this, [&]() {
+            m_data->m_frameClock.restart();
+#if (defined TFD_INSTRUMENTATION)
+            /* The last frame is complete, including the paint events it caused. */
+            if (m_data->int_completeFrameStatistics()) {
+                if (m_data->m_statisticsRate > 0.f)
+                    emit frameStatisticsUpdated(m_data->m_profiler.m_last);
+
+                QRect const overlay = m_data->int_overlayRect();
+                if (!overlay.isNull() && m_data->m_glSurface != nullptr)
+                    m_data->m_glSurface->update();
+                else if (!overlay.isNull())
+                    update(overlay);
+            }
+#endif
+
+            /* Apply everything the producer threads queued since the last frame. */
+            {
+                TFD_PROFILE_STAGE(*m_data, Ingest);
+                if (!m_data->m_channels.empty()) {
+                    auto const &upd = m_data->int_drainChannels();
+                    if (!upd.empty())
+                        updateObjects(upd);
+                }
+                m_data->int_beginFrame();
+            }
+
+            /* Off-thread composition: submit a snapshot; the composer repaints once it's done. */
+            if (m_data->m_composer != nullptr) {
+                TFD_PROFILE_STAGE(*m_data, Layout);
+                if (!m_data->int_takeChanges())
+                    return;
+
+                auto scene = m_data->int_makeScene();
+                if (scene != nullptr)
+                    m_data->m_composer->submit(std::move(scene));
+                else
+                    m_data->m_isViewDirty = true;
+                return;
+            }
+
+            /* Only repaint what changed since the last frame; skip the frame if nothing did. */
+            QRegion dirty;
+            {
+                TFD_PROFILE_STAGE(*m_data, Layout);
+                dirty = m_data->int_takeDirtyRegion();
+            }
+            if (dirty.isEmpty())
+                return;
+
+            /*
+             * In fixed-rate mode, issue repaint immediately. In this situation, we do not want to
+             * queue a repaint via *QWidget::update()* even though it would probably not make a big
+             * difference in practice since repaint messages are high-priority. In on-demand mode,
+             * queue the repaint so that it's coalesced with the next display refresh.
+             */
+            if (m_data->m_glSurface != nullptr)
+                m_data->m_glSurface->update(); /* GPU surface always redraws entirely. */
+            else if (m_data->m_redrawMode == ObjectRadar::RedrawMode::FixedRate)
+                repaint(dirty);
+            else
+                update(dirty);
+        });
+        m_data->m_redrawTimer.setTimerType(Qt::TimerType::PreciseTimer);
+
+        /* Initialize cached resources; this also starts the repaint timer. */
+        m_data->m_viewSize         = dim;
+        m_data->m_devicePixelRatio = devicePixelRatioF();
+        m_data->updateCache(static_cast<ObjectRadar::Property>(INT_MAX), {});
+        connect(this, &ObjectRadar::propertyValueChanged, m_data.get(), &ObjectRadarPrivate::updateCache);
+        connect(&m_data->m_objManager, &priv::ROM::objectAdded, m_data.get(), &ObjectRadarPrivate::updateTrackedObject);
+        connect(&m_data->m_objManager, &priv::ROM::objectRemoved, m_data.get(), &ObjectRadarPrivate::updateTrackedObject);
+        connect(&m_data->m_objManager, &priv::ROM::changesPending, m_data.get(), &ObjectRadarPrivate::requestFrame);
+        connect(&m_data->m_objManager, &priv::ROM::transactionCommitted, m_data.get(), [this]() {
+            m_data->updateTrackedObject(std::optional<QString>{});
+        });
+
+        /* Setup GPU surface, if requested. It falls back to raster drawing if it's unusable. */
+        if (backend == ObjectRadar::Backend::OpenGL) {
+            m_data->m_glSurface = new priv::GLSurface(m_data.get(), this);
+
+            m_data->m_glSurface->setGeometry(QRect{ QPoint{ 0, 0 }, dim });
+        }
+        /* Setup frame composer, if requested. */
+        if (backend == ObjectRadar::Backend::Threaded) {
+            try {
+                m_data->m_composer = std::make_unique<priv::FrameComposer>(this);
+            } catch (...) { /* Draw on the GUI thread instead. */ }
+        }
+    }
+
+    ObjectRadar::~ObjectRadar() {
+        m_data->m_redrawTimer.stop();
+
+        /* Wait for the frame that is being composed, if any. */
+        m_data->m_composer.reset();
+
+        /* Producers may outlive the object radar; detach their channels. */
+        for (auto const &ch : m_data->m_channels)
+            ch->m_data->close();
+
+        /* The surface refers to the internal state; destroy it first. */
+        delete m_data->m_glSurface;
+    }
+
+    std::shared_ptr<RadarScene> ObjectRadar::getScene() const noexcept {
+        return m_data->m_scene;
+    }
+
+    ObjectRadar::Backend ObjectRadar::getBackend() const noexcept {
+        if (m_data->m_composer != nullptr)
+            return ObjectRadar::Backend::Threaded;
+
+        return m_data->m_glSurface != nullptr ? ObjectRadar::Backend::OpenGL : ObjectRadar::Backend::Raster;
+    }
+
+    std::optional<ObjectRadar::FrameStatistics> ObjectRadar::getFrameStatistics() const noexcept {
+#if (defined TFD_INSTRUMENTATION)
+        return std::optional<FrameStatistics>(m_data->m_profiler.m_last);
+#else
+        return std::optional<FrameStatistics>{};
+#endif
+    }
+
+    ObjectHandle ObjectRadar::addObject(QString const &ident, ObjectRadar::ObjectType type, QPointF const &pos, float alt) {
+        if (type < static_cast<ObjectRadar::ObjectType>(0) || type >= ObjectRadar::ObjectType::__N__)
+            return ObjectHandle{};
+
+        ObjectHandle const handle = m_data->m_objManager.addObject(
+            ident,
+            priv::RadarObject{ type, pos, alt }
+        );
+        if (handle.isValid())
+            m_data->m_sceneData.record([&](priv::UpdateLogWriter &log) { log.add(handle.index(), ident, type, pos, alt); });
+        return handle;
+    }
+
+    bool ObjectRadar::removeObject(QString const &ident) {
+        return removeObject(m_data->m_objManager.findObject(ident));
+    }
+
+    bool ObjectRadar::removeObject(ObjectHandle handle) {
+        if (!m_data->m_objManager.removeObject(handle))
+            return false;
+
+        m_data->m_sceneData.record([&](priv::UpdateLogWriter &log) { log.remove(handle.index()); });
+        return true;
+    }
+
+    void ObjectRadar::removeAllObjects() {
+        m_data->m_objManager.clearObjects();
+
+        m_data->m_sceneData.record([](priv::UpdateLogWriter &log) { log.clear(); });
+    }
+
+    bool ObjectRadar::setObjectCapacity(size_t n) noexcept {
+        if (!m_data->m_objManager.setCapacity(n))
+            return false;
+
+        /* Draw lists never hold more than one entry per object. */
+        try {
+            m_data->m_c_inRange.reserve(n);
+            m_data->m_c_screenPositions.reserve(n);
+            m_data->m_c_dirtySlots.reserve(n);
+            m_data->m_c_drawnRects.reserve(n);
+            m_data->m_c_shapes.reserve(n);
+            m_data->m_c_labels.reserve(n);
+            m_data->m_c_placements.reserve(n);
+        } catch (...) { return false; }
+        /* Gathered positions, cluster cells and sprite blits live in the frame arena (which keeps its buffer if it cannot grow). */
+        m_data->m_frameArena.reserve(n * (sizeof(QPointF) * 2 + sizeof(double) + sizeof(quint32) + sizeof(QPainter::PixmapFragment)));
+
+        return true;
+    }
+
+    size_t ObjectRadar::getObjectCapacity() const noexcept {
+        return m_data->m_objManager.capacity();
+    }
+
+    bool ObjectRadar::saveSnapshot(QString const &path) const noexcept {
+        try {
+            std::vector<quint64> const buf  = m_data->int_encodeSnapshot();
+            qint64 const               size = static_cast<qint64>(reinterpret_cast<priv::SnapshotHeader const *>(buf.data())->m_size);
+
+            /* Unless committed, the save file discards what was written. */
+            QSaveFile file{ path };
+            if (!file.open(QIODevice::WriteOnly))
+                return false;
+            if (file.write(reinterpret_cast<char const *>(buf.data()), size) != size)
+                return false;
+
+            return file.commit();
+        } catch (...) { }
+
+        return false;
+    }
+
+    bool ObjectRadar::loadSnapshot(QString const &path) noexcept {
+        try {
+            QFile file{ path };
+            if (!file.open(QIODevice::ReadOnly))
+                return false;
+
+            /* Mapped memory is page-aligned, so the snapshot is decoded in-place. */
+            qint64 const size = file.size();
+            uchar *const data = size > 0 ? file.map(0, size) : nullptr;
+            if (data == nullptr) {
+                /* Not mappable (e.g., on some network file systems); read it instead. */
+                QByteArray const bytes = file.readAll();
+
+                return loadSnapshot(bytes.constData(), static_cast<size_t>(bytes.size()));
+            }
+
+            bool const isok = loadSnapshot(data, static_cast<size_t>(size));
+            file.unmap(data);
+            return isok;
+        } catch (...) { }
+
+        return false;
+    }
+
+    bool ObjectRadar::loadSnapshot(void const *data, size_t size) noexcept {
+        try {
+            /* Records are read in-place, which requires them to be aligned. */
+            std::vector<quint64> copy;
+            uchar const         *bytes = static_cast<uchar const *>(data);
+            if (reinterpret_cast<quintptr>(data) % alignof(priv::SnapshotHeader) != 0) {
+                copy.resize((size + sizeof(quint64) - 1) / sizeof(quint64));
+                std::memcpy(copy.data(), data, size);
+
+                bytes = reinterpret_cast<uchar const *>(copy.data());
+            }
+
+            priv::SnapshotHeader const *hdr = priv::int_checkSnapshot(bytes, size);
+            if (hdr == nullptr)
+                return false;
+            /* Validate the view properties before anything is replaced. */
+            auto const view = ObjectRadarPrivate::int_decodeView(*hdr);
+            for (auto const &[prop, val] : view)
+                if (!priv::int_isValidPropertyValue(prop, val))
+                    return false;
+
+            /* Rebuild the caches once for all view properties. */
+            ObjectRadar::Transaction tx{ *this };
+            priv::ROM               &objs = m_data->m_objManager;
+            if (!objs.loadSnapshot(*hdr))
+                return false;
+            m_data->m_sceneData.record([&](priv::UpdateLogWriter &log) { m_data->int_recordObjects(log); });
+            if (m_data->m_recorder != nullptr && objs.getIndex(m_data->m_trackedObject).has_value())
+                m_data->m_recorder->track(m_data->m_trackedObject.index());
+            for (auto const &[prop, val] : view)
+                setProperty(prop, val);
+            if (hdr->m_view.m_trackedObject != priv::gl_SnapshotNoObject)
+                setTrackedObject(objs.getHandle(hdr->m_view.m_trackedObject));
+
+            return true;
+        } catch (...) { }
+
+        return false;
+    }
+
+    bool ObjectRadar::hasObject(QString const &ident) const noexcept {
+        return m_data->m_objManager.findObject(ident).isValid();
+    }
+
+    bool ObjectRadar::hasObject(ObjectHandle handle) const noexcept {
+        return m_data->m_objManager.getIndex(handle).has_value();
+    }
+
+    ObjectHandle ObjectRadar::getHandle(QString const &ident) const noexcept {
+        return m_data->m_objManager.findObject(ident);
+    }
+
+    QVariant ObjectRadar::getProperty(ObjectRadar::Property prop) const noexcept {
+        /* Check if property index exists. */
+        if (!priv::int_isValidPropertyIndex(prop))
+            return priv::gl_InvVariant;
+
+        /* Select the desired property. */
+        switch (prop) {
+            case ObjectRadar::Property::UpdateRate:      return m_data->m_updateRate;
+            case ObjectRadar::Property::StaticTextFont:  return QVariant::fromValue(m_data->m_staticTextFont);
+            case ObjectRadar::Property::LabelFont:       return QVariant::fromValue(m_data->m_labelFont);
+            case ObjectRadar::Property::ObjectLabelFont: return QVariant::fromValue(m_data->m_objLabelFont);
             case ObjectRadar::Property::ForegroundColor: return m_data->m_fgndColor;
             case ObjectRadar::Property::BackgroundColor: return m_data->m_bgndColor;
             case ObjectRadar::Property::RadarCenter:     return m_data->m_radarCenter;
             case ObjectRadar::Property::RadarAltitude:   return m_data->m_radarAlt;
             case ObjectRadar::Property::RadarRange:      return m_data->m_radarRange;
+            case ObjectRadar::Property::AreaOpacity:     return m_data->m_areaOpacity;
+            case ObjectRadar::Property::OutlineStrength: return m_data->m_outlineStrength;
+            case ObjectRadar::Property::OutlineStyle:    return m_data->m_outlineStyle;
+            case ObjectRadar::Property::RedrawMode:      return static_cast<int>(m_data->m_redrawMode);
+            case ObjectRadar::Property::PredictionHorizon: return m_data->m_predictionHorizon;
+            case ObjectRadar::Property::ClusterCellSize:   return m_data->m_clusterCellSize;
+            case ObjectRadar::Property::StatisticsRate:  return m_data->m_statisticsRate;
+            case ObjectRadar::Property::StatisticsOverlay: return m_data->m_isStatsOverlay;
+            case ObjectRadar::Property::LabelVisibility: return m_data->m_isLabelVisible;
+        }
+
+        /* If the property could not be retrieved, return an invalid variant. */
+        return priv::gl_InvVariant;
+    }
+
+    QVariant ObjectRadar::getProperty(QString const &ident, ObjectRadar::Property prop) const noexcept {
+        return getProperty(m_data->m_objManager.findObject(ident), prop);
+    }
+
+    QVariant ObjectRadar::getProperty(ObjectHandle handle, ObjectRadar::Property prop) const noexcept {
+        /* Get object. */
+        priv::ROM const &objs = m_data->m_objManager;
+        auto const i = objs.getIndex(handle);
+        if (!i.has_value())
+            return priv::gl_InvVariant;
+
+        /* Select property. */
+        switch (prop) {
+            case ObjectRadar::Property::Identifier: return objs.identifiers()[*i];
+            case ObjectRadar::Property::Type:       return static_cast<size_t>(objs.types()[*i]);
+            case ObjectRadar::Property::Position:   return objs.positions()[*i];
+            case ObjectRadar::Property::Color:      return objs.colors()[*i];
+            case ObjectRadar::Property::Area:
+            case ObjectRadar::Property::Path:
+                try {
+                    priv::Shape const &shape = objs.shapes()[*i];
+                    if (prop == ObjectRadar::Property::Path) {
+                        RadarPath path;
+                        path.m_vertices = shape.m_vertices;
+                        path.m_isSmooth = shape.m_isSmooth;
+                        return QVariant::fromValue(path);
+                    }
+
+                    RadarArea area;
+                    area.m_vertices = shape.m_vertices;
+                    area.m_isSmooth = shape.m_isSmooth;
+                    return QVariant::fromValue(area);
+                } catch (...) { }
+
+                break;
+            case ObjectRadar::Property::Altitude:   return objs.altitudes()[*i];
+            case ObjectRadar::Property::Visibility: return static_cast<bool>(objs.visibility()[*i]);
+            case ObjectRadar::Property::GroundSpeed: return objs.groundSpeeds()[*i];
+            case ObjectRadar::Property::Heading:    return objs.headings()[*i];
+        }
+
+        /* If the property could not be retrieved, return an invalid variant. */
+        return priv::gl_InvVariant;
+    }
+
+    bool ObjectRadar::setProperty(ObjectRadar::Property prop, QVariant const &val) {
+        /* Check if property type exists and the type is correct. */
+        if (!priv::int_isValidPropertyValue(prop, val))
+            return false;
+
+        /* Update selected view property. */
+        switch (prop) {
+            case ObjectRadar::Property::UpdateRate:        return set<ObjectRadar::Property::UpdateRate>(val.toFloat());
+            case ObjectRadar::Property::StaticTextFont:    return set<ObjectRadar::Property::StaticTextFont>(val.value<FontProperties>());
+            case ObjectRadar::Property::LabelFont:         return set<ObjectRadar::Property::LabelFont>(val.value<FontProperties>());
+            case ObjectRadar::Property::ObjectLabelFont:   return set<ObjectRadar::Property::ObjectLabelFont>(val.value<FontProperties>());
+            case ObjectRadar::Property::ForegroundColor:   return set<ObjectRadar::Property::ForegroundColor>(val.value<QColor>());
+            case ObjectRadar::Property::BackgroundColor:   return set<ObjectRadar::Property::BackgroundColor>(val.value<QColor>());
+            case ObjectRadar::Property::RadarCenter:       return set<ObjectRadar::Property::RadarCenter>(val.toPointF());
+            case ObjectRadar::Property::RadarAltitude:     return set<ObjectRadar::Property::RadarAltitude>(val.toFloat());
+            case ObjectRadar::Property::RadarRange:        return set<ObjectRadar::Property::RadarRange>(val.toSizeF());
+            case ObjectRadar::Property::AreaOpacity:       return set<ObjectRadar::Property::AreaOpacity>(val.toInt());
+            case ObjectRadar::Property::OutlineStrength:   return set<ObjectRadar::Property::OutlineStrength>(val.toInt());
+            case ObjectRadar::Property::OutlineStyle:      return set<ObjectRadar::Property::OutlineStyle>(static_cast<Qt::PenStyle>(val.toInt()));
+            case ObjectRadar::Property::RedrawMode:        return set<ObjectRadar::Property::RedrawMode>(static_cast<ObjectRadar::RedrawMode>(val.toInt()));
+            case ObjectRadar::Property::PredictionHorizon: return set<ObjectRadar::Property::PredictionHorizon>(val.toFloat());
+            case ObjectRadar::Property::ClusterCellSize:     return set<ObjectRadar::Property::ClusterCellSize>(val.toInt());
+            case ObjectRadar::Property::StatisticsRate:    return set<ObjectRadar::Property::StatisticsRate>(val.toFloat());
+            case ObjectRadar::Property::StatisticsOverlay: return set<ObjectRadar::Property::StatisticsOverlay>(val.toBool());
+            case ObjectRadar::Property::LabelVisibility:   return set<ObjectRadar::Property::LabelVisibility>(val.toBool());
         }
 
-        /* If the property could not be retrieved, return an invalid variant. */
-        return priv::gl_InvVariant;
+        /* Provided invalid property index. */
+        return false;
+    }
+
+    bool ObjectRadar::setProperty(QString const &ident, ObjectRadar::Property prop, QVariant const &val) {
+        return setProperty(m_data->m_objManager.findObject(ident), prop, val);
+    }
+
+    bool ObjectRadar::setProperty(QString const &ident, ObjectRadar::Property prop, QVariant &&val) {
+        return setProperty(m_data->m_objManager.findObject(ident), prop, std::move(val));
     }
 
-    QVariant ObjectRadar::getProperty(QString const &ident, ObjectRadar::Property prop) const noexcept {
-        /* Get object. */
-        priv::RadarObject const *robj = m_data->m_objManager.getObject(ident).value_or(nullptr);
-        if (robj == nullptr)
-            return priv::gl_InvVariant;
+    bool ObjectRadar::setProperty(ObjectHandle handle, ObjectRadar::Property prop, QVariant &&val) {
+        bool const isshape = prop == ObjectRadar::Property::Area || prop == ObjectRadar::Property::Path;
+        if (!isshape || !priv::int_isValidPropertyValue(prop, val))
+            return setProperty(handle, prop, static_cast<QVariant const &>(val));
 
-        /* Select property. */
+        /* The type was checked; unless the value is shared, *data()* does not detach and the vertices are taken over. */
+        if (prop == ObjectRadar::Property::Area)
+            return setArea(handle, std::move(*static_cast<RadarArea *>(val.data())));
+        return setPath(handle, std::move(*static_cast<RadarPath *>(val.data())));
+    }
+
+    bool ObjectRadar::setProperty(ObjectHandle handle, ObjectRadar::Property prop, QVariant const &val) {
+        /* Check if property type exists and the type is correct. */
+        if (!priv::int_isValidPropertyValue(prop, val))
+            return false;
+
+        /* Update property. */
         switch (prop) {
-            case ObjectRadar::Property::Identifier: return ident;
-            case ObjectRadar::Property::Type:       return static_cast<size_t>(robj->m_type);
-            case ObjectRadar::Property::Position:   return robj->m_position;
-            case ObjectRadar::Property::Color:      return robj->m_color;
-            case ObjectRadar::Property::Area:       return robj->m_area;
-            case ObjectRadar::Property::Altitude:   return robj->m_altitude;
-            case ObjectRadar::Property::Visibility: return robj->m_isVisible;
+            case ObjectRadar::Property::Identifier: return set<ObjectRadar::Property::Identifier>(handle, val.toString());
+            case ObjectRadar::Property::Type:
+                return set<ObjectRadar::Property::Type>(handle, static_cast<ObjectRadar::ObjectType>(val.toInt()));
+            case ObjectRadar::Property::Position:   return set<ObjectRadar::Property::Position>(handle, val.toPointF());
+            case ObjectRadar::Property::Color:      return set<ObjectRadar::Property::Color>(handle, val.value<QColor>());
+            /* The type was checked; read the vertices in-place instead of copying the shape out first. */
+            case ObjectRadar::Property::Area:       return set<ObjectRadar::Property::Area>(handle, *static_cast<RadarArea const *>(val.constData()));
+            case ObjectRadar::Property::Path:       return set<ObjectRadar::Property::Path>(handle, *static_cast<RadarPath const *>(val.constData()));
+            case ObjectRadar::Property::Altitude:   return set<ObjectRadar::Property::Altitude>(handle, val.toFloat());
+            case ObjectRadar::Property::Visibility: return set<ObjectRadar::Property::Visibility>(handle, val.toBool());
+            case ObjectRadar::Property::GroundSpeed: return set<ObjectRadar::Property::GroundSpeed>(handle, val.toFloat());
+            case ObjectRadar::Property::Heading:    return set<ObjectRadar::Property::Heading>(handle, val.toFloat());
         }
 
-        /* If the property could not be retrieved, return an invalid variant. */
-        return priv::gl_InvVariant;
+        return false;
     }
 
-    bool ObjectRadar::setProperty(ObjectRadar::Property prop, QVariant const &val) {
-        /* Check if property type exists and the type is correct. */
-        if (!priv::int_isValidPropertyValue(prop, val))
+    template<ObjectRadar::Property P, ObjectRadar::ViewProperty<P>>
+    ObjectRadar::PropertyType<P> ObjectRadar::get() const noexcept {
+        if constexpr (P == ObjectRadar::Property::UpdateRate)             return m_data->m_updateRate;
+        else if constexpr (P == ObjectRadar::Property::StaticTextFont)    return m_data->m_staticTextFont;
+        else if constexpr (P == ObjectRadar::Property::LabelFont)         return m_data->m_labelFont;
+        else if constexpr (P == ObjectRadar::Property::ObjectLabelFont)   return m_data->m_objLabelFont;
+        else if constexpr (P == ObjectRadar::Property::ForegroundColor)   return m_data->m_fgndColor;
+        else if constexpr (P == ObjectRadar::Property::BackgroundColor)   return m_data->m_bgndColor;
+        else if constexpr (P == ObjectRadar::Property::RadarCenter)       return m_data->m_radarCenter;
+        else if constexpr (P == ObjectRadar::Property::RadarAltitude)     return m_data->m_radarAlt;
+        else if constexpr (P == ObjectRadar::Property::RadarRange)        return m_data->m_radarRange;
+        else if constexpr (P == ObjectRadar::Property::AreaOpacity)       return m_data->m_areaOpacity;
+        else if constexpr (P == ObjectRadar::Property::OutlineStrength)   return m_data->m_outlineStrength;
+        else if constexpr (P == ObjectRadar::Property::OutlineStyle)      return static_cast<Qt::PenStyle>(m_data->m_outlineStyle);
+        else if constexpr (P == ObjectRadar::Property::RedrawMode)        return m_data->m_redrawMode;
+        else if constexpr (P == ObjectRadar::Property::PredictionHorizon) return m_data->m_predictionHorizon;
+        else if constexpr (P == ObjectRadar::Property::ClusterCellSize)   return m_data->m_clusterCellSize;
+        else if constexpr (P == ObjectRadar::Property::StatisticsRate)    return m_data->m_statisticsRate;
+        else if constexpr (P == ObjectRadar::Property::StatisticsOverlay) return m_data->m_isStatsOverlay;
+        else if constexpr (P == ObjectRadar::Property::LabelVisibility)   return m_data->m_isLabelVisible;
+    }
+
+    template<ObjectRadar::Property P, ObjectRadar::ObjectProperty<P>>
+    std::optional<ObjectRadar::PropertyType<P>> ObjectRadar::get(ObjectHandle handle) const noexcept {
+        using T = ObjectRadar::PropertyType<P>;
+
+        /* Get object. */
+        priv::ROM const &objs = m_data->m_objManager;
+        auto const i = objs.getIndex(handle);
+        if (!i.has_value())
+            return std::optional<T>{};
+
+        if constexpr (P == ObjectRadar::Property::Identifier)       return std::optional<T>(objs.identifiers()[*i]);
+        else if constexpr (P == ObjectRadar::Property::Type)        return std::optional<T>(objs.types()[*i]);
+        else if constexpr (P == ObjectRadar::Property::Position)    return std::optional<T>(objs.positions()[*i]);
+        else if constexpr (P == ObjectRadar::Property::Color)       return std::optional<T>(objs.colors()[*i]);
+        else if constexpr (P == ObjectRadar::Property::Altitude)    return std::optional<T>(objs.altitudes()[*i]);
+        else if constexpr (P == ObjectRadar::Property::Visibility)  return std::optional<T>(static_cast<bool>(objs.visibility()[*i]));
+        else if constexpr (P == ObjectRadar::Property::GroundSpeed) return std::optional<T>(objs.groundSpeeds()[*i]);
+        else if constexpr (P == ObjectRadar::Property::Heading)     return std::optional<T>(objs.headings()[*i]);
+        else {
+            /* Areas and paths hand out a copy of their vertices. */
+            try {
+                priv::Shape const &shape = objs.shapes()[*i];
+
+                T res;
+                res.m_vertices = shape.m_vertices;
+                res.m_isSmooth = shape.m_isSmooth;
+                return std::optional<T>(std::move(res));
+            } catch (...) { }
+
+            return std::optional<T>{};
+        }
+    }
+
+    template<ObjectRadar::Property P, ObjectRadar::ViewProperty<P>>
+    bool ObjectRadar::set(ObjectRadar::PropertyType<P> const &val) noexcept {
+        if (!priv::int_isInPropertyRange<P>(val))
             return false;
 
         /* Update selected view property. */
-        switch (prop) {
-            case ObjectRadar::Property::StaticTextFont:  m_data->m_staticTextFont  = val.value<FontProperties>(); break;
-            case ObjectRadar::Property::LabelFont:       m_data->m_labelFont       = val.value<FontProperties>(); break;
-            case ObjectRadar::Property::ObjectLabelFont: m_data->m_objLabelFont    = val.value<FontProperties>(); break;
-            case ObjectRadar::Property::ForegroundColor: m_data->m_fgndColor       = val.value<QColor>();         break;
-            case ObjectRadar::Property::BackgroundColor: m_data->m_bgndColor       = val.value<QColor>();         break;
-            case ObjectRadar::Property::RadarCenter:     m_data->m_radarCenter     = val.toPointF();              break;
-            case ObjectRadar::Property::RadarAltitude:   m_data->m_radarAlt        = val.toFloat();               break;
-            case ObjectRadar::Property::UpdateRate:      m_data->m_updateRate      = val.toFloat();               break;
-            case ObjectRadar::Property::RadarRange:      m_data->m_radarRange      = val.toSizeF();               break;
-            case ObjectRadar::Property::AreaOpacity:     m_data->m_areaOpacity     = val.toInt();                 break;
-            case ObjectRadar::Property::OutlineStrength: m_data->m_outlineStrength = val.toInt();                 break;
-            case ObjectRadar::Property::OutlineStyle:    m_data->m_outlineStyle    = val.toInt();                 break;
-            default:
-                /* Provided invalid property index. */
-                return false;
+        bool ischanged;
+        if constexpr (P == ObjectRadar::Property::UpdateRate)             ischanged = priv::int_assignIfChanged(m_data->m_updateRate,        val);
+        else if constexpr (P == ObjectRadar::Property::StaticTextFont)    ischanged = priv::int_assignIfChanged(m_data->m_staticTextFont,    val);
+        else if constexpr (P == ObjectRadar::Property::LabelFont)         ischanged = priv::int_assignIfChanged(m_data->m_labelFont,         val);
+        else if constexpr (P == ObjectRadar::Property::ObjectLabelFont)   ischanged = priv::int_assignIfChanged(m_data->m_objLabelFont,      val);
+        else if constexpr (P == ObjectRadar::Property::ForegroundColor)   ischanged = priv::int_assignIfChanged(m_data->m_fgndColor,         val);
+        else if constexpr (P == ObjectRadar::Property::BackgroundColor)   ischanged = priv::int_assignIfChanged(m_data->m_bgndColor,         val);
+        else if constexpr (P == ObjectRadar::Property::RadarCenter)       ischanged = priv::int_assignIfChanged(m_data->m_radarCenter,       val);
+        else if constexpr (P == ObjectRadar::Property::RadarAltitude)     ischanged = priv::int_assignIfChanged(m_data->m_radarAlt,          val);
+        else if constexpr (P == ObjectRadar::Property::RadarRange)        ischanged = priv::int_assignIfChanged(m_data->m_radarRange,        val);
+        else if constexpr (P == ObjectRadar::Property::AreaOpacity)       ischanged = priv::int_assignIfChanged(m_data->m_areaOpacity,       val);
+        else if constexpr (P == ObjectRadar::Property::OutlineStrength)   ischanged = priv::int_assignIfChanged(m_data->m_outlineStrength,   val);
+        else if constexpr (P == ObjectRadar::Property::OutlineStyle)      ischanged = priv::int_assignIfChanged(m_data->m_outlineStyle,      static_cast<int>(val));
+        else if constexpr (P == ObjectRadar::Property::RedrawMode)        ischanged = priv::int_assignIfChanged(m_data->m_redrawMode,        val);
+        else if constexpr (P == ObjectRadar::Property::PredictionHorizon) ischanged = priv::int_assignIfChanged(m_data->m_predictionHorizon, val);
+        else if constexpr (P == ObjectRadar::Property::ClusterCellSize)   ischanged = priv::int_assignIfChanged(m_data->m_clusterCellSize,   val);
+        else if constexpr (P == ObjectRadar::Property::StatisticsRate)    ischanged = priv::int_assignIfChanged(m_data->m_statisticsRate,    val);
+        else if constexpr (P == ObjectRadar::Property::StatisticsOverlay) ischanged = priv::int_assignIfChanged(m_data->m_isStatsOverlay,    val);
+        else if constexpr (P == ObjectRadar::Property::LabelVisibility)   ischanged = priv::int_assignIfChanged(m_data->m_isLabelVisible,    val);
+
+        /* Only notify (and thus invalidate caches) if the value actually changed. */
+        if (!ischanged)
+            return true;
+
+        /* Inside of transactions, the caches are updated once on commit. */
+        bool const isdeferred = m_data->m_txDepth > 0;
+        if (isdeferred) {
+            m_data->m_txProperties |= priv::int_propertyBit(P);
+            if (m_data->m_recorder == nullptr)
+                return true;
         }
 
-        emit propertyValueChanged(prop, val);
+        try {
+            QVariant const boxed = priv::int_boxPropertyValue(val);
+            if (m_data->m_recorder != nullptr)
+                m_data->m_recorder->viewProperty(P, boxed);
+
+            if (!isdeferred)
+                emit propertyValueChanged(P, boxed);
+        } catch (...) { }
         return true;
     }
 
-    bool ObjectRadar::setProperty(QString const &ident, ObjectRadar::Property prop, QVariant const &val) {
-        /* Check if property type exists and the type is correct. */
-        if (!priv::int_isValidPropertyValue(prop, val))
+    template<ObjectRadar::Property P, ObjectRadar::ObjectProperty<P>>
+    bool ObjectRadar::set(ObjectHandle handle, ObjectRadar::PropertyType<P> const &val) noexcept {
+        if (!priv::int_isInPropertyRange<P>(val))
             return false;
         /* Get object. */
-        priv::RadarObject *obj = m_data->m_objManager.getObject(ident).value_or(nullptr);
-        if (obj == nullptr)
+        priv::ROM &objs = m_data->m_objManager;
+        auto const i = objs.getIndex(handle);
+        if (!i.has_value())
             return false;
 
         /* Update property. */
-        switch (prop) {
-            case ObjectRadar::Property::Identifier:
-                /* Add object with duplicate properties under new name. */
-                if (!m_data->m_objManager.addObject(val.toString(), *obj))
-                    return false;
+        if constexpr (P == ObjectRadar::Property::Identifier) {
+            /* Rename the object in-place; its handle stays valid. */
+            if (!objs.renameObject(handle, val))
+                return false;
+        }
+        else if constexpr (P == ObjectRadar::Property::Type)        objs.setType(*i, val);
+        else if constexpr (P == ObjectRadar::Property::Position)    objs.setPosition(*i, val);
+        else if constexpr (P == ObjectRadar::Property::Color)       objs.setColor(*i, val);
+        else if constexpr (P == ObjectRadar::Property::Altitude)    objs.setAltitude(*i, val);
+        else if constexpr (P == ObjectRadar::Property::Visibility)  objs.setVisibility(*i, val);
+        else if constexpr (P == ObjectRadar::Property::GroundSpeed) objs.setMotion(*i, val, objs.headings()[*i]);
+        else if constexpr (P == ObjectRadar::Property::Heading)     objs.setMotion(*i, objs.groundSpeeds()[*i], val);
+        else {
+            auto shape = priv::int_makeShape(val.m_vertices, val.m_isSmooth);
+            if (!shape.has_value())
+                return false;
 
-                /* Delete old property. */
-                return m_data->m_objManager.removeObject(ident);
-            case ObjectRadar::Property::Type:
-                obj->m_type = static_cast<ObjectRadar::ObjectType>(val.toInt());
-                
-                return true;
-            case ObjectRadar::Property::Position:   obj->m_position = val.toPointF();       return true;
-            case ObjectRadar::Property::Color:      obj->m_color     = val.value<QColor>(); return true;
-            case ObjectRadar::Property::Area:       obj->m_area      = val.toSizeF();       return true;
-            case ObjectRadar::Property::Altitude:   obj->m_altitude  = val.toFloat();       return true;
-            case ObjectRadar::Property::Visibility: obj->m_isVisible = val.toBool();        return true;
+            objs.setShape(*i, std::move(*shape));
+        }
+
+        m_data->m_sceneData.record([&](priv::UpdateLogWriter &log) {
+            if constexpr (P == ObjectRadar::Property::Area || P == ObjectRadar::Property::Path)
+                log.shape(handle.index(), P, objs.shapes()[*i]);
+            else {
+                try {
+                    log.objectProperty(handle.index(), P, priv::int_boxPropertyValue(val));
+                } catch (...) { }
+            }
+        });
+        return true;
+    }
+
+    /* The typed property accessors are defined here; instantiate them for every property. */
+    #define TFD_VIEW_PROPERTY(prop)                                                                                                      \
+        template ObjectRadar::PropertyType<ObjectRadar::Property::prop> ObjectRadar::get<ObjectRadar::Property::prop>() const noexcept; \
+        template bool ObjectRadar::set<ObjectRadar::Property::prop>(PropertyType<ObjectRadar::Property::prop> const &) noexcept
+    #define TFD_OBJECT_PROPERTY(prop)                                                                                                                   \
+        template std::optional<ObjectRadar::PropertyType<ObjectRadar::Property::prop>> ObjectRadar::get<ObjectRadar::Property::prop>(ObjectHandle) const noexcept; \
+        template bool ObjectRadar::set<ObjectRadar::Property::prop>(ObjectHandle, PropertyType<ObjectRadar::Property::prop> const &) noexcept
+    TFD_VIEW_PROPERTY(UpdateRate);
+    TFD_VIEW_PROPERTY(StaticTextFont);
+    TFD_VIEW_PROPERTY(LabelFont);
+    TFD_VIEW_PROPERTY(ObjectLabelFont);
+    TFD_VIEW_PROPERTY(ForegroundColor);
+    TFD_VIEW_PROPERTY(BackgroundColor);
+    TFD_VIEW_PROPERTY(RadarCenter);
+    TFD_VIEW_PROPERTY(RadarAltitude);
+    TFD_VIEW_PROPERTY(RadarRange);
+    TFD_VIEW_PROPERTY(AreaOpacity);
+    TFD_VIEW_PROPERTY(OutlineStrength);
+    TFD_VIEW_PROPERTY(OutlineStyle);
+    TFD_VIEW_PROPERTY(RedrawMode);
+    TFD_VIEW_PROPERTY(PredictionHorizon);
+    TFD_VIEW_PROPERTY(ClusterCellSize);
+    TFD_VIEW_PROPERTY(StatisticsRate);
+    TFD_VIEW_PROPERTY(StatisticsOverlay);
+    TFD_VIEW_PROPERTY(LabelVisibility);
+    TFD_OBJECT_PROPERTY(Identifier);
+    TFD_OBJECT_PROPERTY(Type);
+    TFD_OBJECT_PROPERTY(Position);
+    TFD_OBJECT_PROPERTY(Color);
+    TFD_OBJECT_PROPERTY(Area);
+    TFD_OBJECT_PROPERTY(Altitude);
+    TFD_OBJECT_PROPERTY(Visibility);
+    TFD_OBJECT_PROPERTY(Path);
+    TFD_OBJECT_PROPERTY(GroundSpeed);
+    TFD_OBJECT_PROPERTY(Heading);
+    #undef TFD_OBJECT_PROPERTY
+    #undef TFD_VIEW_PROPERTY
+
+    bool ObjectRadar::setArea(ObjectHandle handle, RadarArea &&area) noexcept {
+        priv::ROM &objs = m_data->m_objManager;
+        auto const i = objs.getIndex(handle);
+        if (!i.has_value())
+            return false;
+
+        /* Hand the vertices over; only the bounding box and the simplified levels are built here. */
+        bool const issmooth = area.m_isSmooth;
+        auto       shape    = priv::int_makeShape(area.takeVertices(), issmooth);
+        if (!shape.has_value())
+            return false;
+
+        objs.setShape(*i, std::move(*shape));
+        m_data->m_sceneData.record([&](priv::UpdateLogWriter &log) { log.shape(handle.index(), ObjectRadar::Property::Area, objs.shapes()[*i]); });
+        return true;
+    }
+
+    bool ObjectRadar::setPath(ObjectHandle handle, RadarPath &&path) noexcept {
+        priv::ROM &objs = m_data->m_objManager;
+        auto const i = objs.getIndex(handle);
+        if (!i.has_value())
+            return false;
+
+        bool const issmooth = path.m_isSmooth;
+        auto       shape    = priv::int_makeShape(path.takeVertices(), issmooth);
+        if (!shape.has_value())
+            return false;
+
+        objs.setShape(*i, std::move(*shape));
+        m_data->m_sceneData.record([&](priv::UpdateLogWriter &log) { log.shape(handle.index(), ObjectRadar::Property::Path, objs.shapes()[*i]); });
+        return true;
+    }
+
+    size_t ObjectRadar::updateObjects(ObjectUpdate const *upd, size_t n) noexcept {
+        if (upd == nullptr || n == 0)
+            return 0;
+
+        priv::ROM         &objs     = m_data->m_objManager;
+        RadarScenePrivate &scene    = m_data->m_sceneData;
+        bool const         islogged = !scene.m_recorders.empty();
+        if (islogged)
+            scene.record([](priv::UpdateLogWriter &log) { log.beginBatch(); });
+
+        size_t nupd = 0;
+        for (size_t j = 0; j < n; j++) {
+            ObjectUpdate const &rec = upd[j];
+
+            /* Get object. Skip records with invalid or stale handles. */
+            auto const i = objs.getIndex(rec.m_handle);
+            if (!i.has_value())
+                continue;
+            if (islogged)
+                scene.record([&](priv::UpdateLogWriter &log) { log.update(rec.m_handle.index(), rec); });
+
+            /* Apply selected fields. */
+            if (rec.m_fields & ObjectUpdate::Position)
+                objs.setPosition(*i, rec.m_position);
+            if (rec.m_fields & ObjectUpdate::Altitude)
+                objs.setAltitude(*i, rec.m_altitude);
+            if (rec.m_fields & ObjectUpdate::Visibility)
+                objs.setVisibility(*i, rec.m_isVisible);
+            if (rec.m_fields & ObjectUpdate::Motion)
+                objs.setMotion(*i, rec.m_groundSpeed, rec.m_heading);
+
+            ++nupd;
+        }
+        if (islogged)
+            scene.record([](priv::UpdateLogWriter &log) { log.endBatch(); });
+
+        /* The changed objects are repainted on the next frame. */
+        return nupd;
+    }
+
+    std::shared_ptr<UpdateChannel> ObjectRadar::openUpdateChannel(size_t capacity) noexcept {
+        /* Round up to the next power of two. */
+        size_t n = 2;
+        while (n < capacity && n <= SIZE_MAX / 4)
+            n *= 2;
+
+        try {
+            std::shared_ptr<UpdateChannel> ch{ new UpdateChannel(n) };
+            ch->m_data->m_consumer = m_data.get();
+            m_data->m_channels.push_back(ch);
+
+            return ch;
+        } catch (...) { }
+
+        return nullptr;
+    }
+
+    void ObjectRadar::beginTransaction() noexcept {
+        ++m_data->m_txDepth;
+        m_data->m_objManager.beginTransaction();
+    }
+
+    bool ObjectRadar::commitTransaction() noexcept {
+        priv::ROM &objs = m_data->m_objManager;
+        if (m_data->m_txDepth == 0)
+            return false;
+
+        /* Inner transactions only close. */
+        std::optional<ObjectRadar::ChangeSet> changes = objs.commitTransaction();
+        if (--m_data->m_txDepth > 0)
+            return true;
+        /* Another view of the scene still has a transaction open; it reports the objects. */
+        if (!changes.has_value())
+            changes.emplace();
+
+        quint32 const props = std::exchange(m_data->m_txProperties, 0);
+        try {
+            for (auto k = 0; k < static_cast<int>(ObjectRadar::Property::__N__); k++)
+                if (props & priv::int_propertyBit(static_cast<ObjectRadar::Property>(k)))
+                    changes->m_properties.push_back(static_cast<ObjectRadar::Property>(k));
+        } catch (...) { changes->m_isComplete = false; }
+        if (changes->isEmpty())
+            return true;
+
+        /* Rebuild everything that depends on the changed properties once. */
+        try {
+            if (props != 0)
+                m_data->int_updateCache(props);
+
+            emit changesCommitted(*changes);
+        } catch (...) { }
+        return true;
+    }
+
+    bool ObjectRadar::isInTransaction() const noexcept {
+        return m_data->m_txDepth > 0;
+    }
+
+    bool ObjectRadar::startRecording(QString const &path) noexcept {
+        stopRecording();
+
+        try {
+            auto log = std::make_unique<priv::UpdateLogWriter>(path);
+            if (!log->open())
+                return false;
+
+            /* Start with the current scene so that the log replays into an empty radar. */
+            for (auto k = 0; k < static_cast<int>(ObjectRadar::Property::__N__); k++) {
+                auto const prop = static_cast<ObjectRadar::Property>(k);
+
+                if (ObjectRadar::isViewProperty(prop))
+                    log->viewProperty(prop, getProperty(prop));
+            }
+            m_data->int_recordObjects(*log);
+            if (hasObject(m_data->m_trackedObject))
+                log->track(m_data->m_trackedObject.index());
+
+            /* From now on, object changes made through any view of the scene are logged. */
+            m_data->m_sceneData.m_recorders.push_back(log.get());
+            m_data->m_recorder = std::move(log);
+
+            return m_data->m_recorder->isRecording();
+        } catch (...) { }
+
+        return false;
+    }
+
+    bool ObjectRadar::stopRecording() noexcept {
+        if (m_data->m_recorder == nullptr)
+            return false;
+
+        auto &logs = m_data->m_sceneData.m_recorders;
+        logs.erase(std::remove(logs.begin(), logs.end(), m_data->m_recorder.get()), logs.end());
+
+        bool const isok = m_data->m_recorder->close();
+        m_data->m_recorder.reset();
+        return isok;
+    }
+
+    bool ObjectRadar::isRecording() const noexcept {
+        return m_data->m_recorder != nullptr && m_data->m_recorder->isRecording();
+    }
+
+    ObjectHandle ObjectRadar::getObjectAt(QPoint const &pt, int tolerance) const noexcept {
+        priv::ProjectionParams const &params = m_data->m_c_projection;
+        if (params.m_pxPerMeter <= 0.)
+            return ObjectHandle{};
+
+        /* Translate the screen position and tolerance into geodetic space and query the index. */
+        auto const i = m_data->m_objManager.findNearest(
+            priv::int_unprojectPosition(params, QPointF{ pt }),
+            std::max(tolerance, 0) / params.m_pxPerMeter
+        );
+        if (!i.has_value())
+            return ObjectHandle{};
+
+        return m_data->m_objManager.getHandle(*i);
+    }
+
+    std::optional<QString> const ObjectRadar::getTrackedObject() const noexcept {
+        return m_data->m_objManager.getIdentifier(m_data->m_trackedObject);
+    }
+
+    ObjectHandle ObjectRadar::getTrackedObjectHandle() const noexcept {
+        /* Do not hand out stale handles. */
+        if (!hasObject(m_data->m_trackedObject))
+            return ObjectHandle{};
+
+        return m_data->m_trackedObject;
+    }
+
+    void ObjectRadar::setTrackedObject(QString const &ident) noexcept {
+        setTrackedObject(m_data->m_objManager.findObject(ident));
+    }
+
+    void ObjectRadar::setTrackedObject(ObjectHandle handle) noexcept {
+        /* Try finding the referenced object. */
+        if (!hasObject(handle))
+            return;
+
+        /* Update tracked object. */
+        m_data->m_trackedObject = handle;
+        if (m_data->m_recorder != nullptr)
+            m_data->m_recorder->track(handle.index());
+    }
+
+    void ObjectRadar::paintEvent(QPaintEvent *pe) {
+        /* Everything is drawn by the GPU surface, if present. */
+        if (m_data->m_glSurface != nullptr)
+            return;
+
+        /* Setup painter. */
+        QPainter painter(this);
+        painter.setRenderHint(QPainter::Antialiasing);
+
+        /*
+         * Only the requested region is repainted (the painter is clipped to it). Restrict the
+         * layer blits and the object pass to its bounding rectangle.
+         */
+        QRect const  bounds = pe->rect();
+        qreal const  dpr    = m_data->m_devicePixelRatio;
+        QRectF const source{ QPointF{ bounds.topLeft() } * dpr, QSizeF{ bounds.size() } * dpr };
+
+        /* Frames are composed off-thread; just blit the latest one. */
+        if (m_data->m_composer != nullptr) {
+            {
+                TFD_PROFILE_STAGE(*m_data, Layers);
+                QImage const frame = m_data->m_composer->latest();
+                if (frame.isNull())
+                    painter.fillRect(bounds, m_data->m_bgndColor);
+                else
+                    painter.drawImage(QRectF{ bounds }, frame, QRectF{ QPointF{ bounds.topLeft() } * frame.devicePixelRatio(), QSizeF{ bounds.size() } * frame.devicePixelRatio() });
+            }
+            m_data->int_drawStatistics(painter, bounds);
+
+            return;
+        }
+
+        /* Draw the pre-rendered scale; it also fills the background (unless it's scaled down during a zoom gesture). */
+        {
+            TFD_PROFILE_STAGE(*m_data, Layers);
+            if (m_data->m_c_zoomScale == 1.)
+                painter.drawPixmap(QRectF{ bounds }, m_data->m_c_radarScale, source);
+            else {
+                painter.fillRect(bounds, m_data->m_bgndColor);
+                painter.drawPixmap(m_data->int_scaleRect(), m_data->m_c_radarScale, QRectF{ m_data->m_c_radarScale.rect() });
+            }
+        }
+
+        /* Areas and paths lie below the markers. */
+        {
+            TFD_PROFILE_STAGE(*m_data, Shapes);
+            m_data->int_drawShapes(painter, bounds, true);
         }
 
-        return false;
+        /* Project all objects in one pass (unless the dirty region pass already did), then draw. */
+        {
+            TFD_PROFILE_STAGE(*m_data, Layout);
+            m_data->int_updateProjection();
+        }
+        m_data->int_drawObjects(painter, bounds);
+
+        /* Draw the pre-rendered compass rose on top. */
+        {
+            TFD_PROFILE_STAGE(*m_data, Layers);
+            painter.drawPixmap(QRectF{ bounds }, m_data->m_c_radarCompass, source);
+        }
+        m_data->int_drawStatistics(painter, bounds);
+    }
+
+    void ObjectRadar::resizeEvent(QResizeEvent *re) {
+        QWidget::resizeEvent(re);
+
+        /* Everything that is cached depends on the widget size; rebuild all of it. */
+        m_data->m_viewSize         = re->size();
+        m_data->m_devicePixelRatio = devicePixelRatioF();
+        m_data->updateCache(static_cast<ObjectRadar::Property>(INT_MAX), {});
+        if (m_data->m_glSurface != nullptr)
+            m_data->m_glSurface->setGeometry(rect());
+    }
+}
+
+
+/* area and path vertices */
+namespace tfd {
+    bool RadarShape::addVertex(QPointF const &vertex) noexcept {
+        try {
+            m_vertices.push_back(vertex);
+        } catch (...) { return false; }
+
+        return true;
+    }
+
+    bool RadarShape::removeVertex(int index) noexcept {
+        if (index < 0 || static_cast<size_t>(index) >= m_vertices.size())
+            return false;
+
+        m_vertices.erase(m_vertices.begin() + index);
+        return true;
+    }
+
+    bool RadarShape::insertVertices(int index, QPointF const *v, size_t n) noexcept {
+        if (index < 0 || static_cast<size_t>(index) > m_vertices.size() || (v == nullptr && n > 0))
+            return false;
+
+        try {
+            m_vertices.insert(m_vertices.begin() + index, v, v + n);
+        } catch (...) { return false; }
+
+        return true;
+    }
+
+    bool RadarShape::removeVertices(int index, int count) noexcept {
+        if (index < 0 || count < 0 || static_cast<size_t>(index) + static_cast<size_t>(count) > m_vertices.size())
+            return false;
+
+        m_vertices.erase(m_vertices.begin() + index, m_vertices.begin() + index + count);
+        return true;
+    }
+
+    bool RadarShape::setVertex(int index, QPointF const &vertex) noexcept {
+        if (index < 0 || static_cast<size_t>(index) >= m_vertices.size())
+            return false;
+
+        m_vertices[index] = vertex;
+        return true;
+    }
+
+    bool RadarShape::reserve(size_t n) noexcept {
+        try {
+            m_vertices.reserve(n);
+        } catch (...) { return false; }
+
+        return true;
+    }
+
+    void RadarShape::clearVertices() noexcept {
+        m_vertices.clear();
+    }
+}
+
+
+/* update channel */
+namespace tfd {
+    UpdateChannel::UpdateChannel(size_t capacity)
+        : m_data(std::make_unique<UpdateChannelPrivate>(capacity))
+    { }
+
+    UpdateChannel::~UpdateChannel() = default;
+
+    bool UpdateChannel::push(ObjectRadar::ObjectUpdate const &upd) noexcept {
+        return m_data->push(&upd, 1) == 1;
+    }
+
+    size_t UpdateChannel::push(ObjectRadar::ObjectUpdate const *upd, size_t n) noexcept {
+        if (upd == nullptr || n == 0)
+            return 0;
+
+        return m_data->push(upd, n);
+    }
+
+    size_t UpdateChannel::capacity() const noexcept {
+        return m_data->m_mask + 1;
+    }
+
+    quint64 UpdateChannel::dropped() const noexcept {
+        return m_data->m_dropped.load(std::memory_order_relaxed);
+    }
+
+    bool UpdateChannel::isOpen() const noexcept {
+        return m_data->m_isOpen.load(std::memory_order_relaxed);
+    }
+}
+
+
+/* update log replay */
+namespace tfd {
+    UpdateReplay::UpdateReplay(ObjectRadar *radar, QObject *parent)
+        : QObject(parent),
+          m_data(std::make_unique<UpdateReplayPrivate>(radar))
+    {
+        m_data->m_timer.setSingleShot(true);
+
+        QObject::connect(&m_data->m_timer, &QTimer::timeout, this, [this]() {
+            if (m_data->step()) {
+                emit finished(m_data->m_updates, m_data->m_elapsed);
+                return;
+            }
+            m_data->m_timer.start(m_data->delay());
+        });
+    }
+
+    UpdateReplay::~UpdateReplay() = default;
+
+    bool UpdateReplay::open(QString const &path) noexcept {
+        try {
+            stop();
+
+            QFile file{ path };
+            if (!file.open(QIODevice::ReadOnly))
+                return false;
+
+            QByteArray const data = file.readAll();
+            if (static_cast<size_t>(data.size()) < UpdateReplayPrivate::gl_HeaderSize)
+                return false;
+
+            /* Check the header before replacing the loaded log. */
+            quint32 hdr[2];
+            std::memcpy(hdr, data.constData(), sizeof hdr);
+            if (hdr[0] != priv::gl_LogMagic || hdr[1] != priv::gl_LogVersion)
+                return false;
+
+            m_data->m_log.assign(data.constData(), data.constData() + data.size());
+            m_data->m_hasNext = false;
+            return true;
+        } catch (...) { }
+
+        return false;
+    }
+
+    bool UpdateReplay::start(Pace pace) noexcept {
+        if (m_data->m_log.empty())
+            return false;
+
+        stop();
+        m_data->m_pace = pace;
+        if (!m_data->rewind())
+            return false;
+
+        m_data->m_clock.start();
+        m_data->m_timer.start(0);
+        return true;
     }
 
-    std::optional<QString> const ObjectRadar::getTrackedObject() const noexcept {
-        if (m_data->m_trackedObject == nullptr)
-            return std::optional<QString>{};
+    void UpdateReplay::stop() noexcept {
+        if (!m_data->m_timer.isActive())
+            return;
 
-        // TODO implement
-        return std::optional<QString>{};
+        m_data->m_timer.stop();
+        m_data->m_elapsed = m_data->m_clock.nsecsElapsed() / 1e9;
     }
 
-    void ObjectRadar::setTrackedObject(QString const &ident) noexcept {
-        /* Try finding the referenced object. */
-        priv::RadarObject *ro = m_data->m_objManager.getObject(ident).value_or(nullptr);
-        if (ro == nullptr)
-            return;
+    bool UpdateReplay::isRunning() const noexcept {
+        return m_data->m_timer.isActive();
+    }
 
-        /* Update tracked object cache. */
-        m_data->m_trackedObject = ro;
+    quint64 UpdateReplay::getReplayedUpdates() const noexcept {
+        return m_data->m_updates;
     }
 
-    void ObjectRadar::paintEvent(QPaintEvent *pe) {
-        /* Setup painter. */
-        QPainter painter(this);
+    double UpdateReplay::getElapsedTime() const noexcept {
+        if (isRunning())
+            return m_data->m_clock.nsecsElapsed() / 1e9;
 
-        /* Fill background. */
-        painter.fillRect(QRect{ 0, 0, width(), height() }, m_data->m_bgndColor);
+        return m_data->m_elapsed;
     }
 }
 
 
-/* polygon area */
+/* shared scene */
 namespace tfd {
-    bool RadarArea::addVertex(QPointF const &vertex) noexcept {
-        try {
-            m_vertices.push_back(vertex);
-        } catch (...) { return false; }
-
-        return true;
-    }
-
-    bool RadarArea::removeVertex(int index) noexcept {
-        if (m_vertices.size() >= index || index < 0)
-            return false;
+    RadarScene::RadarScene()
+        : m_data(std::make_unique<RadarScenePrivate>())
+    { }
 
-        m_vertices.erase(m_vertices.begin() + index);
-        return true;
-    }
+    RadarScene::~RadarScene() = default;
 
-    void RadarArea::clearVertices() noexcept {
-        m_vertices.clear();
+    size_t RadarScene::getViewCount() const noexcept {
+        return m_data->m_viewCount;
     }
 }
 
@@ -652,7 +8110,7 @@ namespace tfd {
              * \brief runs before each test function is invoked 
              */
             void init() {
-                m_radar.m_data->m_objManager.m_objMap.clear();
+                m_radar.m_data->m_objManager.clearObjects();
             }
 
             /**
@@ -687,12 +8145,12 @@ namespace tfd {
                 /* Add object to radar. */
                 QVERIFY(m_radar.addObject("testObject", ObjectRadar::ObjectType::Vehicle, QPointF{ 0.f, 0.f }));
                 /* Check side-effects. */
-                QVERIFY(m_radar.m_data->m_objManager.m_objMap.size() == 1);
+                QVERIFY(m_radar.m_data->m_objManager.size() == 1);
 
                 /* Check if object can be retrieved. */
                 auto const obj = m_radar.m_data->m_objManager.getObject("testObject");
                 QVERIFY(obj.has_value());
-                QVERIFY(obj.value()->m_type == ObjectRadar::ObjectType::Vehicle);
+                QVERIFY(obj.value().m_type == ObjectRadar::ObjectType::Vehicle);
             }
             /**
              * \brief simulates adding an ill-formed radar object and tests whether the object actually
@@ -702,7 +8160,7 @@ namespace tfd {
                 /* Try adding an object with invalid parameters. */
                 QVERIFY(!m_radar.addObject("testObject", ObjectRadar::ObjectType::__N__, QPointF{ 0.f, 0.f }));
                 /* Check side-effects. */
-                QVERIFY(m_radar.m_data->m_objManager.m_objMap.size() == 0);
+                QVERIFY(m_radar.m_data->m_objManager.size() == 0);
 
                 /* Check if object can be retrieved. */
                 auto const obj = m_radar.m_data->m_objManager.getObject("testObject");
@@ -770,6 +8228,49 @@ namespace tfd {
                 /* Try updating a property with an invalid value. */
                 QVERIFY(!(m_radar.setProperty("testObject1", ObjectRadar::Property::Position, QColor{ Qt::magenta })));
             }
+            /**
+             * \brief tests whether the typed property accessors apply the same checks as the
+             *        *QVariant*-based ones and are interchangeable with them
+             */
+            void testObjectRadarTypedProperties() {
+                ObjectRadar radar{ QSize{ 200, 200 } };
+
+                /* View properties; ranges are checked, equal values are not reported. */
+                int nchanged = 0;
+                QObject::connect(&radar, &ObjectRadar::propertyValueChanged, &radar, [&nchanged]() { ++nchanged; });
+                QVERIFY(radar.set<ObjectRadar::Property::RadarCenter>(QPointF{ 48., 11. }));
+                QVERIFY(radar.get<ObjectRadar::Property::RadarCenter>() == QPointF(48., 11.));
+                QVERIFY(radar.getProperty(ObjectRadar::Property::RadarCenter).toPointF() == QPointF(48., 11.));
+                QVERIFY(radar.set<ObjectRadar::Property::RadarCenter>(QPointF{ 48., 11. }) && nchanged == 1);
+                QVERIFY(!radar.set<ObjectRadar::Property::UpdateRate>(0.f) && !radar.set<ObjectRadar::Property::UpdateRate>(241.f));
+                QVERIFY(radar.set<ObjectRadar::Property::UpdateRate>(240.f) && radar.get<ObjectRadar::Property::UpdateRate>() == 240.f);
+                QVERIFY(radar.set<ObjectRadar::Property::RedrawMode>(ObjectRadar::RedrawMode::OnDemand));
+                QVERIFY(radar.getProperty(ObjectRadar::Property::RedrawMode).toInt() == static_cast<int>(ObjectRadar::RedrawMode::OnDemand));
+                QVERIFY(radar.set<ObjectRadar::Property::OutlineStyle>(Qt::DashLine) && radar.get<ObjectRadar::Property::OutlineStyle>() == Qt::DashLine);
+                QVERIFY(!radar.set<ObjectRadar::Property::OutlineStyle>(Qt::CustomDashLine));
+
+                /* Object properties. */
+                ObjectHandle const obj = radar.addObject(QString{ "OBJ" }, ObjectRadar::ObjectType::Vehicle, QPointF{});
+                QVERIFY(radar.set<ObjectRadar::Property::Position>(obj, QPointF{ 48.1, 11.5 }));
+                QVERIFY(radar.get<ObjectRadar::Property::Position>(obj) == QPointF(48.1, 11.5));
+                QVERIFY(radar.getProperty(obj, ObjectRadar::Property::Position).toPointF() == QPointF(48.1, 11.5));
+                QVERIFY(radar.setProperty(obj, ObjectRadar::Property::Altitude, 250.f));
+                QVERIFY(radar.get<ObjectRadar::Property::Altitude>(obj) == 250.f);
+                QVERIFY(!radar.set<ObjectRadar::Property::Heading>(obj, 361.f) && radar.set<ObjectRadar::Property::Heading>(obj, 360.f));
+                QVERIFY(!radar.set<ObjectRadar::Property::Type>(obj, ObjectRadar::ObjectType::__N__));
+                QVERIFY(radar.set<ObjectRadar::Property::Type>(obj, ObjectRadar::ObjectType::Marker));
+                QVERIFY(radar.get<ObjectRadar::Property::Type>(obj) == ObjectRadar::ObjectType::Marker);
+                QVERIFY(radar.set<ObjectRadar::Property::Identifier>(obj, QString{ "RENAMED" }) && radar.getHandle(QString{ "RENAMED" }) == obj);
+
+                std::vector<QPointF> const outline{ { 0., 0. }, { 0., 1e-2 }, { 1e-2, 0. } };
+                QVERIFY(radar.set<ObjectRadar::Property::Area>(obj, RadarArea{ std::vector<QPointF>(outline) }));
+                QVERIFY(radar.get<ObjectRadar::Property::Area>(obj)->vertices() == outline);
+
+                /* Stale handles. */
+                QVERIFY(radar.removeObject(obj));
+                QVERIFY(!radar.set<ObjectRadar::Property::Position>(obj, QPointF{}));
+                QVERIFY(!radar.get<ObjectRadar::Property::Visibility>(obj).has_value());
+            }
             /**
              */
             void testUpdateIdentifierOfRadarObject() {
@@ -785,6 +8286,56 @@ namespace tfd {
                 /* Try updating name to the name of an already existing object. */
                 QVERIFY(!m_radar.setProperty("newName", ObjectRadar::Property::Identifier, "testObject2"));
             }
+            /**
+             * \brief tests whether object handles stay valid across renames and become stale on removal
+             */
+            void testObjectRadarObjectHandles() {
+                /* Add a test radar object and track it. */
+                ObjectHandle const obj = m_radar.addObject("testObject1", ObjectRadar::ObjectType::Vehicle, QPointF{ 1.f, 1.f });
+                QVERIFY(obj.isValid());
+                QVERIFY(m_radar.getHandle("testObject1") == obj);
+                m_radar.setTrackedObject(obj);
+
+                /* Rename the object; handle and tracked state must survive. */
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Identifier, "newName"));
+                QVERIFY(m_radar.getProperty(obj, ObjectRadar::Property::Identifier) == QString{ "newName" });
+                QVERIFY(m_radar.getTrackedObject() == QString{ "newName" });
+                QVERIFY(!m_radar.getHandle("testObject1").isValid());
+
+                /* Remove the object; the handle must be stale now, even if the slot is reused. */
+                QVERIFY(m_radar.removeObject(obj));
+                QVERIFY(!m_radar.getTrackedObject().has_value());
+                ObjectHandle const reused = m_radar.addObject("testObject2", ObjectRadar::ObjectType::Person, QPointF{ 2.f, 2.f });
+                QVERIFY(reused.index() == obj.index());
+                QVERIFY(!m_radar.hasObject(obj));
+                QVERIFY(!m_radar.getProperty(obj, ObjectRadar::Property::Position).isValid());
+                QVERIFY(m_radar.hasObject(reused));
+            }
+            /**
+             * \brief tests whether batched object updates are applied correctly
+             */
+            void testObjectRadarBatchUpdate() {
+                /* Add a few test radar objects. */
+                ObjectHandle const obj1 = m_radar.addObject("testObject1", ObjectRadar::ObjectType::Vehicle, QPointF{ 1.f, 1.f });
+                ObjectHandle const obj2 = m_radar.addObject("testObject2", ObjectRadar::ObjectType::Person, QPointF{ 2.f, 2.f }, 10.f);
+                QVERIFY(obj1 && obj2);
+
+                /* Submit a batch with one record per object and one with an invalid handle. */
+                std::vector<ObjectRadar::ObjectUpdate> const batch = {
+                    { obj1, QPointF{ 5.f, 6.f }, 100.f, false },
+                    { obj2, QPointF{ 7.f, 8.f }, 0.f, true, ObjectRadar::ObjectUpdate::Position },
+                    { ObjectHandle{}, QPointF{ 0.f, 0.f } }
+                };
+                QVERIFY(m_radar.updateObjects(batch) == 2);
+
+                /* Verify that all fields of the first record were applied. */
+                QVERIFY((m_radar.getProperty("testObject1", ObjectRadar::Property::Position) == QPointF{ 5.f, 6.f }));
+                QVERIFY(m_radar.getProperty("testObject1", ObjectRadar::Property::Altitude) == 100.f);
+                QVERIFY(m_radar.getProperty("testObject1", ObjectRadar::Property::Visibility) == false);
+                /* Verify that only the selected field of the second record was applied. */
+                QVERIFY((m_radar.getProperty("testObject2", ObjectRadar::Property::Position) == QPointF{ 7.f, 8.f }));
+                QVERIFY(m_radar.getProperty("testObject2", ObjectRadar::Property::Altitude) == 10.f);
+            }
             /**
              * \brief whether finding and removing an object from the radar works 
              */
@@ -798,8 +8349,11 @@ namespace tfd {
                  * not removed.
                  */
                 QVERIFY(m_radar.removeObject("testObject1"));
-                QVERIFY(m_radar.m_data->m_objManager.m_objMap.size() == 1);
+                QVERIFY(m_radar.m_data->m_objManager.size() == 1);
                 QVERIFY(m_radar.m_data->m_objManager.getObject("testObject2").has_value());
+                /* Verify that the remaining object was moved into the hole with its fields intact. */
+                QVERIFY((m_radar.getProperty("testObject2", ObjectRadar::Property::Position) == QPointF{ 65.f, -12.f }));
+                QVERIFY(m_radar.getHandle("testObject2") == m_radar.m_data->m_objManager.getHandle(0));
             }
             /**
              * \brief tests whether all objects can be removed at once 
@@ -811,11 +8365,995 @@ namespace tfd {
                 QVERIFY(m_radar.addObject("testObject3", ObjectRadar::ObjectType::Path, QPointF{ 5.f, -100.f }));
                 QVERIFY(m_radar.addObject("testObject4", ObjectRadar::ObjectType::Person, QPointF{ 19.f, 89.f }));
                 /* Verify size. */
-                QVERIFY(m_radar.m_data->m_objManager.m_objMap.size() == 4);
+                QVERIFY(m_radar.m_data->m_objManager.size() == 4);
 
                 /* Delete all objects and verify size again. */
                 m_radar.removeAllObjects();
-                QVERIFY(m_radar.m_data->m_objManager.m_objMap.size() == 0);
+                QVERIFY(m_radar.m_data->m_objManager.size() == 0);
+            }
+            /**
+             * \brief tests whether transactions defer notifications and report all changes at once
+             */
+            void testObjectRadarTransaction() {
+                ObjectRadar radar{ QSize{ 200, 200 } };
+
+                int                    nchanged   = 0;
+                int                    ncommitted = 0;
+                ObjectRadar::ChangeSet last;
+                QObject::connect(&radar, &ObjectRadar::propertyValueChanged, &radar, [&nchanged]() { ++nchanged; });
+                QObject::connect(&radar, &ObjectRadar::changesCommitted, &radar, [&ncommitted, &last](ObjectRadar::ChangeSet const &changes) {
+                    ++ncommitted;
+                    last = changes;
+                });
+                QVERIFY(!radar.commitTransaction());
+
+                quint64 const revision = radar.m_data->m_c_viewRevision;
+                ObjectHandle  gone;
+                {
+                    ObjectRadar::Transaction tx{ radar };
+                    QVERIFY(radar.isInTransaction());
+
+                    for (int k = 0; k < 100; k++)
+                        QVERIFY(radar.addObject(QString{ "OBJ%1" }.arg(k), ObjectRadar::ObjectType::Marker, QPointF{}).isValid());
+                    gone = radar.getHandle(QString{ "OBJ0" });
+                    radar.setTrackedObject(gone);
+                    QVERIFY(radar.removeObject(gone));
+                    QVERIFY(radar.setProperty(radar.getHandle(QString{ "OBJ1" }), ObjectRadar::Property::Identifier, QString{ "RENAMED" }));
+
+                    /* Nested transactions only close. */
+                    radar.beginTransaction();
+                    QVERIFY(radar.setProperty(ObjectRadar::Property::RadarCenter, QPointF(48., 11.)));
+                    QVERIFY(radar.set<ObjectRadar::Property::RadarRange>(QSizeF{ 5., 1000. }));
+                    QVERIFY(radar.set<ObjectRadar::Property::RadarRange>(QSizeF{ 5., 2000. }));
+                    QVERIFY(radar.commitTransaction() && radar.isInTransaction());
+
+                    /* Changes take effect right away; only the notifications are deferred. */
+                    QVERIFY(radar.get<ObjectRadar::Property::RadarRange>() == QSizeF(5., 2000.));
+                    QVERIFY(nchanged == 0 && ncommitted == 0);
+                    QVERIFY(radar.m_data->m_c_viewRevision == revision);
+                }
+                QVERIFY(!radar.isInTransaction());
+                QVERIFY(nchanged == 0 && ncommitted == 1);
+                QVERIFY(last.m_added.size() == 100 && last.m_removed.size() == 1 && last.m_removed[0] == QString{ "OBJ0" });
+                QVERIFY(last.m_renamed.size() == 1 && last.m_renamed[0].second == QString{ "RENAMED" });
+                QVERIFY(last.m_properties.size() == 2 && last.m_properties[0] == ObjectRadar::Property::RadarCenter);
+                QVERIFY(!last.m_isCleared && last.m_isComplete);
+                /* The projection was rebuilt once, and the removed object is not tracked anymore. */
+                QVERIFY(radar.m_data->m_c_viewRevision == revision + 1);
+                QVERIFY(!radar.m_data->m_trackedObject.isValid());
+
+                /* Empty transactions are not reported; clearing discards earlier object changes. */
+                radar.beginTransaction();
+                QVERIFY(radar.commitTransaction() && ncommitted == 1);
+                radar.beginTransaction();
+                QVERIFY(radar.addObject(QString{ "LATE" }, ObjectRadar::ObjectType::Marker, QPointF{}).isValid());
+                radar.removeAllObjects();
+                QVERIFY(radar.addObject(QString{ "NEW" }, ObjectRadar::ObjectType::Marker, QPointF{}).isValid());
+                QVERIFY(radar.commitTransaction() && ncommitted == 2);
+                QVERIFY(last.m_isCleared && last.m_added.size() == 1 && last.m_added[0] == QString{ "NEW" });
+
+                /* Outside of transactions, every change is reported on its own. */
+                QVERIFY(radar.setProperty(ObjectRadar::Property::ClusterCellSize, 16) && nchanged == 1);
+            }
+            /**
+             * \brief tests whether object radars sharing a scene share objects and icons, but not their views
+             */
+            void testObjectRadarSharedScene() {
+                auto const scene  = std::make_shared<RadarScene>();
+                auto       zoomed = std::make_unique<ObjectRadar>(scene, QSize{ 200, 200 });
+                ObjectRadar wide{ scene, QSize{ 200, 200 } };
+                QVERIFY(scene->getViewCount() == 2 && wide.getScene() == scene);
+                QVERIFY(&zoomed->m_data->m_objManager == &wide.m_data->m_objManager);
+
+                /* Both views start out dirty; an update made through one of them is seen by both. */
+                QVERIFY(zoomed->m_data->int_takeChanges() && wide.m_data->int_takeChanges());
+                ObjectHandle const obj = zoomed->addObject(QString{ "OBJ" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 48., 11. });
+                QVERIFY(obj.isValid() && wide.getProperty(obj, ObjectRadar::Property::Position) == QPointF(48., 11.));
+                QVERIFY(zoomed->m_data->int_takeChanges() && !zoomed->m_data->int_takeChanges());
+                QVERIFY(wide.m_data->int_takeChanges() && wide.m_data->m_c_dirtySlots.size() == 1);
+
+                /* View properties are per view; icons at the same device pixel ratio are shared. */
+                QVERIFY(wide.set<ObjectRadar::Property::RadarRange>(QSizeF(5., 5000.)));
+                QVERIFY(zoomed->get<ObjectRadar::Property::RadarRange>() == QSizeF(5., 35.));
+                QVERIFY(zoomed->m_data->m_c_sprites == wide.m_data->m_c_sprites);
+
+                /* Closing a view releases its change tracker; the scene lives on. */
+                zoomed.reset();
+                QVERIFY(scene->getViewCount() == 1 && wide.getProperty(obj, ObjectRadar::Property::Position).isValid());
+                ObjectRadar other{ scene, QSize{ 200, 200 } };
+                QVERIFY(other.m_data->m_changeTracker.has_value() && scene->getViewCount() == 2);
+
+                /* Objects removed in a transaction of another view are not tracked anymore. */
+                wide.setTrackedObject(obj);
+                QVERIFY(wide.m_data->m_trackedObject == obj);
+                other.beginTransaction();
+                QVERIFY(other.removeObject(obj) && !wide.isInTransaction());
+                QVERIFY(other.commitTransaction() && !wide.m_data->m_trackedObject.isValid());
+            }
+            /**
+             * \brief tests the batch projection kernel against the scalar reference projection
+             */
+            void testObjectRadarProjection() {
+                priv::ProjectionParams const params = priv::int_makeProjection(QPointF{ 48.137, 11.575 }, QSizeF{ 5.f, 100.f }, QSize{ 600, 600 });
+
+                /* The radar center must be projected onto the screen center. */
+                QVERIFY(priv::int_projectPosition(params, params.m_center) == params.m_origin);
+                /* A position straight north at max. range must end up at the top of the view. */
+                QPointF const north = priv::int_projectPosition(params, QPointF{ 48.137 + 100. / priv::gl_MetersPerDeg, 11.575 });
+                QVERIFY(std::abs(north.x() - params.m_origin.x()) < 1e-6);
+                QVERIFY(std::abs(params.m_origin.y() - north.y() - params.m_radius) < 1e-6);
+
+                /* Use an odd number of positions so that the vector remainder path is exercised. */
+                std::vector<QPointF> in;
+                for (int i = 0; i < 7; i++)
+                    in.push_back(QPointF{ 48.137 + i * 1e-4, 11.575 - i * 2e-4 });
+                std::vector<QPointF> out(in.size());
+                priv::int_projectPositions(params, in.data(), out.data(), in.size());
+
+                for (size_t i = 0; i < in.size(); i++) {
+                    QPointF const ref = priv::int_projectPosition(params, in[i]);
+
+                    QVERIFY(std::abs(out[i].x() - ref.x()) < 1e-6 && std::abs(out[i].y() - ref.y()) < 1e-6);
+                    /* Verify the inverse projection, too. */
+                    QPointF const geo = priv::int_unprojectPosition(params, out[i]);
+                    QVERIFY(std::abs(geo.x() - in[i].x()) < 1e-9 && std::abs(geo.y() - in[i].y()) < 1e-9);
+                }
+            }
+            /**
+             * \brief tests the local position mirror, its projection kernel, and whether the local
+             *        frame is anchored once and only rebased if positions leave its range
+             */
+            void testObjectRadarLocalPositions() {
+                ObjectRadar   radar{ QSize{ 600, 600 } };
+                priv::ROM    &objs = radar.m_data->m_objManager;
+                QPointF const center{ 48.137, 11.575 };
+
+                /* The first object anchors the frame; use an odd number of objects so that the vector remainder path is exercised. */
+                std::vector<ObjectHandle> handles;
+                for (int i = 0; i < 7; i++)
+                    handles.push_back(radar.addObject(QString::number(i), ObjectRadar::ObjectType::Vehicle, center + QPointF{ i * 3e-3, -i * 5e-3 }));
+                QVERIFY(objs.localFrame().m_anchor == center);
+                QVERIFY(radar.setProperty(handles[3], ObjectRadar::Property::Position, center + QPointF{ 1e-2, 1e-2 }));
+                QVERIFY(radar.removeObject(handles[1]));
+
+                auto const check = [&objs](QPointF const &c) {
+                    priv::ProjectionParams const params = priv::int_makeProjection(c, QSizeF(5., 5000.), QSize(600, 600));
+                    size_t const                 n      = objs.size();
+
+                    std::vector<QPointF> out(n);
+                    priv::int_projectLocalPositions(priv::int_makeLocalProjection(params, objs.localFrame()), objs.localPositions().data(), out.data(), n);
+                    for (size_t i = 0; i < n; i++) {
+                        QPointF const ref = priv::int_projectPosition(params, objs.positions()[i]);
+
+                        /* Fixed-point rounding is half a centimeter at most. */
+                        if (std::abs(out[i].x() - ref.x()) > 1e-3 || std::abs(out[i].y() - ref.y()) > 1e-3)
+                            return false;
+                    }
+                    return n == 6;
+                };
+                QVERIFY(check(center));
+                QVERIFY(check(center + QPointF{ 1e-2, -1e-2 }));
+
+                /* Views never move the frame, however far away they are centered. */
+                QPointF const distant = center + QPointF{ 0.5, 0.5 };
+                QVERIFY(radar.setProperty(ObjectRadar::Property::RadarCenter, distant));
+                QVERIFY(objs.localFrame().m_anchor == center);
+                QVERIFY(check(distant));
+
+                /* A position beyond the range of the fixed-point format rebases onto the centroid. */
+                radar.removeAllObjects();
+                QVERIFY(radar.addObject(QString{ "WEST" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 0., -170. }).isValid());
+                QVERIFY(objs.localFrame().m_anchor == QPointF(0., -170.));
+                QVERIFY(radar.addObject(QString{ "EAST" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 0., 170. }).isValid());
+                QVERIFY(objs.localFrame().m_anchor == QPointF(0., 0.) && !objs.m_isClamped);
+                QVERIFY(objs.localPositions()[0].m_east < 0 && objs.localPositions()[1].m_east > 0);
+            }
+            /**
+             * \brief tests range queries and hit-testing via the spatial index
+             */
+            void testObjectRadarSpatialIndex() {
+                priv::ROM &objs = m_radar.m_data->m_objManager;
+                QPointF const center{ 48.137, 11.575 };
+                double const  dlat = 1. / priv::gl_MetersPerDeg;
+
+                /* Add objects 10, 20, 40 and 1000 meters north of the center. */
+                ObjectHandle const obj10 = m_radar.addObject("obj10", ObjectRadar::ObjectType::Vehicle, center + QPointF{ 10. * dlat, 0. });
+                QVERIFY(m_radar.addObject("obj20", ObjectRadar::ObjectType::Person, center + QPointF{ 20. * dlat, 0. }));
+                ObjectHandle const obj40 = m_radar.addObject("obj40", ObjectRadar::ObjectType::Marker, center + QPointF{ 40. * dlat, 0. });
+                QVERIFY(m_radar.addObject("obj1000", ObjectRadar::ObjectType::Marker, center + QPointF{ 1000. * dlat, 0. }));
+
+                std::vector<quint32> res;
+                objs.queryRadius(center, 30., res);
+                QVERIFY(res.size() == 2);
+
+                /* Move an object into range; the index must follow. */
+                QVERIFY(m_radar.setProperty(obj40, ObjectRadar::Property::Position, center + QPointF{ 25. * dlat, 0. }));
+                res.clear();
+                objs.queryRadius(center, 30., res);
+                QVERIFY(res.size() == 3);
+
+                /* Rebuilding the index for a much larger range must not lose any objects. */
+                objs.adaptIndex(5000.);
+                res.clear();
+                objs.queryRadius(center, 2000., res);
+                QVERIFY(res.size() == 4);
+
+                /* Nearest-object queries. */
+                auto const nearest = objs.findNearest(center, 15.);
+                QVERIFY(nearest.has_value() && objs.getHandle(*nearest) == obj10);
+                QVERIFY(!objs.findNearest(center, 5.).has_value());
+
+                /* Removal must drop the object from the index. */
+                QVERIFY(m_radar.removeObject(obj10));
+                QVERIFY(!objs.findNearest(center, 15.).has_value());
+                objs.adaptIndex(m_radar.m_data->m_radarRange.height());
+            }
+            /**
+             * \brief tests whether the pre-rendered layers are only rebuilt when a property they depend on changes
+             */
+            void testObjectRadarLayerCache() {
+                QColor const  fgnd       = m_radar.m_data->m_fgndColor;
+                QPointF const center     = m_radar.m_data->m_radarCenter;
+                qint64 const  scaleKey   = m_radar.m_data->m_c_radarScale.cacheKey();
+                qint64 const  compassKey = m_radar.m_data->m_c_radarCompass.cacheKey();
+
+                /* Setting a property to its current value must not invalidate anything. */
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::ForegroundColor, fgnd));
+                QVERIFY(m_radar.m_data->m_c_radarScale.cacheKey() == scaleKey);
+                QVERIFY(m_radar.m_data->m_c_radarCompass.cacheKey() == compassKey);
+
+                /* The center affects neither layer. */
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::RadarCenter, QPointF{ 1., 1. }));
+                QVERIFY(m_radar.m_data->m_c_radarScale.cacheKey() == scaleKey);
+                QVERIFY(m_radar.m_data->m_c_radarCompass.cacheKey() == compassKey);
+
+                /* The foreground color affects both layers. */
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::ForegroundColor, QColor{ Qt::green }));
+                QVERIFY(m_radar.m_data->m_c_radarScale.cacheKey() != scaleKey);
+                QVERIFY(m_radar.m_data->m_c_radarCompass.cacheKey() != compassKey);
+                QVERIFY(!m_radar.m_data->m_c_radarScale.isNull());
+
+                /* Leave the shared radar as it was for the following tests. */
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::ForegroundColor, fgnd));
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::RadarCenter, center));
+            }
+            /**
+             * \brief tests whether only the parts of the view covered by changed objects are repainted
+             */
+            void testObjectRadarDirtyRegion() {
+                ObjectRadarPrivate &data = *m_radar.m_data;
+                QRect const         all{ QPoint{ 0, 0 }, data.m_viewSize };
+                double const        dlat = 1. / priv::gl_MetersPerDeg;
+
+                /* Removing all objects invalidates the entire view; afterwards nothing is dirty. */
+                QVERIFY(data.int_takeDirtyRegion() == QRegion{ all });
+                QVERIFY(data.int_takeDirtyRegion().isEmpty());
+
+                /* Adding an object only invalidates its marker. */
+                ObjectHandle const obj = m_radar.addObject("obj", ObjectRadar::ObjectType::Vehicle, data.m_radarCenter);
+                QRect const        before = data.int_takeDirtyRegion().boundingRect();
+                QVERIFY(!before.isEmpty() && before.width() < all.width() / 4);
+                QVERIFY(data.int_takeDirtyRegion().isEmpty());
+
+                /* Moving it invalidates both its old and its new marker. The paint pass reuses the projection. */
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Position, data.m_radarCenter + QPointF{ 10. * dlat, 0. }));
+                QVERIFY(!data.m_c_isProjected);
+                QRect const moved = data.int_takeDirtyRegion().boundingRect();
+                QVERIFY(moved.contains(before) && moved.height() > before.height());
+                QVERIFY(data.m_c_isProjected);
+
+                /* Moving it out of range only erases its last marker. */
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Position, data.m_radarCenter + QPointF{ 1., 0. }));
+                QRect const erased = data.int_takeDirtyRegion().boundingRect();
+                QVERIFY(!erased.isEmpty() && moved.contains(erased) && !erased.contains(before));
+                QVERIFY(data.int_takeDirtyRegion().isEmpty());
+
+                /* View property changes invalidate the entire view. */
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::BackgroundColor, QColor{ Qt::darkBlue }));
+                QVERIFY(data.int_takeDirtyRegion() == QRegion{ all });
+
+                /* Both kinds of invalidation at once are taken in one go. */
+                m_radar.removeAllObjects();
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::BackgroundColor, QColor{ Qt::black }));
+                QVERIFY(data.int_takeDirtyRegion() == QRegion{ all });
+                QVERIFY(data.int_takeDirtyRegion().isEmpty());
+            }
+            /**
+             * \brief tests whether frames are only scheduled on changes in on-demand redraw mode
+             */
+            void testObjectRadarRedrawMode() {
+                ObjectRadarPrivate &data = *m_radar.m_data;
+                QVERIFY(data.m_redrawTimer.isActive() && !data.m_redrawTimer.isSingleShot());
+
+                /* Switching to on-demand mode stops the periodic timer. */
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::RedrawMode, static_cast<int>(ObjectRadar::RedrawMode::OnDemand)));
+                QVERIFY(data.m_redrawTimer.isSingleShot());
+                data.m_redrawTimer.stop();
+                data.int_takeDirtyRegion();
+
+                /* Any change schedules exactly one frame. */
+                ObjectHandle const obj = m_radar.addObject("obj", ObjectRadar::ObjectType::Marker, data.m_radarCenter);
+                QVERIFY(data.m_redrawTimer.isActive());
+                data.m_redrawTimer.stop();
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Color, QColor{ Qt::red }));
+                QVERIFY(!data.m_redrawTimer.isActive());
+                data.int_takeDirtyRegion();
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Color, QColor{ Qt::green }));
+                QVERIFY(data.m_redrawTimer.isActive());
+
+                /* Back to fixed-rate mode; invalid modes are rejected. */
+                QVERIFY(!m_radar.setProperty(ObjectRadar::Property::RedrawMode, static_cast<int>(ObjectRadar::RedrawMode::__N__)));
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::RedrawMode, static_cast<int>(ObjectRadar::RedrawMode::FixedRate)));
+                QVERIFY(data.m_redrawTimer.isActive() && !data.m_redrawTimer.isSingleShot());
+            }
+            /**
+             * \brief tests whether icon sprites are rasterized once per variant and survive atlas growth
+             */
+            void testObjectRadarSpriteAtlas() {
+                priv::SpriteAtlas atlas;
+                atlas.reset(2.);
+
+                auto const vehicle = atlas.get(ObjectRadar::ObjectType::Vehicle, priv::AltitudeBand::Above, QColor{ Qt::red });
+                QVERIFY(vehicle.has_value() && vehicle->width() == priv::gl_SpriteSize * 2.);
+                quint64 const rev = atlas.revision();
+
+                /* Same variant, same sprite; no re-rasterization. */
+                QVERIFY(atlas.get(ObjectRadar::ObjectType::Vehicle, priv::AltitudeBand::Above, QColor{ Qt::red }) == vehicle);
+                QVERIFY(atlas.revision() == rev);
+                /* Different altitude band or color, different sprite. */
+                QVERIFY(atlas.get(ObjectRadar::ObjectType::Vehicle, priv::AltitudeBand::Below, QColor{ Qt::red }) != vehicle);
+                QVERIFY(atlas.get(ObjectRadar::ObjectType::Vehicle, priv::AltitudeBand::Above, QColor{ Qt::green }) != vehicle);
+
+                /* Growing the atlas must not move existing sprites. */
+                for (int k = 0; k < 3 * priv::gl_AtlasColumns; k++)
+                    QVERIFY(atlas.get(ObjectRadar::ObjectType::Marker, priv::AltitudeBand::Level, QColor{ k, 0, 0 }).has_value());
+                QVERIFY(atlas.get(ObjectRadar::ObjectType::Vehicle, priv::AltitudeBand::Above, QColor{ Qt::red }) == vehicle);
+                QVERIFY(atlas.pixmap().height() >= 3 * priv::gl_SpriteSize * 2.);
+
+                /* Relative altitude classification. */
+                QVERIFY(priv::int_altitudeBand(std::nanf(""), 0.f) == priv::AltitudeBand::Unknown);
+                QVERIFY(priv::int_altitudeBand(100.f, 90.f) == priv::AltitudeBand::Level);
+                QVERIFY(priv::int_altitudeBand(200.f, 90.f) == priv::AltitudeBand::Above);
+            }
+            /**
+             * \brief tests whether updates queued on another thread are drained in order without blocking
+             */
+            void testObjectRadarUpdateChannel() {
+                ObjectRadarPrivate &data = *m_radar.m_data;
+                ObjectHandle const  obj  = m_radar.addObject("remote", ObjectRadar::ObjectType::Vehicle, data.m_radarCenter);
+
+                /* Capacity is rounded up; records beyond it are rejected, not waited for. */
+                std::shared_ptr<UpdateChannel> ch = m_radar.openUpdateChannel(5);
+                QVERIFY(ch != nullptr && ch->capacity() == 8 && ch->isOpen());
+                std::thread producer([&ch, obj]() {
+                    for (int k = 0; k < 10; k++) {
+                        ObjectRadar::ObjectUpdate upd;
+                        upd.m_handle   = obj;
+                        upd.m_altitude = static_cast<float>(k);
+                        upd.m_fields   = ObjectRadar::ObjectUpdate::Field::Altitude;
+                        ch->push(upd);
+                    }
+                });
+                producer.join();
+                QVERIFY(ch->dropped() == 2);
+
+                /* Drained in order and applied like a batch. */
+                auto const &upd = data.int_drainChannels();
+                QVERIFY(upd.size() == 8 && upd.front().m_altitude == 0.f && upd.back().m_altitude == 7.f);
+                QVERIFY(m_radar.updateObjects(upd) == 8);
+                QVERIFY(m_radar.getProperty(obj, ObjectRadar::Property::Altitude).toFloat() == 7.f);
+                QVERIFY(data.int_drainChannels().empty());
+
+                /* Released channels are closed; so are channels of destroyed object radars. */
+                std::weak_ptr<UpdateChannel> const weak = ch;
+                ch.reset();
+                data.int_drainChannels();
+                QVERIFY(weak.expired() && data.m_channels.empty());
+                {
+                    ObjectRadar radar{ QSize{ 100, 100 } };
+                    ch = radar.openUpdateChannel();
+                }
+                QVERIFY(!ch->isOpen() && !ch->push(ObjectRadar::ObjectUpdate{}));
+                QVERIFY(m_radar.removeObject(obj));
+            }
+            /**
+             * \brief tests whether frames are composed on a worker thread from scene snapshots
+             */
+            void testObjectRadarThreadedComposition() {
+                ObjectRadar         radar{ QSize{ 200, 200 }, nullptr, ObjectRadar::Backend::Threaded };
+                ObjectRadarPrivate &data = *radar.m_data;
+                QVERIFY(radar.getBackend() == ObjectRadar::Backend::Threaded);
+
+                /* Hidden objects and shapes outside of the view are not part of the scene. */
+                QPointF const c = data.m_radarCenter;
+                radar.addObject("a", ObjectRadar::ObjectType::Vehicle, c);
+                radar.setProperty(radar.addObject("b", ObjectRadar::ObjectType::Vehicle, c), ObjectRadar::Property::Visibility, false);
+                ObjectHandle const distant = radar.addObject("c", ObjectRadar::ObjectType::Path, c);
+                QVERIFY(radar.setPath(distant, RadarPath{ { c + QPointF{ 1., 1. }, c + QPointF{ 1., 1.1 } } }));
+
+                QVERIFY(data.int_takeChanges() && !data.int_takeChanges());
+                auto const scene = data.int_makeScene();
+                QVERIFY(scene != nullptr && scene->m_markers.size() == 1 && scene->m_outlines.empty());
+
+                /* Layers are converted once and shared by subsequent scenes. */
+                QVERIFY(data.int_makeScene()->m_scale.cacheKey() == scene->m_scale.cacheKey());
+
+                /* Outlines are shared with the geometry cache and only rebuilt if the shape changes. */
+                double const       d    = 10. / priv::gl_MetersPerDeg;
+                ObjectHandle const area = radar.addObject("d", ObjectRadar::ObjectType::Area, c);
+                QVERIFY(radar.setArea(area, RadarArea{ c + QPointF{ -d, -d }, c + QPointF{ -d, d }, c + QPointF{ d, d } }));
+                auto const shared = data.int_makeScene();
+                QVERIFY(shared != nullptr && shared->m_outlines.size() == 1);
+                QVERIFY(shared->m_outlines[0].m_outline == data.int_geometryOf(*data.m_objManager.getIndex(area)).m_outline);
+                QVERIFY(data.int_makeScene()->m_outlines[0].m_outline == shared->m_outlines[0].m_outline);
+                QVERIFY(radar.setArea(area, RadarArea{ c + QPointF{ -d, -d }, c + QPointF{ d, -d }, c + QPointF{ d, d } }));
+                QVERIFY(data.int_makeScene()->m_outlines[0].m_outline != shared->m_outlines[0].m_outline);
+                QVERIFY(radar.removeObject(area));
+
+                /* Composing works off any thread; the composer publishes the latest frame. */
+                QImage const frame = priv::int_composeFrame(*scene);
+                QVERIFY(!frame.isNull() && frame.size() == scene->m_size * scene->m_dpr);
+                data.m_composer->submit(scene);
+                QTRY_VERIFY(!data.m_composer->latest().isNull());
+            }
+            /**
+             * \brief tests whether the parallel culling pass yields the same objects as the serial one
+             */
+            void testObjectRadarParallelCulling() {
+                ObjectRadar         radar{ QSize{ 400, 400 } };
+                ObjectRadarPrivate &data = *radar.m_data;
+                QPointF const       c    = data.m_radarCenter;
+                double const        r    = data.m_radarRange.height();
+
+                /* Objects on a grid spanning twice the radar range. */
+                for (int k = 0; static_cast<size_t>(k) < priv::gl_ParallelThreshold + 100; k++) {
+                    QPointF const off{ (k % 97 - 48) * r / 24.3, (k / 97 - 48) * r / 24.3 };
+                    radar.addObject(QString::number(k), ObjectRadar::ObjectType::Vehicle, c + off / priv::gl_MetersPerDeg);
+                }
+                data.int_projectObjects();
+
+                std::vector<quint32> expected;
+                for (size_t i = 0; i < data.m_objManager.size(); i++)
+                    if (priv::int_distanceSquared(c, data.m_objManager.positions()[i]) <= r * r)
+                        expected.push_back(static_cast<quint32>(i));
+                std::vector<quint32> actual = data.m_c_inRange;
+                std::sort(actual.begin(), actual.end());
+                QVERIFY(!expected.empty() && actual == expected);
+                QVERIFY(data.m_c_screenPositions.size() == actual.size());
+
+                /* Each screen position belongs to its object. */
+                for (size_t j = 0; j < data.m_c_inRange.size(); j += 101) {
+                    QPointF const d = data.m_c_screenPositions[j] - priv::int_projectPosition(data.m_c_projection, data.m_objManager.positions()[data.m_c_inRange[j]]);
+                    QVERIFY(QPointF::dotProduct(d, d) < 1e-6);
+                }
+            }
+            /**
+             * \brief tests whether moving objects are extrapolated between position updates, up to
+             *        the prediction horizon
+             */
+            void testObjectRadarDeadReckoning() {
+                ObjectRadar         radar{ QSize{ 400, 400 } };
+                ObjectRadarPrivate &data = *radar.m_data;
+                priv::ROM          &rom  = data.m_objManager;
+
+                ObjectHandle const obj = radar.addObject("mover", ObjectRadar::ObjectType::Vehicle, data.m_radarCenter);
+                QVERIFY(radar.setProperty(obj, ObjectRadar::Property::GroundSpeed, 10.f));
+                QVERIFY(radar.setProperty(obj, ObjectRadar::Property::Heading, 90.f));
+                QVERIFY(!radar.setProperty(obj, ObjectRadar::Property::Heading, 400.f));
+                QVERIFY(radar.getProperty(obj, ObjectRadar::Property::GroundSpeed) == 10.f);
+                size_t const i = *rom.getIndex(obj);
+
+                /* Disabled by default. */
+                data.m_c_frameTime = rom.fixTimes()[i] + 1.;
+                QVERIFY(data.int_positionOf(i) == rom.positions()[i]);
+
+                /* One second at 10 m/s towards east, ... */
+                QVERIFY(radar.setProperty(ObjectRadar::Property::PredictionHorizon, 2.f));
+                QPointF const pred = data.int_positionOf(i);
+                QVERIFY(std::abs(priv::int_distanceSquared(rom.positions()[i], pred) - 100.) < 1e-3);
+                QVERIFY(std::abs(pred.x() - rom.positions()[i].x()) < 1e-12 && pred.y() > rom.positions()[i].y());
+
+                /* ... but never further than the horizon; the projection pass agrees. */
+                data.m_c_frameTime = rom.fixTimes()[i] + 5.;
+                data.int_projectObjects();
+                QVERIFY(data.m_c_inRange.size() == 1);
+                QPointF const d = data.m_c_screenPositions[0] - data.m_c_projection.m_origin;
+                QVERIFY(std::abs(d.x() - 20. * data.m_c_projection.m_pxPerMeter) < 1e-6 && std::abs(d.y()) < 1e-6);
+
+                /* Objects that are still being extrapolated are repainted every frame. */
+                std::vector<quint32> dirty;
+                rom.takeChanges(*data.m_changeTracker, dirty);
+                dirty.clear();
+                data.int_beginFrame();
+                QVERIFY(!rom.takeChanges(*data.m_changeTracker, dirty) && dirty.size() == 1 && dirty[0] == obj.index());
+
+                /* A position update restarts the extrapolation; by default, it keeps the motion. */
+                ObjectRadar::ObjectUpdate upd;
+                upd.m_handle   = obj;
+                upd.m_position = rom.positions()[i];
+                QVERIFY(radar.updateObjects(&upd, 1) == 1);
+                QVERIFY(rom.groundSpeeds()[i] == 10.f && rom.headings()[i] == 90.f);
+                data.m_c_frameTime = rom.fixTimes()[i];
+                QVERIFY(data.int_positionOf(i) == rom.positions()[i]);
+            }
+            /**
+             * \brief tests whether the serial and the parallel pass cull extrapolated objects alike
+             */
+            void testObjectRadarPredictedCulling() {
+                ObjectRadar         radar{ QSize{ 400, 400 } };
+                ObjectRadarPrivate &data = *radar.m_data;
+                priv::ROM          &rom  = data.m_objManager;
+                QPointF const       c    = data.m_radarCenter;
+                double const        dlat = 1. / priv::gl_MetersPerDeg;
+
+                /* Within a 35 m range: one object 45 m north heading south, one 25 m north heading north. */
+                ObjectHandle const inbound  = radar.addObject("inbound", ObjectRadar::ObjectType::Vehicle, c + QPointF{ 45. * dlat, 0. });
+                ObjectHandle const outbound = radar.addObject("outbound", ObjectRadar::ObjectType::Vehicle, c + QPointF{ 25. * dlat, 0. });
+                QVERIFY(radar.setProperty(inbound, ObjectRadar::Property::GroundSpeed, 20.f));
+                QVERIFY(radar.setProperty(inbound, ObjectRadar::Property::Heading, 180.f));
+                QVERIFY(radar.setProperty(outbound, ObjectRadar::Property::GroundSpeed, 20.f));
+                QVERIFY(radar.set<ObjectRadar::Property::RadarRange>(QSizeF(5., 35.)));
+                QVERIFY(radar.setProperty(ObjectRadar::Property::PredictionHorizon, 2.f));
+
+                /* One second later, they swapped sides of the range boundary. */
+                size_t const i = *rom.getIndex(inbound);
+                data.m_c_frameTime = rom.fixTimes()[*rom.getIndex(outbound)] + 1.;
+                data.int_projectObjects();
+                QVERIFY(data.m_c_inRange.size() == 1 && data.m_c_inRange[0] == i);
+                if (data.int_projectObjectsParallel())
+                    QVERIFY(data.m_c_inRange.size() == 1 && data.m_c_inRange[0] == i);
+            }
+            /**
+             * \brief tests whether labels are placed without overlaps and keep their placement
+             *        when objects barely move
+             */
+            void testObjectRadarLabelLayout() {
+                ObjectRadar         radar{ QSize{ 400, 400 } };
+                ObjectRadarPrivate &data = *radar.m_data;
+                QPointF const       mid  = data.m_c_projection.m_origin;
+                auto const          at   = [&](QPointF const &pt) { return priv::int_unprojectPosition(data.m_c_projection, pt); };
+
+                /* A dense cluster: more objects than candidate positions. */
+                std::vector<ObjectHandle> handles;
+                for (int k = 0; k < 8; k++)
+                    handles.push_back(radar.addObject(QString{ "OBJECT-%1" }.arg(k), ObjectRadar::ObjectType::Vehicle, at(mid + QPointF{ k * 0.5, 0. })));
+                radar.addObject(QString{ "FAR" }, ObjectRadar::ObjectType::Vehicle, at(mid + QPointF{ 0., 120. }));
+                data.int_projectObjects();
+                data.m_c_displaced.clear();
+                data.int_layoutLabels(data.m_c_displaced);
+
+                std::vector<QRectF> shown;
+                for (size_t j = 0; j < data.m_c_inRange.size(); j++) {
+                    QRectF const rect = data.int_labelRect(data.m_c_inRange[j], data.m_c_screenPositions[j]);
+                    if (rect.isNull())
+                        continue;
+
+                    for (QRectF const &other : shown)
+                        QVERIFY(!rect.intersects(other));
+                    for (QPointF const &pt : data.m_c_screenPositions)
+                        QVERIFY(!rect.intersects(priv::int_markerObstacle(pt)));
+                    shown.push_back(rect);
+                }
+                QVERIFY(shown.size() > 1 && shown.size() < data.m_c_inRange.size());
+
+                /* The isolated object keeps the preferred position. */
+                auto const distant = data.m_objManager.findObject(QString{ "FAR" });
+                auto const fi      = data.m_objManager.getIndex(distant);
+                QPointF const fpt = priv::int_projectPosition(data.m_c_projection, data.m_objManager.positions()[*fi]);
+                QVERIFY(data.m_c_placements[distant.index()].m_candidate == 0 && !data.int_labelRect(*fi, fpt).isNull());
+
+                /* Sub-pixel motion does not move any label. */
+                std::vector<priv::LabelPlacement> const before = data.m_c_placements;
+                radar.setProperty(distant, ObjectRadar::Property::Position, at(fpt + QPointF{ 0.3, 0.3 }));
+                data.int_projectObjects();
+                data.m_c_displaced.clear();
+                data.int_layoutLabels(data.m_c_displaced);
+                QVERIFY(data.m_c_displaced.empty());
+                QVERIFY(data.m_c_placements[distant.index()].m_rect == before[distant.index()].m_rect);
+            }
+            /**
+             * \brief tests whether nearby objects are merged into badges that follow their cells
+             *        and split up as the range narrows
+             */
+            void testObjectRadarClustering() {
+                ObjectRadar         radar{ QSize{ 400, 400 } };
+                ObjectRadarPrivate &data = *radar.m_data;
+                QPointF const       mid  = data.m_c_projection.m_origin;
+                auto const          at   = [&](QPointF const &pt) { return priv::int_unprojectPosition(data.m_c_projection, pt); };
+                auto const          layout = [&]() {
+                    data.int_projectObjects();
+                    data.int_layoutFrame();
+                };
+
+                std::vector<ObjectHandle> handles;
+                for (QPointF const &d : { QPointF{ 10., 10. }, QPointF{ 12., 14. }, QPointF{ 15., 11. } })
+                    handles.push_back(radar.addObject(QString::number(handles.size()), ObjectRadar::ObjectType::Vehicle, at(mid + d)));
+                ObjectHandle const lone = radar.addObject(QString{ "LONE" }, ObjectRadar::ObjectType::Vehicle, at(mid + QPointF{ -100., -100. }));
+
+                /* Disabled by default. */
+                layout();
+                QVERIFY(data.m_c_clusters.empty());
+
+                QVERIFY(radar.setProperty(ObjectRadar::Property::ClusterCellSize, 40));
+                layout();
+                QVERIFY(data.m_c_clusters.size() == 1 && data.m_c_clusters[0].m_count == 3);
+                QVERIFY(data.m_c_clusters[0].m_center == mid + QPointF(20., 20.));
+                for (ObjectHandle const h : handles) {
+                    size_t const i = *data.m_objManager.getIndex(h);
+                    QVERIFY(data.int_clusterOf(i).has_value());
+                    QVERIFY(data.int_labelRect(i, data.m_c_clusters[0].m_center).isNull());
+                }
+                QVERIFY(!data.int_clusterOf(*data.m_objManager.getIndex(lone)).has_value());
+
+                /* Moving within the cell changes nothing; crossing into the next one splits the object out. */
+                radar.setProperty(handles[0], ObjectRadar::Property::Position, at(mid + QPointF{ 11., 12. }));
+                layout();
+                QVERIFY(std::find(data.m_c_displaced.begin(), data.m_c_displaced.end(), handles[0].index()) == data.m_c_displaced.end());
+                radar.setProperty(handles[0], ObjectRadar::Property::Position, at(mid + QPointF{ 60., 10. }));
+                layout();
+                QVERIFY(data.m_c_clusters.size() == 1 && data.m_c_clusters[0].m_count == 2);
+                QVERIFY(std::find(data.m_c_displaced.begin(), data.m_c_displaced.end(), handles[0].index()) != data.m_c_displaced.end());
+                QVERIFY(!data.int_clusterOf(*data.m_objManager.getIndex(handles[0])).has_value());
+
+                /* The tracked object is never merged. */
+                radar.setTrackedObject(handles[1]);
+                layout();
+                QVERIFY(data.m_c_clusters.empty());
+                radar.setTrackedObject(lone);
+
+                /* Narrowing the range spreads the objects over more cells. */
+                layout();
+                QVERIFY(data.m_c_clusters.size() == 1);
+                QSizeF const narrow{ 1., 35. / 8. };
+                QVERIFY(radar.setProperty(ObjectRadar::Property::RadarRange, narrow));
+                layout();
+                QVERIFY(data.m_c_clusters.empty());
+            }
+            /**
+             * \brief tests whether frame statistics describe the last completed frame and are
+             *        published at the requested rate
+             */
+            void testObjectRadarFrameStatistics() {
+                ObjectRadar         radar{ QSize{ 200, 200 } };
+                ObjectRadarPrivate &data = *radar.m_data;
+
+#if (defined TFD_INSTRUMENTATION)
+                using Stats = ObjectRadar::FrameStatistics;
+
+                radar.addObject(QString{ "NEAR" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 0., 0. });
+                radar.addObject(QString{ "FAR" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 10., 10. });
+                data.int_completeFrameStatistics();
+                {
+                    TFD_PROFILE_STAGE(data, Layout);
+                    data.int_projectObjects();
+                }
+                data.int_completeFrameStatistics();
+
+                auto const stats = radar.getFrameStatistics();
+                QVERIFY(stats.has_value() && stats->m_frame == 1);
+                QVERIFY(stats->m_objectCount == 2 && stats->m_inRangeCount == 1 && stats->m_culledCount == 1);
+                QVERIFY(stats->m_allocations == 0);
+                QVERIFY(stats->m_stageTimes[Stats::Layout] >= 0. && stats->m_frameTime == stats->m_stageTimes[Stats::Layout]);
+                QVERIFY(stats->m_requestedRate == data.m_updateRate);
+
+                /* Published once per statistics period. */
+                QVERIFY(radar.setProperty(ObjectRadar::Property::StatisticsRate, 60.f));
+                std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+                QVERIFY(data.int_completeFrameStatistics());
+                QVERIFY(!data.int_completeFrameStatistics());
+                QVERIFY(radar.getFrameStatistics()->m_achievedRate > 0.f);
+#else
+                QVERIFY(!radar.getFrameStatistics().has_value());
+                QVERIFY(data.int_overlayRect().isNull());
+#endif
+            }
+            /**
+             * \brief tests whether the frame arena grows to fit a frame on reset, and takes
+             *        nothing from the heap once it does
+             */
+            void testFrameArena() {
+                priv::FrameArena arena{ 1024 };
+
+                {
+                    std::pmr::vector<quint32> v{ &arena };
+                    v.reserve(128);
+#if (defined TFD_INSTRUMENTATION)
+                    QVERIFY(arena.frameAllocations() == 0);
+#endif
+                    v.reserve(1024);
+#if (defined TFD_INSTRUMENTATION)
+                    QVERIFY(arena.frameAllocations() == 1);
+#endif
+                }
+                arena.reset();
+                QVERIFY(arena.capacity() >= 128 * sizeof(quint32) + 1024 * sizeof(quint32));
+#if (defined TFD_INSTRUMENTATION)
+                QVERIFY(arena.frameAllocations() == 1);
+#endif
+
+                /* The same frame now fits. */
+                size_t const size = arena.capacity();
+                for (int frame = 0; frame < 4; frame++) {
+                    {
+                        std::pmr::vector<quint32> v{ &arena };
+                        v.reserve(128);
+                        v.reserve(1024);
+                    }
+                    arena.reset();
+                    QVERIFY(arena.capacity() == size);
+#if (defined TFD_INSTRUMENTATION)
+                    QVERIFY(arena.frameAllocations() == 0);
+#endif
+                }
+            }
+            /**
+             * \brief tests whether a fixed object capacity is enforced, and whether add/remove
+             *        cycles and steady-state frames reuse the pre-allocated storage
+             */
+            void testObjectRadarObjectPool() {
+                ObjectRadar         radar{ QSize{ 200, 200 } };
+                ObjectRadarPrivate &data = *radar.m_data;
+                priv::ROM          &rom  = data.m_objManager;
+
+                QVERIFY(radar.setObjectCapacity(64) && radar.getObjectCapacity() == 64);
+                std::vector<QString> idents;
+                for (int k = 0; k < 65; k++)
+                    idents.push_back(QString::number(k));
+
+                QPointF const *positions = rom.positions().data();
+                size_t const   nslots    = rom.m_slots.capacity();
+                size_t const   nentries  = rom.m_identMap.capacity();
+                for (int round = 0; round < 4; round++) {
+                    std::vector<ObjectHandle> handles;
+                    for (int k = 0; k < 64; k++)
+                        handles.push_back(radar.addObject(idents[k], ObjectRadar::ObjectType::Vehicle, QPointF{ k * 1e-4, round * 1e-4 }));
+                    QVERIFY(std::all_of(handles.begin(), handles.end(), [](ObjectHandle h) { return h.isValid(); }));
+                    QVERIFY(!radar.addObject(idents[64], ObjectRadar::ObjectType::Vehicle, QPointF{}).isValid());
+                    QVERIFY(!radar.setObjectCapacity(32));
+
+                    /* Remove every other object; the rest must still be found by identifier. */
+                    for (int k = 0; k < 64; k += 2)
+                        QVERIFY(radar.removeObject(handles[k]));
+                    for (int k = 0; k < 64; k++)
+                        QVERIFY(radar.hasObject(idents[k]) == (k % 2 != 0));
+                    radar.removeAllObjects();
+                }
+                QVERIFY(rom.positions().data() == positions);
+                QVERIFY(rom.m_slots.capacity() == nslots && rom.m_identMap.capacity() == nentries);
+
+                /* Frames over a full pool project into the pre-sized draw lists. */
+                std::vector<ObjectHandle> handles;
+                for (int k = 0; k < 64; k++)
+                    handles.push_back(radar.addObject(idents[k], ObjectRadar::ObjectType::Vehicle, data.m_radarCenter));
+                quint32 const *inrange = data.m_c_inRange.data();
+                QPointF const *screen  = data.m_c_screenPositions.data();
+                for (int frame = 0; frame < 4; frame++) {
+                    for (int k = 0; k < 64; k++)
+                        QVERIFY(radar.setProperty(handles[k], ObjectRadar::Property::Position, data.m_radarCenter + QPointF{ (k % 8) * 1e-5, frame * 1e-5 }));
+                    data.int_projectObjects();
+                    QVERIFY(data.m_c_inRange.size() == 64);
+                    QVERIFY(data.m_c_inRange.data() == inrange && data.m_c_screenPositions.data() == screen);
+                }
+                QVERIFY(rom.positions().data() == positions && rom.m_slots.capacity() == nslots);
+
+                /* Steady frames (projection, clustering and sprite blits) take their scratch buffers from the frame arena alone. */
+                QVERIFY(radar.setProperty(ObjectRadar::Property::ClusterCellSize, 40));
+                QImage   image{ QSize{ 200, 200 }, QImage::Format_ARGB32_Premultiplied };
+                QPainter painter{ &image };
+                for (int frame = 0; frame < 8; frame++) {
+                    data.int_beginFrame();
+                    for (int k = 0; k < 64; k++)
+                        QVERIFY(radar.setProperty(handles[k], ObjectRadar::Property::Position, data.m_radarCenter + QPointF{ (k % 8) * 1e-3, frame * 1e-5 }));
+                    data.int_projectObjects();
+                    data.int_layoutFrame();
+                    data.int_drawObjects(painter, image.rect());
+#if (defined TFD_INSTRUMENTATION)
+                    if (frame >= 2)
+                        QVERIFY(data.m_frameArena.frameAllocations() == 0);
+#endif
+                }
+
+                /* Lifting the limit keeps the storage. */
+                radar.removeAllObjects();
+                QVERIFY(radar.setObjectCapacity(0) && radar.getObjectCapacity() == 0);
+                for (int k = 0; k < 65; k++)
+                    QVERIFY(radar.addObject(idents[k], ObjectRadar::ObjectType::Vehicle, QPointF{}).isValid());
+                QVERIFY(rom.size() == 65 && rom.capacity() == 0);
+            }
+            /**
+             * \brief tests whether snapshots restore objects, geometries and view properties, and
+             *        whether malformed snapshots are rejected without touching the radar
+             */
+            void testObjectRadarSnapshot() {
+                ObjectRadar radar{ QSize{ 200, 200 } };
+
+                std::vector<QPointF> outline;
+                for (int k = 0; k < 256; k++)
+                    outline.emplace_back(std::cos(k * priv::gl_PI / 128.) * 1e-2, std::sin(k * priv::gl_PI / 128.) * 1e-2);
+                RadarArea area{ std::vector<QPointF>(outline) };
+
+                ObjectHandle const veh   = radar.addObject(QString{ "VEH" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 1e-3, 2e-3 }, 120.f);
+                ObjectHandle const fence = radar.addObject(QString{ "FENCE" }, ObjectRadar::ObjectType::Area, QPointF{});
+                QVERIFY(radar.setProperty(veh, ObjectRadar::Property::Color, QColor(Qt::red)));
+                QVERIFY(radar.setProperty(veh, ObjectRadar::Property::GroundSpeed, 50.f));
+                QVERIFY(radar.setProperty(veh, ObjectRadar::Property::Heading, 90.f));
+                QVERIFY(radar.setArea(fence, std::move(area)));
+                QVERIFY(radar.setProperty(ObjectRadar::Property::RadarCenter, QPointF(48., 11.)));
+                QVERIFY(radar.setProperty(ObjectRadar::Property::ClusterCellSize, 24));
+                radar.setTrackedObject(veh);
+
+                QTemporaryDir dir;
+                QVERIFY(dir.isValid());
+                QString const path = dir.filePath(QString{ "scene.tfds" });
+                QVERIFY(radar.saveSnapshot(path));
+
+                /* Restored into a fresh radar. */
+                ObjectRadar copy{ QSize{ 200, 200 } };
+                QVERIFY(copy.loadSnapshot(path));
+                ObjectHandle const cveh   = copy.getHandle(QString{ "VEH" });
+                ObjectHandle const cfence = copy.getHandle(QString{ "FENCE" });
+                QVERIFY(cveh.isValid() && cfence.isValid());
+                QVERIFY(copy.getTrackedObjectHandle() == cveh);
+                QVERIFY(copy.getProperty(cveh, ObjectRadar::Property::Position).toPointF() == QPointF(1e-3, 2e-3));
+                QVERIFY(copy.getProperty(cveh, ObjectRadar::Property::Color).value<QColor>() == QColor(Qt::red));
+                QVERIFY(copy.getProperty(cveh, ObjectRadar::Property::Heading).toFloat() == 90.f);
+                QVERIFY(copy.getProperty(ObjectRadar::Property::RadarCenter).toPointF() == QPointF(48., 11.));
+                QVERIFY(copy.getProperty(ObjectRadar::Property::ClusterCellSize).toInt() == 24);
+
+                priv::ROM const   &src   = radar.m_data->m_objManager;
+                priv::ROM const   &dst   = copy.m_data->m_objManager;
+                priv::Shape const &shape = dst.shapes()[*dst.getIndex(cfence)];
+                priv::Shape const &orig  = src.shapes()[*src.getIndex(fence)];
+                QVERIFY(shape.m_vertices == outline && shape.m_extent == orig.m_extent);
+                QVERIFY(!orig.m_lods.empty() && shape.m_lods.size() == orig.m_lods.size());
+                for (size_t k = 0; k < orig.m_lods.size(); k++)
+                    QVERIFY(shape.m_lods[k].m_tolerance == orig.m_lods[k].m_tolerance && shape.m_lods[k].m_vertices == orig.m_lods[k].m_vertices);
+                QVERIFY(!dst.colors()[*dst.getIndex(cfence)].isValid());
+                QVERIFY(dst.findNearest(QPointF(1e-3, 2e-3), 10.) == dst.getIndex(cveh));
+
+                /* Loading replaces the objects in place; earlier handles become stale. */
+                std::vector<quint64> buf = copy.m_data->int_encodeSnapshot();
+                size_t const         size = static_cast<size_t>(reinterpret_cast<priv::SnapshotHeader const *>(buf.data())->m_size);
+                QVERIFY(radar.loadSnapshot(buf.data(), size));
+                QVERIFY(!radar.hasObject(veh) && radar.hasObject(QString{ "VEH" }));
+                QVERIFY(radar.m_data->m_objManager.size() == 2);
+
+                /* Unaligned buffers are copied first. */
+                std::vector<char> unaligned(size + 1);
+                std::memcpy(unaligned.data() + 1, buf.data(), size);
+                QVERIFY(radar.loadSnapshot(unaligned.data() + 1, size));
+
+                /* Malformed snapshots are rejected and the current scene is kept. */
+                ObjectHandle const live = radar.getHandle(QString{ "VEH" });
+                QVERIFY(!radar.loadSnapshot(buf.data(), size - 1));
+                auto *hdr = reinterpret_cast<priv::SnapshotHeader *>(buf.data());
+                hdr->m_version++;
+                QVERIFY(!radar.loadSnapshot(buf.data(), size));
+                hdr->m_version--;
+                reinterpret_cast<priv::SnapshotObject *>(reinterpret_cast<uchar *>(buf.data()) + hdr->m_objectOffset)->m_ident.m_length = 1u << 30;
+                QVERIFY(!radar.loadSnapshot(buf.data(), size));
+                QVERIFY(radar.hasObject(live));
+
+                /* The object capacity is a hard limit. */
+                ObjectRadar limited{ QSize{ 200, 200 } };
+                QVERIFY(limited.setObjectCapacity(1));
+                QVERIFY(!limited.loadSnapshot(path));
+                QVERIFY(!limited.loadSnapshot(dir.filePath(QString{ "missing.tfds" })));
+            }
+            /**
+             * \brief tests whether recorded update logs replay into the same scene, and whether
+             *        truncated logs still replay up to the last complete record
+             */
+            void testObjectRadarRecordReplay() {
+                ObjectRadar radar{ QSize{ 200, 200 } };
+                QVERIFY(radar.addObject(QString{ "PRE" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 1., 1. }).isValid());
+                QVERIFY(radar.setProperty(ObjectRadar::Property::ClusterCellSize, 18));
+
+                QTemporaryDir dir;
+                QVERIFY(dir.isValid());
+                QString const path = dir.filePath(QString{ "updates.tfdl" });
+                QVERIFY(!radar.stopRecording());
+                QVERIFY(radar.startRecording(path) && radar.isRecording());
+
+                ObjectHandle const veh   = radar.addObject(QString{ "VEH" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 48.1, 11.5 }, 300.f);
+                ObjectHandle const fence = radar.addObject(QString{ "FENCE" }, ObjectRadar::ObjectType::Area, QPointF{});
+                QVERIFY(radar.setProperty(veh, ObjectRadar::Property::Color, QColor(Qt::green)));
+                QVERIFY(radar.setArea(fence, RadarArea{ std::vector<QPointF>{ { 0., 0. }, { 0., 1e-2 }, { 1e-2, 1e-2 } } }));
+                QVERIFY(radar.setProperty(ObjectRadar::Property::RadarCenter, QPointF(48., 11.)));
+                radar.setTrackedObject(veh);
+
+                std::vector<ObjectRadar::ObjectUpdate> batch(1);
+                for (int k = 0; k < 100; k++) {
+                    batch[0].m_handle   = veh;
+                    batch[0].m_position = QPointF(48.1 + k * 1e-5, 11.5 - k * 1e-5);
+                    batch[0].m_altitude = 300.f + k;
+                    QVERIFY(radar.updateObjects(batch) == 1);
+                }
+                QVERIFY(radar.removeObject(QString{ "PRE" }));
+                QVERIFY(radar.stopRecording() && !radar.isRecording());
+
+                /* Replay as fast as possible into a fresh radar. */
+                ObjectRadar  copy{ QSize{ 200, 200 } };
+                UpdateReplay replay{ &copy };
+                QVERIFY(!replay.start(UpdateReplay::Pace::Unthrottled));
+                QVERIFY(replay.open(path));
+                QVERIFY(copy.addObject(QString{ "STALE" }, ObjectRadar::ObjectType::Vehicle, QPointF{}).isValid());
+                QVERIFY(replay.start(UpdateReplay::Pace::Unthrottled));
+                replay.stop();
+                while (!replay.m_data->step())
+                    ;
+                QVERIFY(!copy.hasObject(QString{ "STALE" }) && !copy.hasObject(QString{ "PRE" }));
+                QVERIFY(copy.getProperty(ObjectRadar::Property::ClusterCellSize).toInt() == 18);
+                QVERIFY(copy.getProperty(ObjectRadar::Property::RadarCenter).toPointF() == QPointF(48., 11.));
+
+                ObjectHandle const cveh = copy.getHandle(QString{ "VEH" });
+                QVERIFY(copy.getTrackedObjectHandle() == cveh && cveh.isValid());
+                QPointF const pos = copy.getProperty(cveh, ObjectRadar::Property::Position).toPointF();
+                QVERIFY(std::abs(pos.x() - (48.1 + 99e-5)) < 1e-8 && std::abs(pos.y() - (11.5 - 99e-5)) < 1e-8);
+                QVERIFY(copy.getProperty(cveh, ObjectRadar::Property::Altitude).toFloat() == 399.f);
+                QVERIFY(copy.getProperty(cveh, ObjectRadar::Property::Color).value<QColor>() == QColor(Qt::green));
+                QVariant const fence2 = copy.getProperty(copy.getHandle(QString{ "FENCE" }), ObjectRadar::Property::Area);
+                QVERIFY(fence2.value<RadarArea>().vertices().size() == 3);
+                QVERIFY(replay.getReplayedUpdates() >= 100);
+
+                /* A truncated log replays up to its last complete record. */
+                QFile file{ path };
+                QVERIFY(file.open(QIODevice::ReadOnly));
+                QByteArray data = file.readAll();
+                file.close();
+                data.chop(3);
+                QString const cut = dir.filePath(QString{ "truncated.tfdl" });
+                QFile         out{ cut };
+                QVERIFY(out.open(QIODevice::WriteOnly) && out.write(data) == data.size());
+                out.close();
+                QVERIFY(replay.open(cut) && replay.start(UpdateReplay::Pace::Unthrottled));
+                replay.stop();
+                while (!replay.m_data->step())
+                    ;
+                QVERIFY(copy.hasObject(QString{ "VEH" }));
+
+                /* Foreign files are rejected. */
+                QVERIFY(!replay.open(dir.filePath(QString{ "missing.tfdl" })));
+                data[0] = 'X';
+                QVERIFY(out.open(QIODevice::WriteOnly) && out.write(data) == data.size());
+                out.close();
+                QVERIFY(!replay.open(cut));
+
+                /* Object updates made through other views of the scene are logged; their view properties are not. */
+                auto const  scene = std::make_shared<RadarScene>();
+                ObjectRadar recording{ scene, QSize{ 200, 200 } };
+                ObjectRadar other{ scene, QSize{ 200, 200 } };
+                QString const shared = dir.filePath(QString{ "shared.tfdl" });
+                {
+                    ObjectRadar closed{ scene, QSize{ 200, 200 } };
+                    QVERIFY(closed.startRecording(dir.filePath(QString{ "closed.tfdl" })));
+                }
+                QVERIFY(recording.startRecording(shared) && scene->m_data->m_recorders.size() == 1);
+
+                ObjectHandle const remote = other.addObject(QString{ "REMOTE" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 48., 11. });
+                ObjectHandle const gone   = other.addObject(QString{ "GONE" }, ObjectRadar::ObjectType::Vehicle, QPointF{ 48., 11. });
+                QVERIFY(other.setProperty(remote, ObjectRadar::Property::Color, QColor(Qt::red)));
+                QVERIFY(other.setProperty(ObjectRadar::Property::ClusterCellSize, 24));
+                QVERIFY(other.removeObject(gone));
+                std::shared_ptr<UpdateChannel> ch = other.openUpdateChannel();
+                ObjectRadar::ObjectUpdate      upd;
+                upd.m_handle   = remote;
+                upd.m_altitude = 120.f;
+                upd.m_fields   = ObjectRadar::ObjectUpdate::Field::Altitude;
+                QVERIFY(ch->push(upd) && priv::int_ingestChannels(other, *other.m_data) == 1);
+                QVERIFY(recording.stopRecording() && scene->m_data->m_recorders.empty());
+
+                ObjectRadar  mirror{ QSize{ 200, 200 } };
+                UpdateReplay mirrorReplay{ &mirror };
+                QVERIFY(mirrorReplay.open(shared) && mirrorReplay.start(UpdateReplay::Pace::Unthrottled));
+                mirrorReplay.stop();
+                while (!mirrorReplay.m_data->step())
+                    ;
+                ObjectHandle const mremote = mirror.getHandle(QString{ "REMOTE" });
+                QVERIFY(mremote.isValid() && !mirror.hasObject(QString{ "GONE" }));
+                QVERIFY(mirror.getProperty(mremote, ObjectRadar::Property::Color).value<QColor>() == QColor(Qt::red));
+                QVERIFY(mirror.getProperty(mremote, ObjectRadar::Property::Altitude).toFloat() == 120.f);
+                QVERIFY(mirror.getProperty(ObjectRadar::Property::ClusterCellSize).toInt() == 0);
             }
             /**
              * \brief tests whether the view can track an object and behave accordingly 
@@ -827,13 +9365,202 @@ namespace tfd {
              * \brief tests the functionality of the RadarArea class
              */
             void testRadarArea() {
-                // TODO: implement
+                RadarArea area{ { 0., 0. }, { 0., 1. } };
+                QVERIFY(area.addVertex(QPointF{ 1., 1. }) && area.vertices().size() == 3);
+
+                /* Out-of-range indices are rejected. */
+                QVERIFY(!area.removeVertex(-1) && !area.removeVertex(3));
+                QVERIFY(area.removeVertex(1) && area.vertices().size() == 2);
+                QVERIFY(area.vertices().back() == QPointF(1., 1.));
+
+                area.setSmooth(true);
+                QVERIFY(area.isSmooth());
+                area.clearVertices();
+                QVERIFY(area.vertices().empty());
+
+                /* Range operations. */
+                std::vector<QPointF> const pts{ { 0., 0. }, { 1., 0. }, { 1., 1. }, { 0., 1. } };
+                QVERIFY(area.reserve(8) && area.insertVertices(0, pts.data(), pts.size()));
+                QVERIFY(area.insertVertices(2, pts.data(), 2) && area.vertices().size() == 6);
+                QVERIFY(!area.insertVertices(7, pts.data(), 1) && !area.insertVertices(0, nullptr, 1));
+                QVERIFY(area.removeVertices(2, 2) && area.vertices() == pts);
+                QVERIFY(!area.removeVertices(3, 2) && !area.removeVertices(0, -1));
+                QVERIFY(area.setVertex(3, QPointF{ 0., 2. }) && area.vertices()[3] == QPointF(0., 2.));
+                QVERIFY(!area.setVertex(4, QPointF{}));
+
+                /* Vertices are moved in and out without copying. */
+                std::vector<QPointF> src = pts;
+                QPointF const       *raw = src.data();
+                RadarArea            moved{ std::move(src) };
+                QVERIFY(moved.vertices().data() == raw);
+                std::vector<QPointF> const out = moved.takeVertices();
+                QVERIFY(out.data() == raw && moved.vertices().empty());
+
+                /* Handing an area to an object takes over its vertices. */
+                ObjectHandle const obj = m_radar.addObject("moved", ObjectRadar::ObjectType::Area, QPointF{});
+                RadarArea          geo{ std::vector<QPointF>(out) };
+                QVERIFY(m_radar.setArea(obj, std::move(geo)) && geo.vertices().empty());
+                QVERIFY(m_radar.getProperty(obj, ObjectRadar::Property::Area).value<RadarArea>().vertices() == out);
+                QVERIFY(!m_radar.setArea(ObjectHandle{}, RadarArea{}));
+
+                /* So does a variant that is handed over, unless its value is shared. */
+                QVariant       single = QVariant::fromValue(RadarArea{ std::vector<QPointF>(out) });
+                QPointF const *vertex = static_cast<RadarArea const *>(single.constData())->vertices().data();
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Area, std::move(single)));
+                QVERIFY(static_cast<RadarArea const *>(single.constData())->vertices().empty());
+                QVERIFY(m_radar.m_data->m_objManager.shapes()[*m_radar.m_data->m_objManager.getIndex(obj)].m_vertices.data() == vertex);
+                QVariant       boxed  = QVariant::fromValue(RadarArea{ std::vector<QPointF>(out) });
+                QVariant const shared = boxed;
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Area, std::move(boxed)));
+                QVERIFY(shared.value<RadarArea>().vertices() == out);
+                QVERIFY(!m_radar.setProperty(obj, ObjectRadar::Property::Area, QVariant{ QSizeF{ 1., 1. } }));
+                QVERIFY(m_radar.removeObject(obj));
             }
             /**
              * \brief tests the functionality of the RadarPath class
              */
             void testRadarPath() {
-                // TODO: implement
+                RadarPath path{ { 0., 0. } };
+                QVERIFY(path.addVertex(QPointF{ 1., 1. }) && path.vertices().size() == 2);
+
+                /* Out-of-range indices are rejected. */
+                QVERIFY(!path.removeVertex(-1) && !path.removeVertex(2));
+                QVERIFY(path.removeVertex(0) && path.vertices().front() == QPointF(1., 1.));
+
+                path.clearVertices();
+                QVERIFY(path.vertices().empty() && !path.isSmooth());
+            }
+            /**
+             * \brief tests whether the screen-space geometry of areas is only rebuilt if needed
+             */
+            void testObjectRadarShapeGeometry() {
+                ObjectRadarPrivate &data = *m_radar.m_data;
+                double const        d    = 10. / priv::gl_MetersPerDeg;
+                QPointF const       c    = data.m_radarCenter;
+
+                /* The area property round-trips. */
+                ObjectHandle const obj = m_radar.addObject("area", ObjectRadar::ObjectType::Area, c);
+                RadarArea const    area{ c + QPointF{ -d, -d }, c + QPointF{ -d, d }, c + QPointF{ d, d }, c + QPointF{ d, -d } };
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Area, QVariant::fromValue(area)));
+                QVERIFY(m_radar.getProperty(obj, ObjectRadar::Property::Area).value<RadarArea>().vertices() == area.vertices());
+
+                /* Built once, then reused until the shape or the view changes. */
+                size_t const               i    = *data.m_objManager.getIndex(obj);
+                priv::ShapeGeometry const &geom = data.int_geometryOf(i);
+                quint64 const              rev  = geom.m_shapeRev;
+                QVERIFY(geom.m_outline->size() == 5 && geom.m_outline->front() == geom.m_outline->back());
+                QVERIFY(data.int_trianglesOf(i).size() == 6);
+                QVERIFY(data.int_geometryOf(i).m_triangles != nullptr);
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::RadarCenter, c + QPointF{ d, 0. }));
+                QVERIFY(data.int_geometryOf(i).m_triangles == nullptr && data.int_geometryOf(i).m_shapeRev == rev);
+
+                /* Smooth outlines are flattened into more segments. */
+                RadarArea smooth = area;
+                smooth.setSmooth(true);
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Area, QVariant::fromValue(smooth)));
+                QVERIFY(data.int_geometryOf(i).m_shapeRev != rev && data.int_geometryOf(i).m_outline->size() > 5);
+
+                /* Self-intersecting outlines are not filled. */
+                QPolygonF const bowtie{ std::vector<QPointF>{ { 0., 0. }, { 10., 10. }, { 10., 0. }, { 0., 10. } } };
+                std::vector<QPointF> tris;
+                QVERIFY(!priv::int_triangulate(bowtie, tris) && tris.empty());
+
+                QVERIFY(m_radar.setProperty(ObjectRadar::Property::RadarCenter, c));
+                QVERIFY(m_radar.removeObject(obj));
+            }
+            /**
+             * \brief tests whether detailed shapes are simplified at wide ranges and culled outside of the view
+             */
+            void testObjectRadarLevelOfDetail() {
+                ObjectRadarPrivate &data = *m_radar.m_data;
+                QPointF const       c    = data.m_radarCenter;
+
+                /* Circle with a radius of 5 km, sampled every ~6 m. */
+                std::vector<QPointF> circle;
+                for (int k = 0; k < 5000; k++) {
+                    double const a = 2. * priv::gl_PI * k / 5000.;
+                    circle.push_back(c + QPointF{ std::sin(a), std::cos(a) / std::cos(c.x() * priv::gl_PI / 180.) } * (5000. / priv::gl_MetersPerDeg));
+                }
+                auto const shape = priv::int_makeShape(circle, false);
+                QVERIFY(shape.has_value() && !shape->m_lods.empty());
+                for (size_t k = 1; k < shape->m_lods.size(); k++)
+                    QVERIFY(shape->m_lods[k].m_vertices.size() < shape->m_lods[k - 1].m_vertices.size());
+
+                /* Full detail when zoomed in, a fraction of the vertices when zoomed out. */
+                QVERIFY(shape->verticesAt(10.).size() == circle.size());
+                QVERIFY(shape->verticesAt(0.025).size() < circle.size() / 10);
+
+                /* Shapes outside of the view are culled before projection. */
+                ObjectHandle const obj = m_radar.addObject("far", ObjectRadar::ObjectType::Area, c);
+                RadarArea const    distant{ c + QPointF{ 1., 1. }, c + QPointF{ 1., 1.01 }, c + QPointF{ 1.01, 1. } };
+                QVERIFY(m_radar.setProperty(obj, ObjectRadar::Property::Area, QVariant::fromValue(distant)));
+                size_t const i = *data.m_objManager.getIndex(obj);
+                QVERIFY(data.int_geometryOf(i).m_outline->isEmpty() && data.int_objectBounds(i, QPointF{}).isNull());
+                QVERIFY(m_radar.removeObject(obj));
+            }
+            /**
+             * \brief tests whether zoom gestures scale the cached geometry and only rebuild it once the range settled
+             */
+            void testObjectRadarZoomGesture() {
+                ObjectRadar         radar{ QSize{ 200, 200 } };
+                ObjectRadarPrivate &data = *radar.m_data;
+                double const        d    = 10. / priv::gl_MetersPerDeg;
+                QPointF const       c    = data.m_radarCenter;
+
+                /* One area around the center, one 60 m north of it. */
+                ObjectHandle const inner = radar.addObject("inner", ObjectRadar::ObjectType::Area, c);
+                ObjectHandle const outer = radar.addObject("outer", ObjectRadar::ObjectType::Area, c);
+                RadarArea const    square{ c + QPointF{ -d, -d }, c + QPointF{ -d, d }, c + QPointF{ d, d }, c + QPointF{ d, -d } };
+                RadarArea const    north{ c + QPointF{ 6. * d, -d }, c + QPointF{ 6. * d, d }, c + QPointF{ 7. * d, d }, c + QPointF{ 7. * d, -d } };
+                QVERIFY(radar.setProperty(inner, ObjectRadar::Property::Area, QVariant::fromValue(square)));
+                QVERIFY(radar.setProperty(outer, ObjectRadar::Property::Area, QVariant::fromValue(north)));
+                size_t const i = *data.m_objManager.getIndex(inner);
+                size_t const j = *data.m_objManager.getIndex(outer);
+
+                /* A single range change is applied in full right away, ... */
+                quint64 const rev = data.m_c_viewRevision;
+                QVERIFY(radar.set<ObjectRadar::Property::RadarRange>(QSizeF(5., 40.)));
+                QVERIFY(data.m_c_viewRevision == rev + 1 && data.m_c_zoomScale == 1. && data.m_zoomTimer.isActive());
+                QVERIFY(!data.int_objectBounds(i, QPointF{}).isNull() && data.int_objectBounds(j, QPointF{}).isNull());
+                qint64 const scaleKey = data.m_c_radarScale.cacheKey();
+
+                /* ... but further changes before it settled only scale what was built. Shapes coming into view are built, too. */
+                QVERIFY(radar.set<ObjectRadar::Property::RadarRange>(QSizeF(5., 80.)));
+                QVERIFY(data.m_c_viewRevision == rev + 1 && std::abs(data.m_c_zoomScale - 0.5) < 1e-12);
+                QVERIFY(data.m_c_radarScale.cacheKey() == scaleKey);
+                QRect const     preview = data.int_objectBounds(j, QPointF{});
+                QPolygonF const outline = data.int_zoomedOutline(data.int_geometryOf(i));
+                QVERIFY(!preview.isNull() && QRect(QPoint(0, 0), QSize(200, 200)).contains(preview));
+
+                /* The kept scale is drawn with the same transform: its outer ring (40 m) and a shape vertex land where the current projection puts them. */
+                QPointF const o     = data.m_c_projection.m_origin;
+                QRectF const  scale = data.int_scaleRect();
+                QVERIFY(std::abs(scale.center().x() - o.x()) < 1e-9 && std::abs(scale.center().y() - o.y()) < 1e-9);
+                double const  ring = data.m_c_geometryProjection.m_radius * scale.width() / 200.;
+                QPointF const edge = priv::int_projectPosition(data.m_c_projection, c + QPointF{ 40. / priv::gl_MetersPerDeg, 0. });
+                QVERIFY(std::abs(ring - (o.y() - edge.y())) < 1e-6);
+                QPointF const vertex = data.int_zoomedOutline(data.int_geometryOf(j)).front();
+                QPointF const ref    = priv::int_projectPosition(data.m_c_projection, north.vertices().front());
+                QVERIFY(std::abs(vertex.x() - ref.x()) < 1e-6 && std::abs(vertex.y() - ref.y()) < 1e-6);
+                auto const scene = data.int_makeScene();
+                QVERIFY(scene != nullptr && scene->m_zoomScale == data.m_c_zoomScale);
+
+                /* Once settled, everything is rebuilt for the final range, right where the preview was. */
+                data.int_settleZoom();
+                QVERIFY(data.m_c_viewRevision == rev + 2 && data.m_c_zoomScale == 1. && !data.m_zoomTimer.isActive());
+                QVERIFY(data.m_c_radarScale.cacheKey() != scaleKey);
+
+                QRect const settled = data.int_objectBounds(j, QPointF{});
+                QVERIFY(std::abs(settled.left() - preview.left()) <= 1 && std::abs(settled.right() - preview.right()) <= 1);
+                QVERIFY(std::abs(settled.top() - preview.top()) <= 1 && std::abs(settled.bottom() - preview.bottom()) <= 1);
+                QPolygonF const &rebuilt = *data.int_geometryOf(i).m_outline;
+                QVERIFY(rebuilt.size() == outline.size());
+                for (qsizetype k = 0; k < rebuilt.size(); k++)
+                    QVERIFY(std::abs(rebuilt[k].x() - outline[k].x()) < 1e-6 && std::abs(rebuilt[k].y() - outline[k].y()) < 1e-6);
+
+                /* Settling twice does nothing. */
+                data.int_settleZoom();
+                QVERIFY(data.m_c_viewRevision == rev + 2);
             }
         };
     }
@@ -847,6 +9574,25 @@ namespace tfd {
 }
 
 
+
+/* internal entry points (see radar_p.hpp) */
+namespace tfd {
+    namespace priv {
+        void int_layoutView(ObjectRadarPrivate &data) noexcept {
+            data.m_isViewDirty = true;
+            data.int_takeDirtyRegion();
+        }
+
+        size_t int_ingestChannels(ObjectRadar &radar, ObjectRadarPrivate &data) noexcept {
+            return radar.updateObjects(data.int_drainChannels());
+        }
+
+        void int_consumeChanges(ObjectRadarPrivate &data) noexcept {
+            data.int_takeChanges();
+        }
+    }
+}
+
 /*
  * Include this file to fix linker errors that arise when defining a class
  * inside a .cpp file that carries the Q_OBJECT macro.
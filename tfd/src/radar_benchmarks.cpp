@@ -0,0 +1,377 @@
+/*****************************************************************************************
+ * tfd - Tophy's Flight Display                                                          *
+ *       flight instruments for use in remote controls, optimized for embedded platforms *
+ *                                                                                       *
+ * Copyright (c) 2024 TophUwO <tophuwo01@gmail.com>                                      *
+ *                                                                                       *
+ * Redistribution and use in source and binary forms, with or without modification, are  *
+ * permitted provided that the following conditions are met:                             *
+ *  1. Redistributions of source code must retain the above copyright notice, this list  *
+ *     of conditions and the following disclaimer.                                       *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this    *
+ *     list of conditions and the following disclaimer in the documentation and/or other *
+ *     materials provided with the distribution.                                         *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be *
+ *     used to endorse or promote products derived from this software without specific   *
+ *     prior written permission.                                                         *
+ *                                                                                       *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY   *
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES  *
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT   *
+ * SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,        *
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED  *
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR    *
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN      *
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN    *
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH   *
+ * DAMAGE.                                                                               *
+ *****************************************************************************************/
+
+/**
+ * \file  radar_benchmarks.cpp
+ * \brief benchmarks of the radar widget module of tfd
+ *
+ * Kept apart from the module itself since measuring memory usage requires platform APIs
+ * (and, on Windows, headers defining all kinds of macros) the module has no other use for.
+ */
+
+/* stdlib includes */
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <vector>
+
+/* platform includes (memory usage) */
+#if (defined _WIN32)
+    #if (!defined NOMINMAX)
+        #define NOMINMAX
+    #endif
+    #if (!defined WIN32_LEAN_AND_MEAN)
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    #include <psapi.h>
+#elif (defined __linux__)
+    #include <cstdio>
+#endif
+
+/* Qt includes */
+#include <QElapsedTimer>
+#include <QImage>
+#include <QTest>
+#include <QVariant>
+
+/* tfd includes */
+#include <tfd/src/include/radar.hpp>
+#include <tfd/src/radar_p.hpp>
+
+
+/* benchmarks for object radar */
+namespace tfd {
+    namespace tests {
+        /**
+         * \class ObjectRadarBenchmarks
+         * \brief defines benchmarks of the frame pipeline of the ObjectRadar class
+         *
+         * All scenes are synthetic and generated from fixed seeds, so that results are
+         * comparable between builds. Frames are rendered offscreen into an image via the raster
+         * backend.
+         *
+         * \note  Do not directly instantiate this class in user code. Use the
+         *        RunObjectRadarBenchmarks function instead in order to invoke the benchmarks
+         *        contained within this class.
+         */
+        class ObjectRadarBenchmarks : public QObject {
+            Q_OBJECT
+
+        private:
+            static constexpr double gl_Extent = 0.05; /**< objects are placed up to this many degrees from the radar center */
+
+            inline static QSize const   gl_ViewSize{ 600, 600 };          /**< size of the rendered frames */
+            inline static QPointF const gl_Center{ 48.137, 11.575 };      /**< radar center */
+            inline static QSizeF const  gl_Range{ 5., 6000. };            /**< radar range; covers most of the objects */
+
+            static constexpr double gl_PI = 3.14159265358979323846; /**< pi */
+
+            /**
+             * \struct MemoryUsage
+             * \brief  resident memory of the process
+             */
+            struct MemoryUsage {
+                quint64 m_workingSet = 0; /**< current working set, in bytes */
+                quint64 m_peak       = 0; /**< peak working set (high-water mark), in bytes */
+            };
+
+            std::optional<MemoryUsage> m_start;               /**< memory usage when the current benchmark started */
+            bool                       m_isPeakReset = false; /**< whether the high-water mark was reset when the current benchmark started */
+
+            /**
+             * \brief  retrieves the memory usage of the process
+             * \return memory usage, or an empty optional if it is unknown (or cannot be retrieved
+             *         on this platform)
+             */
+            static std::optional<MemoryUsage> int_memoryUsage() noexcept {
+#if (defined _WIN32)
+                PROCESS_MEMORY_COUNTERS pmc{};
+                if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+                    return MemoryUsage{ pmc.WorkingSetSize, pmc.PeakWorkingSetSize };
+#elif (defined __linux__)
+                std::FILE *f = std::fopen("/proc/self/status", "r");
+                if (f == nullptr)
+                    return std::optional<MemoryUsage>{};
+
+                /* Both are given in kB. */
+                MemoryUsage        usage;
+                unsigned long long kb    = 0;
+                int                found = 0;
+                char               line[256];
+                while (std::fgets(line, sizeof(line), f) != nullptr) {
+                    if (std::sscanf(line, "VmRSS: %llu", &kb) == 1) {
+                        usage.m_workingSet = kb * 1024;
+                        found++;
+                    } else if (std::sscanf(line, "VmHWM: %llu", &kb) == 1) {
+                        usage.m_peak = kb * 1024;
+                        found++;
+                    }
+                }
+                std::fclose(f);
+                if (found == 2)
+                    return usage;
+#endif
+                return std::optional<MemoryUsage>{};
+            }
+            /**
+             * \brief  resets the high-water mark of the working set to the current working set
+             * \return *true* if the mark was reset, *false* if that is not supported
+             * \note   Windows cannot reset the peak working set; the change in it is reported then.
+             */
+            static bool int_resetPeak() noexcept {
+#if (defined __linux__)
+                std::FILE *f = std::fopen("/proc/self/clear_refs", "w");
+                if (f == nullptr)
+                    return false;
+
+                bool const isreset = std::fputs("5", f) >= 0;
+                return std::fclose(f) == 0 && isreset;
+#else
+                return false;
+#endif
+            }
+            /**
+             * \brief reports the working set and its peak, and how much they grew since the
+             *        current benchmark started
+             * \note  Call this before the objects of the benchmark are destroyed. If the
+             *        high-water mark could not be reset at the start of the benchmark, an
+             *        increase of the peak only shows if the benchmark exceeded all earlier ones.
+             */
+            void int_reportMemory() const noexcept {
+                std::optional<MemoryUsage> const now = int_memoryUsage();
+                if (!m_start.has_value() || !now.has_value())
+                    return;
+
+                double const mib   = 1024. * 1024.;
+                auto const   delta = [mib](quint64 to, quint64 from) { return (static_cast<double>(to) - static_cast<double>(from)) / mib; };
+                qInfo("working set: %.1f MiB (%+.1f MiB), peak: %.1f MiB (%+.1f MiB%s)",
+                    now->m_workingSet / mib, delta(now->m_workingSet, m_start->m_workingSet),
+                    now->m_peak / mib, delta(now->m_peak, m_start->m_peak), m_isPeakReset ? "" : ", high-water mark"
+                );
+            }
+
+            /**
+             * \brief sets up the view all benchmarks are run with
+             * \param [in,out] radar object radar
+             */
+            static void int_setupView(ObjectRadar &radar) {
+                radar.setProperty(ObjectRadar::Property::RadarCenter, gl_Center);
+                radar.setProperty(ObjectRadar::Property::RadarRange, gl_Range);
+                radar.setProperty(ObjectRadar::Property::RedrawMode, static_cast<int>(ObjectRadar::RedrawMode::OnDemand));
+            }
+            /**
+             * \brief  fills a radar with objects of mixed types at random positions
+             * \param  [in,out] radar object radar
+             * \param  [in] n number of objects
+             * \param  [in] seed seed of the random number generator
+             * \return handles of the new objects
+             */
+            static std::vector<ObjectHandle> int_addObjects(ObjectRadar &radar, int n, unsigned seed) {
+                std::mt19937                           rng{ seed };
+                std::uniform_real_distribution<double> offset{ -gl_Extent, gl_Extent };
+                std::uniform_real_distribution<float>  alt{ 0.f, 3000.f };
+                ObjectRadar::ObjectType const          types[] = { ObjectRadar::ObjectType::Vehicle, ObjectRadar::ObjectType::Person, ObjectRadar::ObjectType::Marker };
+
+                std::vector<ObjectHandle> handles;
+                handles.reserve(n);
+                for (int k = 0; k < n; k++) {
+                    QPointF const pos = gl_Center + QPointF{ offset(rng), offset(rng) };
+
+                    handles.push_back(radar.addObject(QString{ "OBJ%1" }.arg(k), types[k % std::size(types)], pos, alt(rng)));
+                }
+                return handles;
+            }
+            /**
+             * \brief  generates a random, simple (star-shaped) polygon
+             * \param  [in,out] rng random number generator
+             * \param  [in] n number of vertices
+             * \return polygon; vertices are ordered by angle around a random center
+             */
+            static RadarArea int_makeArea(std::mt19937 &rng, int n) {
+                std::uniform_real_distribution<double> offset{ -gl_Extent, gl_Extent };
+                std::uniform_real_distribution<double> radius{ gl_Extent / 20., gl_Extent / 4. };
+
+                QPointF const c = gl_Center + QPointF{ offset(rng), offset(rng) };
+                RadarArea     area;
+                for (int k = 0; k < n; k++) {
+                    double const a = 2. * gl_PI * k / n;
+                    double const r = radius(rng);
+
+                    area.addVertex(c + QPointF{ r * std::cos(a), r * std::sin(a) });
+                }
+                return area;
+            }
+            /**
+             * \brief renders a full frame (layout and drawing) offscreen
+             * \param [in,out] radar object radar
+             * \param [in,out] frame image receiving the frame
+             */
+            static void int_renderFrame(ObjectRadar &radar, QImage &frame) {
+                priv::int_layoutView(*radar.m_data);
+
+                radar.render(&frame);
+            }
+
+        private slots:
+            /**
+             * \brief synthetic scenes of the frame benchmark
+             */
+            void benchmarkFrame_data() {
+                QTest::addColumn<int>("count");
+                QTest::addColumn<bool>("labels");
+
+                for (int const n : { 100, 1000, 10000, 50000 })
+                    for (bool const islabeled : { false, true })
+                        QTest::newRow(qPrintable(QString{ "%1 objects, labels %2" }.arg(n).arg(islabeled ? "on" : "off"))) << n << islabeled;
+            }
+            /**
+             * \brief measures full frames of scenes with many objects
+             */
+            void benchmarkFrame() {
+                QFETCH(int, count);
+                QFETCH(bool, labels);
+
+                ObjectRadar radar{ gl_ViewSize };
+                int_setupView(radar);
+                QVERIFY(radar.setProperty(ObjectRadar::Property::LabelVisibility, labels));
+                QVERIFY(int_addObjects(radar, count, 1).back().isValid());
+
+                QImage frame{ gl_ViewSize, QImage::Format_ARGB32_Premultiplied };
+                QBENCHMARK {
+                    int_renderFrame(radar, frame);
+                }
+                int_reportMemory();
+            }
+            /**
+             * \brief synthetic scenes of the area benchmark
+             */
+            void benchmarkAreas_data() {
+                QTest::addColumn<int>("vertices");
+
+                for (int const n : { 10, 100, 1000, 10000 })
+                    QTest::newRow(qPrintable(QString{ "%1 vertices" }.arg(n))) << n;
+            }
+            /**
+             * \brief measures full frames of scenes with complex areas (and some objects)
+             */
+            void benchmarkAreas() {
+                QFETCH(int, vertices);
+
+                ObjectRadar radar{ gl_ViewSize };
+                int_setupView(radar);
+                int_addObjects(radar, 100, 2);
+
+                std::mt19937 rng{ 3 };
+                for (int k = 0; k < 16; k++) {
+                    ObjectHandle const h = radar.addObject(QString{ "AREA%1" }.arg(k), ObjectRadar::ObjectType::Area, gl_Center);
+                    QVERIFY(radar.setProperty(h, ObjectRadar::Property::Area, QVariant::fromValue(int_makeArea(rng, vertices))));
+                }
+
+                QImage frame{ gl_ViewSize, QImage::Format_ARGB32_Premultiplied };
+                QBENCHMARK {
+                    int_renderFrame(radar, frame);
+                }
+                int_reportMemory();
+            }
+            /**
+             * \brief synthetic update streams of the ingest benchmark
+             */
+            void benchmarkIngest_data() {
+                QTest::addColumn<int>("count");
+                QTest::addColumn<bool>("channel");
+
+                for (int const n : { 1000, 10000, 50000 })
+                    for (bool const ischannel : { false, true })
+                        QTest::newRow(qPrintable(QString{ "%1 updates, %2" }.arg(n).arg(ischannel ? "channel" : "batch"))) << n << ischannel;
+            }
+            /**
+             * \brief measures how fast position updates of all objects are applied, either as a
+             *        batch or drained from an update channel
+             */
+            void benchmarkIngest() {
+                QFETCH(int, count);
+                QFETCH(bool, channel);
+
+                ObjectRadar radar{ gl_ViewSize };
+                int_setupView(radar);
+                std::vector<ObjectHandle> const handles = int_addObjects(radar, count, 4);
+
+                std::vector<ObjectRadar::ObjectUpdate> upd;
+                for (ObjectHandle const h : handles)
+                    upd.push_back(ObjectRadar::ObjectUpdate{ h, radar.getProperty(h, ObjectRadar::Property::Position).toPointF(), 100.f, true, ObjectRadar::ObjectUpdate::Position | ObjectRadar::ObjectUpdate::Altitude });
+                auto const ch = radar.openUpdateChannel(static_cast<size_t>(count));
+                QVERIFY(ch != nullptr);
+
+                quint64       applied = 0;
+                QElapsedTimer clock;
+                clock.start();
+                QBENCHMARK {
+                    for (ObjectRadar::ObjectUpdate &u : upd)
+                        u.m_position += QPointF{ 1e-6, 0. };
+
+                    if (channel) {
+                        QVERIFY(ch->push(upd.data(), upd.size()) == upd.size());
+                        applied += priv::int_ingestChannels(radar, *radar.m_data);
+                    } else
+                        applied += radar.updateObjects(upd);
+
+                    /* Consume the changes so that the dirty list does not grow across iterations. */
+                    priv::int_consumeChanges(*radar.m_data);
+                }
+                qInfo("%.0f updates per second", applied / std::max(clock.nsecsElapsed() * 1e-9, 1e-9));
+                int_reportMemory();
+            }
+
+            /**
+             * \brief resets the high-water mark and samples the memory usage before each benchmark
+             *        (and each of its rows)
+             */
+            void init() {
+                m_isPeakReset = int_resetPeak();
+                m_start       = int_memoryUsage();
+            }
+        };
+    }
+
+    int RunObjectRadarBenchmarks() {
+        auto benchmarks = tests::ObjectRadarBenchmarks();
+
+        /* Run object radar benchmarks. */
+        return QTest::qExec(&benchmarks);
+    }
+}
+
+/*
+ * Include this file to fix linker errors that arise when defining a class
+ * inside a .cpp file that carries the Q_OBJECT macro.
+ */
+#include <radar_benchmarks.moc>
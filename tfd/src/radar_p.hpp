@@ -0,0 +1,72 @@
+/*****************************************************************************************
+ * tfd - Tophy's Flight Display                                                          *
+ *       flight instruments for use in remote controls, optimized for embedded platforms *
+ *                                                                                       *
+ * Copyright (c) 2024 TophUwO <tophuwo01@gmail.com>                                      *
+ *                                                                                       *
+ * Redistribution and use in source and binary forms, with or without modification, are  *
+ * permitted provided that the following conditions are met:                             *
+ *  1. Redistributions of source code must retain the above copyright notice, this list  *
+ *     of conditions and the following disclaimer.                                       *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this    *
+ *     list of conditions and the following disclaimer in the documentation and/or other *
+ *     materials provided with the distribution.                                         *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be *
+ *     used to endorse or promote products derived from this software without specific   *
+ *     prior written permission.                                                         *
+ *                                                                                       *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY   *
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES  *
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT   *
+ * SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,        *
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED  *
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR    *
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN      *
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN    *
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH   *
+ * DAMAGE.                                                                               *
+ *****************************************************************************************/
+
+/**
+ * \file  radar_p.hpp
+ * \brief internal entry points of the radar widget module for other translation units of tfd
+ *
+ * The benchmarks are built as a translation unit of their own, so that the radar module does
+ * not depend on the platform APIs they use. They drive the frame pipeline through these
+ * functions; nothing here is exported from the library.
+ */
+
+#pragma once
+
+/* stdlib includes */
+#include <cstddef>
+
+/* tfd includes */
+#include <tfd/src/include/radar.hpp>
+
+
+namespace tfd {
+    namespace priv {
+        /**
+         * \brief lays out the next frame of a view like the redraw timer does, i.e., culls,
+         *        projects, clusters and places labels, and finds the dirty region
+         * \param [in,out] data internal state of the view
+         * \note  The entire view is marked dirty first, so that the full pass runs.
+         */
+        void int_layoutView(ObjectRadarPrivate &data) noexcept;
+        /**
+         * \brief  drains all update channels of a view and applies the updates
+         * \param  [in,out] radar view whose channels are drained
+         * \param  [in,out] data internal state of **radar**
+         * \return number of updates applied
+         */
+        size_t int_ingestChannels(ObjectRadar &radar, ObjectRadarPrivate &data) noexcept;
+        /**
+         * \brief consumes the changes a view has been notified of, like a frame would
+         * \param [in,out] data internal state of the view
+         */
+        void int_consumeChanges(ObjectRadarPrivate &data) noexcept;
+    }
+}
+
+